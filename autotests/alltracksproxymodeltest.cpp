@@ -66,8 +66,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -130,8 +130,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -202,8 +202,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -270,8 +270,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -353,8 +353,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -462,8 +462,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -18,6 +18,8 @@
 #include "databasetestdata.h"
 
 #include "databaseinterface.h"
+#include "collectionsnapshot.h"
+#include "albumartstore.h"
 #include "musicaudiotrack.h"
 
 #include "config-upnp-qt.h"
@@ -33,6 +35,12 @@
 #include <QDir>
 #include <QFile>
 #include <QTemporaryFile>
+#include <QFileInfo>
+#include <QBuffer>
+#include <QImage>
+#include <QLoggingCategory>
+#include <QSqlDatabase>
+#include <QSqlQuery>
 
 #include <QDebug>
 
@@ -64,6 +72,7 @@ private Q_SLOTS:
         qRegisterMetaType<DatabaseInterface::AlbumDataType>("AlbumDataType");
         qRegisterMetaType<DatabaseInterface::ArtistDataType>("ArtistDataType");
         qRegisterMetaType<DatabaseInterface::GenreDataType>("GenreDataType");
+        qRegisterMetaType<DatabaseInterface::DirectoriesDataType>("DirectoriesDataType");
     }
 
     void avoidCrashInTrackIdFromTitleAlbumArtist()
@@ -98,9 +107,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -193,9 +202,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -286,9 +295,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -376,9 +385,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -466,9 +475,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -575,9 +584,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -701,9 +710,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -848,9 +857,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -1086,9 +1095,9 @@ private Q_SLOTS:
             QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
             QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
             QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-            QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-            QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-            QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+            QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+            QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+            QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
             QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
             QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
             QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -1181,9 +1190,9 @@ private Q_SLOTS:
             QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
             QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
             QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-            QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-            QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-            QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+            QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+            QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+            QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
             QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
             QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
             QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -1359,6 +1368,724 @@ private Q_SLOTS:
         QCOMPARE(secondAlbumIsSingleDiscAlbum, true);
     }
 
+    void pagedAccessors()
+    {
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        auto allTracks = musicDb.allTracksData();
+        auto pagedTracks = DatabaseInterface::ListTrackDataType{};
+
+        auto tracksPage = musicDb.tracksDataPage({}, 0, 4);
+        while (!tracksPage.isEmpty()) {
+            QVERIFY(tracksPage.count() <= 4);
+            pagedTracks.append(tracksPage);
+            tracksPage = musicDb.tracksDataPage(tracksPage.last().title(), tracksPage.last().databaseId(), 4);
+        }
+
+        QCOMPARE(pagedTracks.count(), allTracks.count());
+
+        for (int i = 1; i < pagedTracks.count(); ++i) {
+            QVERIFY(pagedTracks[i - 1].title().compare(pagedTracks[i].title(), Qt::CaseInsensitive) <= 0);
+        }
+
+        auto allAlbums = musicDb.allAlbumsData();
+        auto pagedAlbums = DatabaseInterface::ListAlbumDataType{};
+
+        auto albumsPage = musicDb.albumsDataPage({}, 0, 2);
+        while (!albumsPage.isEmpty()) {
+            pagedAlbums.append(albumsPage);
+            albumsPage = musicDb.albumsDataPage(albumsPage.last().title(), albumsPage.last().databaseId(), 2);
+        }
+
+        QCOMPARE(pagedAlbums.count(), allAlbums.count());
+
+        auto allArtists = musicDb.allArtistsData();
+        auto pagedArtists = DatabaseInterface::ListArtistDataType{};
+
+        auto artistsPage = musicDb.artistsDataPage({}, 0, 2);
+        while (!artistsPage.isEmpty()) {
+            pagedArtists.append(artistsPage);
+            artistsPage = musicDb.artistsDataPage(artistsPage.last().title(), artistsPage.last().databaseId(), 2);
+        }
+
+        QCOMPARE(pagedArtists.count(), allArtists.count());
+    }
+
+    void bulkRemoveTracks()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto manyTracks = QList<MusicAudioTrack>{};
+        auto manyTracksUrls = QList<QUrl>{};
+
+        for (int copyIndex = 0; copyIndex < 5; ++copyIndex) {
+            for (auto oneTrack : mNewTracks) {
+                const auto &suffix = QStringLiteral(" copy%1").arg(copyIndex);
+                oneTrack.setTitle(oneTrack.title() + suffix);
+                if (!oneTrack.albumName().isEmpty()) {
+                    oneTrack.setAlbumName(oneTrack.albumName() + suffix);
+                }
+                oneTrack.setResourceURI(QUrl::fromLocalFile(QStringLiteral("/copy%1").arg(copyIndex) + oneTrack.resourceURI().toLocalFile()));
+
+                manyTracks.push_back(oneTrack);
+                manyTracksUrls.push_back(oneTrack.resourceURI());
+            }
+        }
+
+        musicDb.insertTracksList(manyTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QVERIFY(musicDb.allTracksData().count() > 100);
+        QVERIFY(!musicDb.allAlbumsData().isEmpty());
+
+        const auto allTracksCount = musicDb.allTracksData().count();
+
+        musicDb.removeTracksList(manyTracksUrls);
+
+        QCOMPARE(musicDb.allTracksData().count(), 0);
+        QCOMPARE(musicDb.allAlbumsData().count(), 0);
+        QCOMPARE(musicDb.allArtistsData().count(), 0);
+        QCOMPARE(musicDbTracksRemovedSpy.count(), 1);
+        QVERIFY(musicDbTracksRemovedSpy.at(0).at(0).value<QList<qulonglong>>().count() >= allTracksCount);
+        QCOMPARE(musicDbAlbumsRemovedSpy.count(), 1);
+        QCOMPARE(musicDbArtistsRemovedSpy.count(), 1);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void bulkInsertManyTracks()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbGenreAddedSpy(&musicDb, &DatabaseInterface::genresAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto bulkTrack = [](int trackIndex) {
+            const auto albumIndex = trackIndex / 10;
+            const auto fileName = QStringLiteral("/bulk/album%1/$%2").arg(albumIndex).arg(trackIndex);
+
+            return MusicAudioTrack{true, QStringLiteral("$bulk%1").arg(trackIndex), QStringLiteral("0"), QStringLiteral("track%1").arg(trackIndex),
+                        QStringLiteral("bulkArtist%1").arg(trackIndex), QStringLiteral("bulkAlbum%1").arg(albumIndex), QStringLiteral("bulkAlbumArtist%1").arg(albumIndex),
+                        trackIndex % 10 + 1, 1, QTime::fromMSecsSinceStartOfDay(1000 + trackIndex), {QUrl::fromLocalFile(fileName)},
+                        QDateTime::fromMSecsSinceEpoch(trackIndex), {}, 3, false,
+                        QStringLiteral("bulkGenre%1").arg(albumIndex % 7), QStringLiteral("bulkComposer%1").arg(trackIndex),
+                        QStringLiteral("bulkLyricist%1").arg(trackIndex), false};
+        };
+
+        auto firstTracks = QList<MusicAudioTrack>{};
+        for (int trackIndex = 0; trackIndex < 600; ++trackIndex) {
+            firstTracks.push_back(bulkTrack(trackIndex));
+        }
+
+        musicDb.insertTracksList(firstTracks, {});
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbTrackAddedSpy.at(0).at(0).value<DatabaseInterface::ListTrackDataType>().count(), 600);
+        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumAddedSpy.at(0).at(0).value<DatabaseInterface::ListAlbumDataType>().count(), 60);
+        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
+        QCOMPARE(musicDbArtistAddedSpy.at(0).at(0).value<DatabaseInterface::ListArtistDataType>().count(), 660);
+        QCOMPARE(musicDbGenreAddedSpy.count(), 1);
+        QCOMPARE(musicDbGenreAddedSpy.at(0).at(0).value<DatabaseInterface::ListGenreDataType>().count(), 7);
+
+        QCOMPARE(musicDb.allTracksData().count(), 600);
+        QCOMPARE(musicDb.allAlbumsData().count(), 60);
+        QCOMPARE(musicDb.allArtistsData().count(), 660);
+        QCOMPARE(musicDb.allGenresData().count(), 7);
+
+        auto track = musicDb.trackDataFromDatabaseId(musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/bulk/album54/$543"))));
+
+        QCOMPARE(track.isValid(), true);
+        QCOMPARE(track.title(), QStringLiteral("track543"));
+        QCOMPARE(track.artist(), QStringLiteral("bulkArtist543"));
+        QCOMPARE(track.album(), QStringLiteral("bulkAlbum54"));
+        QCOMPARE(track.albumArtist(), QStringLiteral("bulkAlbumArtist54"));
+        QCOMPARE(track.genre(), QStringLiteral("bulkGenre5"));
+        QCOMPARE(track.composer(), QStringLiteral("bulkComposer543"));
+        QCOMPARE(track.lyricist(), QStringLiteral("bulkLyricist543"));
+
+        const auto albumId = musicDb.albumIdFromTitleAndArtist(QStringLiteral("bulkAlbum54"), QStringLiteral("bulkAlbumArtist54"));
+        QVERIFY(albumId != 0);
+        QCOMPARE(musicDb.albumData(albumId).count(), 10);
+
+        auto removedAlbumTracks = QList<QUrl>{};
+        for (int trackIndex = 0; trackIndex < 10; ++trackIndex) {
+            removedAlbumTracks.push_back(firstTracks[trackIndex].resourceURI());
+        }
+
+        musicDb.removeTracksList(removedAlbumTracks);
+
+        QCOMPARE(musicDbArtistsRemovedSpy.count(), 1);
+        QCOMPARE(musicDb.allArtistsData().count(), 649);
+
+        auto secondTracks = QList<MusicAudioTrack>{};
+        for (int trackIndex = 0; trackIndex < 10; ++trackIndex) {
+            secondTracks.push_back(bulkTrack(trackIndex));
+        }
+        for (int trackIndex = 600; trackIndex < 610; ++trackIndex) {
+            auto oneTrack = bulkTrack(trackIndex);
+            oneTrack.setArtist(QStringLiteral("bulkArtist%1").arg(trackIndex - 500));
+            secondTracks.push_back(oneTrack);
+        }
+
+        musicDb.insertTracksList(secondTracks, {});
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbTrackAddedSpy.count(), 2);
+        QCOMPARE(musicDbTrackAddedSpy.at(1).at(0).value<DatabaseInterface::ListTrackDataType>().count(), 20);
+        QCOMPARE(musicDbAlbumAddedSpy.count(), 2);
+        QCOMPARE(musicDbAlbumAddedSpy.at(1).at(0).value<DatabaseInterface::ListAlbumDataType>().count(), 2);
+        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
+        QCOMPARE(musicDbArtistAddedSpy.at(1).at(0).value<DatabaseInterface::ListArtistDataType>().count(), 12);
+        QCOMPARE(musicDbGenreAddedSpy.count(), 1);
+
+        QCOMPARE(musicDb.allTracksData().count(), 610);
+        QCOMPARE(musicDb.allAlbumsData().count(), 61);
+        QCOMPARE(musicDb.allArtistsData().count(), 661);
+
+        auto reinsertedTrack = musicDb.trackDataFromDatabaseId(musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/bulk/album0/$7"))));
+
+        QCOMPARE(reinsertedTrack.artist(), QStringLiteral("bulkArtist7"));
+        QCOMPARE(reinsertedTrack.albumArtist(), QStringLiteral("bulkAlbumArtist0"));
+
+        auto sharedArtistTrack = musicDb.trackDataFromDatabaseId(musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/bulk/album60/$605"))));
+
+        QCOMPARE(sharedArtistTrack.artist(), QStringLiteral("bulkArtist105"));
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void offlineTracksAreHiddenThenRestored()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbTracksRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
+        QSignalSpy musicDbAlbumsAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
+        QSignalSpy musicDbAlbumsRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbArtistsAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbArtistsRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto mountedTracks = QList<MusicAudioTrack>{};
+        auto mountedTracksUrls = QList<QUrl>{};
+
+        for (auto oneTrack : mNewTracks) {
+            oneTrack.setResourceURI(QUrl::fromLocalFile(QStringLiteral("/mnt/share") + oneTrack.resourceURI().toLocalFile()));
+
+            mountedTracks.push_back(oneTrack);
+            mountedTracksUrls.push_back(oneTrack.resourceURI());
+        }
+
+        musicDb.insertTracksList(mountedTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        const auto allTracksCount = musicDb.allTracksData().count();
+        const auto allAlbumsCount = musicDb.allAlbumsData().count();
+        const auto allArtistsCount = musicDb.allArtistsData().count();
+
+        QVERIFY(allTracksCount > 0);
+        QVERIFY(allArtistsCount > 0);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsAddedSpy.count(), 1);
+        QCOMPARE(musicDbArtistsAddedSpy.count(), 1);
+
+        musicDb.setTracksOffline(mountedTracksUrls);
+
+        QCOMPARE(musicDb.allTracksData().count(), 0);
+        QCOMPARE(musicDb.allAlbumsData().count(), 0);
+        QCOMPARE(musicDb.allArtistsData().count(), 0);
+        QCOMPARE(musicDbTracksRemovedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsRemovedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsRemovedSpy.at(0).at(0).value<QList<qulonglong>>().count(), allAlbumsCount);
+        QCOMPARE(musicDbArtistsRemovedSpy.count(), 1);
+        QCOMPARE(musicDbArtistsRemovedSpy.at(0).at(0).value<QList<qulonglong>>().count(), allArtistsCount);
+
+        musicDb.setTracksOffline(mountedTracksUrls);
+
+        QCOMPARE(musicDbTracksRemovedSpy.count(), 1);
+        QCOMPARE(musicDbAlbumsRemovedSpy.count(), 1);
+        QCOMPARE(musicDbArtistsRemovedSpy.count(), 1);
+
+        musicDb.setDirectoryOnline(QUrl::fromLocalFile(QStringLiteral("/mnt/other")));
+
+        QCOMPARE(musicDb.allTracksData().count(), 0);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 1);
+
+        musicDb.setDirectoryOnline(QUrl::fromLocalFile(QStringLiteral("/mnt/share")));
+
+        QCOMPARE(musicDb.allTracksData().count(), allTracksCount);
+        QCOMPARE(musicDb.allAlbumsData().count(), allAlbumsCount);
+        QCOMPARE(musicDb.allArtistsData().count(), allArtistsCount);
+        QCOMPARE(musicDbTrackAddedSpy.count(), 2);
+        QCOMPARE(musicDbAlbumsAddedSpy.count(), 2);
+        QCOMPARE(musicDbAlbumsAddedSpy.at(1).at(0).value<DatabaseInterface::ListAlbumDataType>().count(), allAlbumsCount);
+        QCOMPARE(musicDbArtistsAddedSpy.count(), 2);
+        QCOMPARE(musicDbArtistsAddedSpy.at(1).at(0).value<DatabaseInterface::ListArtistDataType>().count(), allArtistsCount);
+        QCOMPARE(musicDbTrackAddedSpy.at(1).at(0).value<DatabaseInterface::ListTrackDataType>().count(), musicDbTracksRemovedSpy.at(0).at(0).value<QList<qulonglong>>().count());
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void albumSummaryFollowsTracks()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        auto summaryTrack = [](int trackNumber, int discNumber, int duration, int rating, const QString &genre) {
+            return MusicAudioTrack{true, QStringLiteral("$summary%1").arg(trackNumber), QStringLiteral("0"), QStringLiteral("summaryTrack%1").arg(trackNumber),
+                        QStringLiteral("summaryArtist%1").arg(trackNumber), QStringLiteral("summaryAlbum"), QStringLiteral("summaryAlbumArtist"),
+                        trackNumber, discNumber, QTime::fromMSecsSinceStartOfDay(duration),
+                        {QUrl::fromLocalFile(QStringLiteral("/summary/$summary%1").arg(trackNumber))},
+                        QDateTime::fromMSecsSinceEpoch(trackNumber), {}, rating, false,
+                        genre, QStringLiteral("composer1"), QStringLiteral("lyricist1"), false};
+        };
+
+        auto summaryAlbum = [&musicDb]() {
+            const auto &allAlbums = musicDb.allAlbumsData();
+            const auto itAlbum = std::find_if(allAlbums.begin(), allAlbums.end(), [](const auto &oneAlbum) {
+                return oneAlbum.title() == QStringLiteral("summaryAlbum");
+            });
+            return (itAlbum != allAlbums.end() ? *itAlbum : DatabaseInterface::AlbumDataType{});
+        };
+
+        auto albumDuration = [&musicDb](qulonglong albumId) {
+            auto duration = 0;
+            for (const auto &oneTrack : musicDb.albumData(albumId)) {
+                duration += oneTrack.duration().msecsSinceStartOfDay();
+            }
+            return duration;
+        };
+
+        auto toSet = [](const QStringList &values) {
+            return values.toSet();
+        };
+
+        musicDb.insertTracksList({summaryTrack(1, 1, 1000, 2, QStringLiteral("genre1")),
+                                  summaryTrack(2, 1, 2000, 6, QStringLiteral("genre2")),
+                                  summaryTrack(3, 2, 3000, 4, QStringLiteral("genre1"))}, {});
+
+        musicDbTrackAddedSpy.wait(300);
+
+        auto album = summaryAlbum();
+        QCOMPARE(album.isValid(), true);
+
+        const auto albumId = album.databaseId();
+
+        QCOMPARE(musicDb.albumData(albumId).count(), 3);
+        QCOMPARE(albumDuration(albumId), 6000);
+        QCOMPARE(toSet(album.genres()), (QSet<QString>{QStringLiteral("genre1"), QStringLiteral("genre2")}));
+        QCOMPARE(toSet(album[DatabaseInterface::AllArtistsRole].toStringList()),
+                 (QSet<QString>{QStringLiteral("summaryArtist1"), QStringLiteral("summaryArtist2"), QStringLiteral("summaryArtist3")}));
+        QCOMPARE(album[DatabaseInterface::HighestTrackRating].toInt(), 6);
+        QCOMPARE(album.isSingleDiscAlbum(), false);
+
+        musicDb.insertTracksList({summaryTrack(3, 1, 4000, 8, QStringLiteral("genre3"))}, {});
+
+        album = summaryAlbum();
+        QCOMPARE(album.databaseId(), albumId);
+        QCOMPARE(musicDb.albumData(albumId).count(), 3);
+        QCOMPARE(albumDuration(albumId), 7000);
+        QCOMPARE(toSet(album.genres()), (QSet<QString>{QStringLiteral("genre1"), QStringLiteral("genre2"), QStringLiteral("genre3")}));
+        QCOMPARE(album[DatabaseInterface::HighestTrackRating].toInt(), 8);
+        QCOMPARE(album.isSingleDiscAlbum(), true);
+
+        musicDb.removeTracksList({QUrl::fromLocalFile(QStringLiteral("/summary/$summary2"))});
+
+        album = summaryAlbum();
+        QCOMPARE(album.databaseId(), albumId);
+        QCOMPARE(musicDb.albumData(albumId).count(), 2);
+        QCOMPARE(albumDuration(albumId), 5000);
+        QCOMPARE(toSet(album.genres()), (QSet<QString>{QStringLiteral("genre1"), QStringLiteral("genre3")}));
+        QCOMPARE(toSet(album[DatabaseInterface::AllArtistsRole].toStringList()),
+                 (QSet<QString>{QStringLiteral("summaryArtist1"), QStringLiteral("summaryArtist3")}));
+        QCOMPARE(album[DatabaseInterface::HighestTrackRating].toInt(), 8);
+
+        musicDb.setTracksOffline({QUrl::fromLocalFile(QStringLiteral("/summary/$summary3"))});
+
+        album = summaryAlbum();
+        QCOMPARE(album.databaseId(), albumId);
+        QCOMPARE(toSet(album.genres()), (QSet<QString>{QStringLiteral("genre1")}));
+        QCOMPARE(toSet(album[DatabaseInterface::AllArtistsRole].toStringList()), (QSet<QString>{QStringLiteral("summaryArtist1")}));
+        QCOMPARE(album[DatabaseInterface::HighestTrackRating].toInt(), 2);
+
+        musicDb.setTracksOffline({QUrl::fromLocalFile(QStringLiteral("/summary/$summary1"))});
+
+        QCOMPARE(summaryAlbum().isValid(), false);
+
+        musicDb.setDirectoryOnline(QUrl::fromLocalFile(QStringLiteral("/summary")));
+
+        album = summaryAlbum();
+        QCOMPARE(album.databaseId(), albumId);
+        QCOMPARE(toSet(album.genres()), (QSet<QString>{QStringLiteral("genre1"), QStringLiteral("genre3")}));
+        QCOMPARE(album[DatabaseInterface::HighestTrackRating].toInt(), 8);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void collectionSnapshotRoundTrip()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        const auto initialGeneration = musicDb.collectionGeneration();
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QVERIFY(musicDb.collectionGeneration() > initialGeneration);
+
+        QTemporaryFile snapshotFile;
+        snapshotFile.open();
+
+        musicDb.writeCollectionSnapshot(snapshotFile.fileName());
+
+        CollectionSnapshot snapshot;
+
+        QVERIFY(snapshot.load(snapshotFile.fileName()));
+        QVERIFY(snapshot.isValid());
+        QVERIFY(!musicDb.collectionIdentity().isEmpty());
+        QCOMPARE(snapshot.identity(), musicDb.collectionIdentity());
+        QCOMPARE(snapshot.generation(), musicDb.collectionGeneration());
+
+        const auto &allAlbums = musicDb.allAlbumsData();
+        const auto &allTracks = musicDb.allTracksData();
+
+        QCOMPARE(snapshot.allAlbums().count(), allAlbums.count());
+        QCOMPARE(snapshot.allArtists().count(), musicDb.allArtistsData().count());
+        QCOMPARE(snapshot.allGenres().count(), musicDb.allGenresData().count());
+        QCOMPARE(snapshot.allTracks().count(), allTracks.count());
+        QCOMPARE(snapshot.allAlbums().first(), allAlbums.first());
+        QCOMPARE(snapshot.allTracks().first(), allTracks.first());
+
+        musicDb.trackHasStartedPlaying(mNewTracks.first().resourceURI(), QDateTime::currentDateTime());
+        musicDb.flushPlayStatistics();
+
+        QCOMPARE(musicDb.collectionGeneration(), snapshot.generation());
+
+        DatabaseInterface otherMusicDb;
+
+        otherMusicDb.init(QStringLiteral("testDbOther"));
+
+        QVERIFY(!otherMusicDb.collectionIdentity().isEmpty());
+        QVERIFY(otherMusicDb.collectionIdentity() != snapshot.identity());
+
+        musicDb.removeTracksList({mNewTracks.first().resourceURI()});
+
+        QVERIFY(musicDb.collectionGeneration() > snapshot.generation());
+
+        QFile corruptedFile(snapshotFile.fileName());
+        QVERIFY(corruptedFile.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        corruptedFile.write("not a snapshot");
+        corruptedFile.close();
+
+        QVERIFY(!snapshot.load(snapshotFile.fileName()));
+        QVERIFY(!snapshot.isValid());
+        QVERIFY(snapshot.allTracks().isEmpty());
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void albumArtStoreDeduplicatesCovers()
+    {
+        QTemporaryFile packFile;
+        packFile.open();
+
+        QImage cover(800, 600, QImage::Format_RGB32);
+        cover.fill(Qt::red);
+
+        QByteArray coverData;
+        QBuffer coverBuffer(&coverData);
+        coverBuffer.open(QIODevice::WriteOnly);
+        QVERIFY(cover.save(&coverBuffer, "PNG"));
+
+        AlbumArtStore albumArtStore(packFile.fileName());
+
+        const auto &coverKey = albumArtStore.insert(coverData);
+
+        QCOMPARE(coverKey.size(), 40);
+
+        const auto packSize = QFileInfo(packFile.fileName()).size();
+
+        QCOMPARE(albumArtStore.insert(coverData), coverKey);
+        QCOMPARE(QFileInfo(packFile.fileName()).size(), packSize);
+        QVERIFY(albumArtStore.insert(QByteArrayLiteral("not an image")).isEmpty());
+
+        AlbumArtStore otherAlbumArtStore(packFile.fileName());
+
+        QVERIFY(otherAlbumArtStore.contains(coverKey));
+        QCOMPARE(otherAlbumArtStore.image(coverKey, QSize(100, 100)).size(), QSize(256, 192));
+        QCOMPARE(otherAlbumArtStore.image(coverKey, QSize(400, 400)).size(), QSize(512, 384));
+        QCOMPARE(otherAlbumArtStore.image(coverKey, QSize(2000, 2000)).size(), QSize(512, 384));
+        QVERIFY(otherAlbumArtStore.image(QString(40, QLatin1Char('0')), QSize(100, 100)).isNull());
+    }
+
+    void lyricsStoredAtImport()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        const auto &shortLyrics = QStringLiteral("short lyrics");
+        const auto &longLyrics = QStringLiteral("la la la\n").repeated(500);
+
+        auto tracksWithLyrics = mNewTracks;
+        tracksWithLyrics[0].setLyrics(shortLyrics);
+        tracksWithLyrics[1].setLyrics(longLyrics);
+
+        musicDb.insertTracksList(tracksWithLyrics, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        auto lyrics = QString{};
+
+        QVERIFY(musicDb.trackLyricsFromDatabaseId(musicDb.trackIdFromFileName(tracksWithLyrics[0].resourceURI()), lyrics));
+        QCOMPARE(lyrics, shortLyrics);
+
+        QVERIFY(musicDb.trackLyricsFromDatabaseId(musicDb.trackIdFromFileName(tracksWithLyrics[1].resourceURI()), lyrics));
+        QCOMPARE(lyrics, longLyrics);
+
+        lyrics.clear();
+        QVERIFY(musicDb.trackLyricsFromDatabaseId(musicDb.trackIdFromFileName(tracksWithLyrics[2].resourceURI()), lyrics));
+        QVERIFY(lyrics.isEmpty());
+
+        QVERIFY(!musicDb.trackLyricsFromDatabaseId(0, lyrics));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void nameDictionariesAfterReload()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        {
+            DatabaseInterface musicDb;
+
+            QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+            musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+            musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+            musicDbTrackAddedSpy.wait(300);
+
+            QCOMPARE(musicDb.allArtistsData().count(), 7);
+            QCOMPARE(musicDb.allGenresData().count(), 4);
+        }
+
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.init(QStringLiteral("testDbReloaded"), databaseFile.fileName());
+
+        const auto &allGenres = musicDb.allGenresData();
+        QCOMPARE(allGenres.count(), 4);
+        QCOMPARE(allGenres[0].title(), QStringLiteral("genre1"));
+        QCOMPARE(allGenres[3].title(), QStringLiteral("genre4"));
+
+        musicDb.removeTracksList({mNewTracks.first().resourceURI()});
+        musicDb.insertTracksList({mNewTracks.first()}, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDb.allTracksData().count(), 22);
+        QCOMPARE(musicDb.allArtistsData().count(), 7);
+        QCOMPARE(musicDb.allGenresData().count(), 4);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void readOnlyDatabaseSeesCommittedData()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.init(QStringLiteral("testDbWriter"), databaseFile.fileName());
+
+        {
+            QSqlQuery journalModeQuery(QSqlDatabase::database(QStringLiteral("testDbWriter")));
+
+            QVERIFY(journalModeQuery.exec(QStringLiteral("PRAGMA journal_mode")));
+            QVERIFY(journalModeQuery.next());
+            QCOMPARE(journalModeQuery.value(0).toString().toLower(), QStringLiteral("wal"));
+        }
+
+        DatabaseInterface readOnlyDb;
+
+        QSignalSpy readOnlyDbDatabaseErrorSpy(&readOnlyDb, &DatabaseInterface::databaseError);
+
+        readOnlyDb.sharePlayStatisticsJournal(musicDb);
+        readOnlyDb.initReadOnly(QStringLiteral("testDbReader"), databaseFile.fileName());
+
+        QCOMPARE(readOnlyDb.allTracksData().count(), 0);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(readOnlyDb.allTracksData().count(), 22);
+        QCOMPARE(readOnlyDb.allAlbumsData().count(), 5);
+        QCOMPARE(readOnlyDb.allArtistsData().count(), 7);
+        QCOMPARE(readOnlyDb.allGenresData().count(), 4);
+
+        const auto trackId = musicDb.trackIdFromFileName(mNewTracks.first().resourceURI());
+        QVERIFY(trackId != 0);
+        QCOMPARE(readOnlyDb.trackDataFromDatabaseId(trackId).title(), mNewTracks.first().title());
+
+        const auto playedTrackUrl = mNewTracks[1].resourceURI();
+        const auto playedTrackId = musicDb.trackIdFromFileName(playedTrackUrl);
+        const auto initialPlayCounter = readOnlyDb.trackDataFromDatabaseId(playedTrackId).playCounter();
+
+        musicDb.trackHasStartedPlaying(playedTrackUrl, QDateTime::currentDateTime().addYears(1));
+
+        auto recentlyPlayedTracks = readOnlyDb.recentlyPlayedTracksData(10);
+        QVERIFY(!recentlyPlayedTracks.isEmpty());
+        QCOMPARE(recentlyPlayedTracks.first().resourceURI(), playedTrackUrl);
+        QCOMPARE(recentlyPlayedTracks.first().playCounter(), initialPlayCounter + 1);
+
+        musicDb.flushPlayStatistics();
+
+        recentlyPlayedTracks = readOnlyDb.recentlyPlayedTracksData(10);
+        QVERIFY(!recentlyPlayedTracks.isEmpty());
+        QCOMPARE(recentlyPlayedTracks.first().resourceURI(), playedTrackUrl);
+        QCOMPARE(recentlyPlayedTracks.first().playCounter(), initialPlayCounter + 1);
+
+        const auto frequentlyPlayedTracks = readOnlyDb.frequentlyPlayedTracksData(50);
+        const auto frequentlyPlayedCount = std::count_if(frequentlyPlayedTracks.begin(), frequentlyPlayedTracks.end(),
+                                                         [&playedTrackUrl](const DatabaseInterface::TrackDataType &oneTrack) {
+            return oneTrack.resourceURI() == playedTrackUrl;
+        });
+        QCOMPARE(static_cast<int>(frequentlyPlayedCount), 1);
+
+        musicDb.removeTracksList({mNewTracks.first().resourceURI()});
+
+        QCOMPARE(readOnlyDb.allTracksData().count(), 21);
+        QCOMPARE(readOnlyDb.trackDataFromDatabaseId(trackId).isValid(), false);
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(readOnlyDbDatabaseErrorSpy.count(), 0);
+    }
+
+    void statementStatistics()
+    {
+        QLoggingCategory::setFilterRules(QStringLiteral("org.kde.elisa.database.profiler.debug=true"));
+
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QVERIFY(!musicDb.allTracksData().isEmpty());
+
+        const auto &allStatistics = musicDb.statementStatistics();
+
+        QLoggingCategory::setFilterRules(QStringLiteral("org.kde.elisa.database.profiler.debug=false"));
+
+        QVERIFY(allStatistics.count() > 1);
+        QVERIFY(allStatistics.first().endsWith(QStringLiteral("-- transactions")));
+        QVERIFY(std::any_of(allStatistics.begin(), allStatistics.end(), [](const auto &oneStatistics) {
+            return oneStatistics.contains(QStringLiteral("INSERT INTO `Tracks`"));
+        }));
+    }
+
+    void searchAccessors()
+    {
+        DatabaseInterface musicDb;
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        if (!musicDb.hasSearchIndex()) {
+            QSKIP("SQLite is built without FTS5");
+        }
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        const auto &allTracks = musicDb.allTracksData();
+
+        const auto &foundTracks = musicDb.searchTracks(QStringLiteral("TRACK1"));
+        QVERIFY(!foundTracks.isEmpty());
+
+        for (const auto &oneTrack : allTracks) {
+            if (oneTrack.title() == QStringLiteral("track1")) {
+                QVERIFY(foundTracks.contains(oneTrack.databaseId()));
+            }
+        }
+
+        for (auto oneTrackId : foundTracks) {
+            QVERIFY(musicDb.trackDataFromDatabaseId(oneTrackId).title().startsWith(QStringLiteral("track1")));
+        }
+
+        QCOMPARE(musicDb.searchTracks(QStringLiteral("  ")).count(), 0);
+        QCOMPARE(musicDb.searchTracks(QStringLiteral("\"")).count(), 0);
+
+        const auto &foundAlbums = musicDb.searchAlbums(QStringLiteral("album1"));
+        QVERIFY(!foundAlbums.isEmpty());
+
+        for (auto oneAlbumId : foundAlbums) {
+            QCOMPARE(musicDb.albumDataFromDatabaseId(oneAlbumId).title(), QStringLiteral("album1"));
+        }
+
+        QVERIFY(!musicDb.searchArtists(QStringLiteral("artist")).isEmpty());
+
+        const auto &removedTrack = allTracks.first();
+        musicDb.removeTracksList({removedTrack.resourceURI()});
+
+        QVERIFY(!musicDb.searchTracks(removedTrack.title()).contains(removedTrack.databaseId()));
+    }
+
     void simpleAccessorAndVariousArtistAlbum()
     {
         DatabaseInterface musicDb;
@@ -2021,9 +2748,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2137,9 +2864,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2238,7 +2965,7 @@ private Q_SLOTS:
                                                                            QStringLiteral("album1"), 1, 1);
         QCOMPARE(removedTrackId, qulonglong(0));
 
-        firstTrack[DatabaseInterface::DatabaseIdRole] = 0;
+        firstTrack.setDatabaseId(0);
 
         musicDb.insertTracksList({MusicAudioTrack::trackFromData(firstTrack)}, mNewCovers);
 
@@ -2293,9 +3020,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2376,7 +3103,8 @@ private Q_SLOTS:
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
         QCOMPARE(musicDbArtistRemovedSpy.count(), 1);
         QCOMPARE(musicDbAlbumRemovedSpy.count(), 1);
-        QCOMPARE(musicDbTrackRemovedSpy.count(), 6);
+        QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
+        QCOMPARE(musicDbTrackRemovedSpy.at(0).at(0).value<QList<qulonglong>>().count(), 6);
         QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
@@ -2395,9 +3123,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2477,9 +3205,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2558,9 +3286,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2749,9 +3477,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -2940,9 +3668,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3142,9 +3870,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3266,9 +3994,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3345,9 +4073,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3425,9 +4153,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3524,9 +4252,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy2(&musicDb2, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy2(&musicDb2, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy2(&musicDb2, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy2(&musicDb2, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy2(&musicDb2, &DatabaseInterface::databaseError);
@@ -3594,9 +4322,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3693,9 +4421,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3805,9 +4533,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -3946,9 +4674,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4043,9 +4771,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4150,9 +4878,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4371,9 +5099,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4446,9 +5174,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4509,6 +5237,46 @@ private Q_SLOTS:
         QCOMPARE(restoredTracks.count(), 23);
     }
 
+    void checkRestoredDirectories()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+        QSignalSpy musicDbRestoredDirectoriesSpy(&musicDb, &DatabaseInterface::restoredDirectories);
+
+        const auto modifiedTime = QDateTime::fromMSecsSinceEpoch(23);
+
+        auto indexedDirectories = DatabaseInterface::DirectoriesDataType{};
+        indexedDirectories[QUrl::fromLocalFile(QStringLiteral("/music"))] = {modifiedTime, 2};
+        indexedDirectories[QUrl::fromLocalFile(QStringLiteral("/music/album1"))] = {modifiedTime, 12};
+        indexedDirectories[QUrl::fromLocalFile(QStringLiteral("/music/album2"))] = {modifiedTime, 5};
+        indexedDirectories[QUrl::fromLocalFile(QStringLiteral("/music/album2/cd1"))] = {modifiedTime, 7};
+
+        musicDb.updateDirectoriesIndex(indexedDirectories, {});
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        musicDb.updateDirectoriesIndex({}, {QUrl::fromLocalFile(QStringLiteral("/music/album2"))});
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        musicDb.askRestoredTracks();
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(musicDbRestoredDirectoriesSpy.count(), 1);
+
+        const auto &restoredDirectories = musicDbRestoredDirectoriesSpy.at(0).at(0).value<DatabaseInterface::DirectoriesDataType>();
+        QCOMPARE(restoredDirectories.count(), 2);
+        QCOMPARE(restoredDirectories.contains(QUrl::fromLocalFile(QStringLiteral("/music/album2"))), false);
+        QCOMPARE(restoredDirectories.contains(QUrl::fromLocalFile(QStringLiteral("/music/album2/cd1"))), false);
+
+        const auto &oneDirectory = restoredDirectories[QUrl::fromLocalFile(QStringLiteral("/music/album1"))];
+        QCOMPARE(oneDirectory.mModifiedTime, modifiedTime);
+        QCOMPARE(oneDirectory.mEntriesCount, 12);
+    }
+
     void addOneTrackWithParticularPath()
     {
         DatabaseInterface musicDb;
@@ -4518,9 +5286,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4577,9 +5345,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4662,9 +5430,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4725,6 +5493,45 @@ private Q_SLOTS:
         QCOMPARE(frequentlyPlayedTracksData[4].resourceURI(), QUrl::fromLocalFile(QStringLiteral("/$9")));
     }
 
+    void writeBehindPlayStatistics()
+    {
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
+        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        musicDbTrackAddedSpy.wait(300);
+
+        auto trackId = musicDb.trackIdFromFileName(QUrl::fromLocalFile(QStringLiteral("/$2")));
+        QVERIFY(trackId != 0);
+
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$2")), QDateTime::fromSecsSinceEpoch(1553285650));
+        musicDb.trackHasStartedPlaying(QUrl::fromLocalFile(QStringLiteral("/$2")), QDateTime::fromSecsSinceEpoch(1553289680));
+
+        QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
+
+        auto modifiedTrack = musicDbTrackModifiedSpy.at(1).at(0).value<DatabaseInterface::TrackDataType>();
+        QCOMPARE(modifiedTrack.playCounter(), 2);
+        QCOMPARE(modifiedTrack.firstPlayDate(), QDateTime::fromSecsSinceEpoch(1553285650));
+        QCOMPARE(modifiedTrack.lastPlayDate(), QDateTime::fromSecsSinceEpoch(1553289680));
+
+        QCOMPARE(musicDb.trackDataFromDatabaseId(trackId).playCounter(), 0);
+
+        musicDb.flushPlayStatistics();
+
+        const auto &storedTrack = musicDb.trackDataFromDatabaseId(trackId);
+        QCOMPARE(storedTrack.playCounter(), 2);
+        QCOMPARE(storedTrack.firstPlayDate(), QDateTime::fromSecsSinceEpoch(1553285650));
+        QCOMPARE(storedTrack.lastPlayDate(), QDateTime::fromSecsSinceEpoch(1553289680));
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+    }
+
     void readAllGenresData()
     {
         DatabaseInterface musicDb;
@@ -4734,9 +5541,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4789,9 +5596,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4861,9 +5668,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -4896,9 +5703,9 @@ private Q_SLOTS:
         QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
         QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::tracksAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
-        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::tracksRemoved);
         QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
@@ -60,8 +60,8 @@ private Q_SLOTS:
 
         connect(&musicDb, &DatabaseInterface::tracksAdded,
                 &albumsModel, &DataModel::tracksAdded);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &albumsModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &albumsModel, &DataModel::tracksRemoved);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &albumsModel, &DataModel::trackModified);
 
@@ -127,8 +127,8 @@ private Q_SLOTS:
 
         connect(&musicDb, &DatabaseInterface::tracksAdded,
                 &albumsModel, &DataModel::tracksAdded);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &albumsModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &albumsModel, &DataModel::tracksRemoved);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &albumsModel, &DataModel::trackModified);
 
@@ -202,8 +202,8 @@ private Q_SLOTS:
 
         connect(&musicDb, &DatabaseInterface::tracksAdded,
                 &albumsModel, &DataModel::tracksAdded);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &albumsModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &albumsModel, &DataModel::tracksRemoved);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &albumsModel, &DataModel::trackModified);
 
@@ -318,8 +318,8 @@ private Q_SLOTS:
 
         connect(&musicDb, &DatabaseInterface::tracksAdded,
                 &albumsModel, &DataModel::tracksAdded);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &albumsModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &albumsModel, &DataModel::tracksRemoved);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &albumsModel, &DataModel::trackModified);
 
@@ -403,8 +403,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -454,6 +454,63 @@ private Q_SLOTS:
         QCOMPARE(tracksModel.rowCount(), 22);
     }
 
+    void removeSeveralTracksAllTracks()
+    {
+        DatabaseInterface musicDb;
+        DataModel tracksModel;
+        QAbstractItemModelTester testModel(&tracksModel);
+
+        connect(&musicDb, &DatabaseInterface::tracksAdded,
+                &tracksModel, &DataModel::tracksAdded);
+        connect(&musicDb, &DatabaseInterface::tracksModified,
+                &tracksModel, &DataModel::tracksModified);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy beginRemoveRowsSpy(&tracksModel, &DataModel::rowsAboutToBeRemoved);
+        QSignalSpy endRemoveRowsSpy(&tracksModel, &DataModel::rowsRemoved);
+
+        tracksModel.initialize(nullptr, nullptr, ElisaUtils::Track);
+
+        musicDb.insertTracksList(mNewTracks, mNewCovers);
+
+        QCOMPARE(tracksModel.rowCount(), 23);
+
+        auto firstTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
+                                                                         QStringLiteral("album1"), 1, 1);
+        auto secondTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist2"),
+                                                                          QStringLiteral("album1"), 2, 2);
+        auto thirdTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
+                                                                         QStringLiteral("album2"), 1, 1);
+
+        auto firstTrack = musicDb.trackDataFromDatabaseId(firstTrackId);
+        auto secondTrack = musicDb.trackDataFromDatabaseId(secondTrackId);
+        auto thirdTrack = musicDb.trackDataFromDatabaseId(thirdTrackId);
+
+        musicDb.removeTracksList({firstTrack.resourceURI(), secondTrack.resourceURI()});
+
+        QVERIFY(beginRemoveRowsSpy.count() >= 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), endRemoveRowsSpy.count());
+        QCOMPARE(tracksModel.rowCount(), 21);
+
+        tracksModel.tracksRemoved({firstTrackId, secondTrackId});
+
+        QCOMPARE(tracksModel.rowCount(), 21);
+
+        musicDb.removeTracksList({thirdTrack.resourceURI()});
+
+        QCOMPARE(tracksModel.rowCount(), 20);
+
+        for (int row = 0; row < tracksModel.rowCount(); ++row) {
+            auto oneTrackId = tracksModel.data(tracksModel.index(row, 0), DatabaseInterface::DatabaseIdRole).toULongLong();
+            QVERIFY(oneTrackId != firstTrackId);
+            QVERIFY(oneTrackId != secondTrackId);
+            QVERIFY(oneTrackId != thirdTrackId);
+        }
+    }
+
     void removeOneAlbumAllTracks()
     {
         DatabaseInterface musicDb;
@@ -464,8 +521,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -532,8 +589,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -597,8 +654,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -677,8 +734,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -781,8 +838,8 @@ private Q_SLOTS:
                 &tracksModel, &DataModel::tracksAdded);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &tracksModel, &DataModel::trackModified);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &tracksModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &tracksModel, &DataModel::tracksRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -847,8 +904,8 @@ private Q_SLOTS:
                 &albumsModel, &DataModel::albumsAdded);
         connect(&musicDb, &DatabaseInterface::albumModified,
                 &albumsModel, &DataModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &DataModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &DataModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -907,8 +964,8 @@ private Q_SLOTS:
                 &albumsModel, &DataModel::albumsAdded);
         connect(&musicDb, &DatabaseInterface::albumModified,
                 &albumsModel, &DataModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &DataModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &DataModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -974,8 +1031,8 @@ private Q_SLOTS:
                 &albumsModel, &DataModel::albumsAdded);
         connect(&musicDb, &DatabaseInterface::albumModified,
                 &albumsModel, &DataModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &DataModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &DataModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -1035,8 +1092,8 @@ private Q_SLOTS:
                 &albumsModel, &DataModel::albumsAdded);
         connect(&musicDb, &DatabaseInterface::albumModified,
                 &albumsModel, &DataModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &DataModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &DataModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -1499,8 +1556,8 @@ private Q_SLOTS:
 
         connect(&musicDb, &DatabaseInterface::tracksAdded,
                 &albumsModel, &DataModel::tracksAdded);
-        connect(&musicDb, &DatabaseInterface::trackRemoved,
-                &albumsModel, &DataModel::trackRemoved);
+        connect(&musicDb, &DatabaseInterface::tracksRemoved,
+                &albumsModel, &DataModel::tracksRemoved);
         connect(&musicDb, &DatabaseInterface::trackModified,
                 &albumsModel, &DataModel::trackModified);
 
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "embeddedcovercache.h"
+
+#include <QObject>
+#include <QString>
+#include <QImage>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDateTime>
+#include <QTemporaryDir>
+
+#include <QtTest>
+
+class EmbeddedCoverCacheTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    EmbeddedCoverCacheTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private:
+
+    static QString createAudioFile(const QTemporaryDir &directory, const QString &fileName)
+    {
+        const auto &filePath = directory.filePath(fileName);
+
+        QFile audioFile(filePath);
+        audioFile.open(QIODevice::WriteOnly);
+        audioFile.write("audio");
+
+        return filePath;
+    }
+
+    static QImage cover()
+    {
+        QImage coverImage(64, 64, QImage::Format_RGB32);
+        coverImage.fill(Qt::blue);
+
+        return coverImage;
+    }
+
+private Q_SLOTS:
+
+    void memoryHit()
+    {
+        QTemporaryDir cacheDirectory;
+        QTemporaryDir musicDirectory;
+
+        const auto &audioFileName = createAudioFile(musicDirectory, QStringLiteral("a.mp3"));
+        const auto &modificationTime = QFileInfo(audioFileName).lastModified();
+
+        EmbeddedCoverCache cache(cacheDirectory.path());
+
+        QVERIFY(cache.memoryLookup(audioFileName, modificationTime, 64).isNull());
+
+        cache.memoryInsert(audioFileName, modificationTime, 64, cover());
+
+        QCOMPARE(cache.memoryLookup(audioFileName, modificationTime, 64).size(), QSize(64, 64));
+        QVERIFY(cache.memoryLookup(audioFileName, modificationTime, 128).isNull());
+        QVERIFY(cache.memoryLookup(audioFileName, modificationTime.addSecs(1), 64).isNull());
+        QCOMPARE(cache.diskSize(), qint64(0));
+    }
+
+    void diskHitFromAnotherSession()
+    {
+        QTemporaryDir cacheDirectory;
+        QTemporaryDir musicDirectory;
+
+        const auto &audioFileName = createAudioFile(musicDirectory, QStringLiteral("a.mp3"));
+        const auto &modificationTime = QFileInfo(audioFileName).lastModified();
+
+        {
+            EmbeddedCoverCache cache(cacheDirectory.path());
+
+            cache.diskInsert(audioFileName, modificationTime, 64, cover());
+
+            QVERIFY(cache.diskSize() > 0);
+        }
+
+        EmbeddedCoverCache cache(cacheDirectory.path());
+
+        QVERIFY(cache.memoryLookup(audioFileName, modificationTime, 64).isNull());
+        QCOMPARE(cache.diskLookup(audioFileName, modificationTime, 64).size(), QSize(64, 64));
+        QVERIFY(cache.diskLookup(audioFileName, modificationTime, 128).isNull());
+    }
+
+    void removedAndModifiedFilesArePruned()
+    {
+        QTemporaryDir cacheDirectory;
+        QTemporaryDir musicDirectory;
+
+        const auto &removedFileName = createAudioFile(musicDirectory, QStringLiteral("removed.mp3"));
+        const auto &modifiedFileName = createAudioFile(musicDirectory, QStringLiteral("modified.mp3"));
+        const auto &removedFileTime = QFileInfo(removedFileName).lastModified();
+        const auto &modifiedFileTime = QFileInfo(modifiedFileName).lastModified();
+
+        {
+            EmbeddedCoverCache cache(cacheDirectory.path());
+
+            cache.diskInsert(removedFileName, removedFileTime, 64, cover());
+            cache.diskInsert(modifiedFileName, modifiedFileTime, 64, cover());
+
+            QVERIFY(cache.diskSize() > 0);
+        }
+
+        QVERIFY(QFile::remove(removedFileName));
+
+        {
+            QFile modifiedFile(modifiedFileName);
+            QVERIFY(modifiedFile.open(QIODevice::ReadWrite));
+            QVERIFY(modifiedFile.setFileTime(modifiedFileTime.addSecs(60), QFileDevice::FileModificationTime));
+        }
+
+        EmbeddedCoverCache cache(cacheDirectory.path());
+
+        QCOMPARE(cache.diskSize(), qint64(0));
+        QVERIFY(cache.diskLookup(removedFileName, removedFileTime, 64).isNull());
+        QVERIFY(cache.diskLookup(modifiedFileName, modifiedFileTime, 64).isNull());
+        QVERIFY(QDir(cacheDirectory.path()).entryList(QDir::Dirs | QDir::NoDotAndDotDot).isEmpty());
+    }
+
+    void leastRecentlyUsedEntriesAreEvicted()
+    {
+        QTemporaryDir cacheDirectory;
+        QTemporaryDir musicDirectory;
+
+        const auto &firstFileName = createAudioFile(musicDirectory, QStringLiteral("first.mp3"));
+        const auto &secondFileName = createAudioFile(musicDirectory, QStringLiteral("second.mp3"));
+        const auto &thirdFileName = createAudioFile(musicDirectory, QStringLiteral("third.mp3"));
+        const auto &modificationTime = QFileInfo(firstFileName).lastModified();
+
+        auto entrySize = qint64(0);
+        {
+            QTemporaryDir measureDirectory;
+            EmbeddedCoverCache measureCache(measureDirectory.path());
+            measureCache.diskInsert(firstFileName, modificationTime, 64, cover());
+            entrySize = measureCache.diskSize();
+        }
+
+        QVERIFY(entrySize > 0);
+
+        EmbeddedCoverCache cache(cacheDirectory.path(), entrySize * 2 + entrySize / 2);
+
+        cache.diskInsert(firstFileName, QFileInfo(firstFileName).lastModified(), 64, cover());
+        cache.diskInsert(secondFileName, QFileInfo(secondFileName).lastModified(), 64, cover());
+
+        QVERIFY(!cache.diskLookup(firstFileName, QFileInfo(firstFileName).lastModified(), 64).isNull());
+
+        cache.diskInsert(thirdFileName, QFileInfo(thirdFileName).lastModified(), 64, cover());
+
+        QCOMPARE(cache.diskSize(), entrySize * 2);
+        QVERIFY(!cache.diskLookup(firstFileName, QFileInfo(firstFileName).lastModified(), 64).isNull());
+        QVERIFY(cache.diskLookup(secondFileName, QFileInfo(secondFileName).lastModified(), 64).isNull());
+        QVERIFY(!cache.diskLookup(thirdFileName, QFileInfo(thirdFileName).lastModified(), 64).isNull());
+    }
+
+};
+
+QTEST_GUILESS_MAIN(EmbeddedCoverCacheTests)
+
+
+#include "embeddedcovercachetest.moc"
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "filescanner.h"
+
+#include "config-upnp-qt.h"
+
+#include <QObject>
+#include <QString>
+#include <QByteArray>
+#include <QFileInfo>
+
+#include <QtTest>
+
+class FileScannerTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    FileScannerTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private:
+
+    static QString coverFile(const QString &fileName)
+    {
+        return QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/covers/") + fileName;
+    }
+
+    static QByteArray expectedCover()
+    {
+        return QByteArrayLiteral("\xff\xd8\xff\xe0" "ElisaTestCover" "\xff\xd9");
+    }
+
+private Q_SLOTS:
+
+    void frontCoverFound_data()
+    {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<QString>("mimeType");
+
+        QTest::newRow("id3v2.2") << QStringLiteral("id3v22-front-cover.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("id3v2.3") << QStringLiteral("id3v23-front-cover.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("id3v2.3 extended header") << QStringLiteral("id3v23-extended-header.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("id3v2.4 extended header") << QStringLiteral("id3v24-extended-header.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("flac picture") << QStringLiteral("flac-front-cover.flac") << QStringLiteral("audio/flac");
+        QTest::newRow("mp4 covr") << QStringLiteral("mp4-front-cover.m4a") << QStringLiteral("audio/mp4");
+    }
+
+    void frontCoverFound()
+    {
+        QFETCH(QString, fileName);
+        QFETCH(QString, mimeType);
+
+        FileScanner scanner;
+
+        const auto &frontCover = scanner.locateFrontCover(coverFile(fileName), mimeType);
+
+        QVERIFY(frontCover.isValid());
+        QVERIFY(frontCover.hasLocation());
+        QCOMPARE(frontCover.mSize, qint64(expectedCover().size()));
+        QCOMPARE(scanner.readFrontCover(coverFile(fileName), mimeType), expectedCover());
+    }
+
+    void noFrontCover_data()
+    {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<QString>("mimeType");
+
+        QTest::newRow("id3v2.3 without picture") << QStringLiteral("id3v23-no-cover.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("id3v2.3 back cover only") << QStringLiteral("id3v23-back-cover.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("flac without picture") << QStringLiteral("flac-no-cover.flac") << QStringLiteral("audio/flac");
+        QTest::newRow("mp4 without covr") << QStringLiteral("mp4-no-cover.m4a") << QStringLiteral("audio/mp4");
+        QTest::newRow("mp4 atom shorter than its header") << QStringLiteral("mp4-malformed.m4a") << QStringLiteral("audio/mp4");
+    }
+
+    void noFrontCover()
+    {
+        QFETCH(QString, fileName);
+        QFETCH(QString, mimeType);
+
+        FileScanner scanner;
+
+        QVERIFY(!scanner.locateFrontCover(coverFile(fileName), mimeType).isValid());
+        QVERIFY(scanner.readFrontCover(coverFile(fileName), mimeType).isEmpty());
+    }
+
+    void frontCoverWithoutDirectLocation_data()
+    {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<QString>("mimeType");
+
+        QTest::newRow("id3v2.3 unsynchronised") << QStringLiteral("id3v23-unsynchronised.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("id3v2.3 truncated picture") << QStringLiteral("id3v23-truncated.mp3") << QStringLiteral("audio/mpeg");
+        QTest::newRow("flac truncated picture") << QStringLiteral("flac-truncated.flac") << QStringLiteral("audio/flac");
+    }
+
+    void frontCoverWithoutDirectLocation()
+    {
+        QFETCH(QString, fileName);
+        QFETCH(QString, mimeType);
+
+        FileScanner scanner;
+
+        const auto &frontCover = scanner.locateFrontCover(coverFile(fileName), mimeType);
+
+        QVERIFY(!frontCover.hasLocation());
+        QVERIFY(scanner.readFrontCover(coverFile(fileName), mimeType).size() <= QFileInfo(coverFile(fileName)).size());
+    }
+
+};
+
+QTEST_GUILESS_MAIN(FileScannerTests)
+
+
+#include "filescannertest.moc"
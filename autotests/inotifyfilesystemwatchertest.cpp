@@ -0,0 +1,164 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "abstractfile/inotifyfilesystemwatcher.h"
+
+#include <QObject>
+#include <QString>
+#include <QFile>
+#include <QDir>
+#include <QTemporaryDir>
+
+#include <QtTest>
+
+class InotifyFileSystemWatcherTests: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void watchOnlyDirectories()
+    {
+        QTemporaryDir workingDirectory;
+        QVERIFY(workingDirectory.isValid());
+
+        QFile oneFile(workingDirectory.filePath(QStringLiteral("test.ogg")));
+        QVERIFY(oneFile.open(QIODevice::WriteOnly));
+        oneFile.close();
+
+        InotifyFileSystemWatcher watcher;
+        QVERIFY(watcher.isValid());
+
+        QCOMPARE(watcher.addPath(workingDirectory.path()), true);
+        QCOMPARE(watcher.addPath(workingDirectory.path()), true);
+        QCOMPARE(watcher.addPath(oneFile.fileName()), false);
+        QCOMPARE(watcher.directories(), QStringList{workingDirectory.path()});
+
+        QCOMPARE(watcher.removePath(workingDirectory.path()), true);
+        QCOMPARE(watcher.directories().isEmpty(), true);
+    }
+
+    void coalesceCreateAndWriteOfNewFile()
+    {
+        QTemporaryDir workingDirectory;
+        QVERIFY(workingDirectory.isValid());
+
+        InotifyFileSystemWatcher watcher;
+        QVERIFY(watcher.isValid());
+
+        QSignalSpy directoryChangedSpy(&watcher, &InotifyFileSystemWatcher::directoryChanged);
+        QSignalSpy fileChangedSpy(&watcher, &InotifyFileSystemWatcher::fileChanged);
+
+        QCOMPARE(watcher.addPath(workingDirectory.path()), true);
+
+        QFile newFile(workingDirectory.filePath(QStringLiteral("test.ogg")));
+        QVERIFY(newFile.open(QIODevice::WriteOnly));
+        newFile.write("test");
+        newFile.close();
+
+        QCOMPARE(directoryChangedSpy.wait(), true);
+        QCOMPARE(directoryChangedSpy.count(), 1);
+        QCOMPARE(directoryChangedSpy.at(0).at(0).toString(), workingDirectory.path());
+        QCOMPARE(fileChangedSpy.count(), 0);
+    }
+
+    void reportModifiedFile()
+    {
+        QTemporaryDir workingDirectory;
+        QVERIFY(workingDirectory.isValid());
+
+        QFile oneFile(workingDirectory.filePath(QStringLiteral("test.ogg")));
+        QVERIFY(oneFile.open(QIODevice::WriteOnly));
+        oneFile.close();
+
+        InotifyFileSystemWatcher watcher;
+        QVERIFY(watcher.isValid());
+
+        QSignalSpy directoryChangedSpy(&watcher, &InotifyFileSystemWatcher::directoryChanged);
+        QSignalSpy fileChangedSpy(&watcher, &InotifyFileSystemWatcher::fileChanged);
+
+        QCOMPARE(watcher.addPath(workingDirectory.path()), true);
+
+        QVERIFY(oneFile.open(QIODevice::Append));
+        oneFile.write("test");
+        oneFile.close();
+
+        QCOMPARE(fileChangedSpy.wait(), true);
+        QCOMPARE(fileChangedSpy.count(), 1);
+        QCOMPARE(fileChangedSpy.at(0).at(0).toString(), oneFile.fileName());
+        QCOMPARE(directoryChangedSpy.count(), 0);
+    }
+
+    void followMovedDirectory()
+    {
+        QTemporaryDir workingDirectory;
+        QVERIFY(workingDirectory.isValid());
+
+        QDir rootDirectory(workingDirectory.path());
+        QVERIFY(rootDirectory.mkdir(QStringLiteral("album")));
+
+        InotifyFileSystemWatcher watcher;
+        QVERIFY(watcher.isValid());
+
+        QSignalSpy directoryChangedSpy(&watcher, &InotifyFileSystemWatcher::directoryChanged);
+
+        QCOMPARE(watcher.addPath(workingDirectory.path()), true);
+        QCOMPARE(watcher.addPath(rootDirectory.filePath(QStringLiteral("album"))), true);
+
+        QVERIFY(rootDirectory.rename(QStringLiteral("album"), QStringLiteral("renamedAlbum")));
+
+        QCOMPARE(directoryChangedSpy.wait(), true);
+        QCOMPARE(directoryChangedSpy.count(), 1);
+        QCOMPARE(watcher.isWatched(rootDirectory.filePath(QStringLiteral("album"))), false);
+        QCOMPARE(watcher.isWatched(rootDirectory.filePath(QStringLiteral("renamedAlbum"))), true);
+    }
+
+    void reportRemovedRootDirectory()
+    {
+        QTemporaryDir workingDirectory;
+        QVERIFY(workingDirectory.isValid());
+
+        QDir rootDirectory(workingDirectory.path());
+        QVERIFY(rootDirectory.mkpath(QStringLiteral("music/album")));
+
+        const auto musicDirectoryName = rootDirectory.filePath(QStringLiteral("music"));
+        const auto albumDirectoryName = rootDirectory.filePath(QStringLiteral("music/album"));
+
+        InotifyFileSystemWatcher watcher;
+        QVERIFY(watcher.isValid());
+
+        QSignalSpy watchedDirectoryRemovedSpy(&watcher, &InotifyFileSystemWatcher::watchedDirectoryRemoved);
+
+        QCOMPARE(watcher.addPath(musicDirectoryName), true);
+        QCOMPARE(watcher.addPath(albumDirectoryName), true);
+
+        QVERIFY(QDir(musicDirectoryName).removeRecursively());
+
+        QCOMPARE(watchedDirectoryRemovedSpy.wait(), true);
+        QCOMPARE(watchedDirectoryRemovedSpy.count(), 1);
+        QCOMPARE(watchedDirectoryRemovedSpy.at(0).at(0).toString(), musicDirectoryName);
+        QCOMPARE(watcher.isWatched(musicDirectoryName), false);
+        QCOMPARE(watcher.isWatched(albumDirectoryName), false);
+    }
+
+};
+
+QTEST_GUILESS_MAIN(InotifyFileSystemWatcherTests)
+
+
+#include "inotifyfilesystemwatchertest.moc"
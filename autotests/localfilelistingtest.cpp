@@ -33,6 +33,7 @@
 #include <QStandardPaths>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 
 #include <QDebug>
 
@@ -62,6 +63,7 @@ private Q_SLOTS:
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<QList<QUrl>>("QList<QUrl>");
         qRegisterMetaType<NotificationItem>("NotificationItem");
+        qRegisterMetaType<DatabaseInterface::DirectoriesDataType>("DatabaseInterface::DirectoriesDataType");
     }
 
     void initialTestWithNoTrack()
@@ -423,6 +425,248 @@ private Q_SLOTS:
         QCOMPARE(newCoversLast.count(), 1);
     }
 
+    void coalesceDirectoryChanges()
+    {
+        LocalFileListing myListing;
+
+        myListing.setDirectoryChangesCoalescingInterval(500);
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music3");
+        QDir musicDirectory(musicPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        musicDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("music3"));
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy indexingStartedSpy(&myListing, &LocalFileListing::indexingStarted);
+        QSignalSpy indexingFinishedSpy(&myListing, &LocalFileListing::indexingFinished);
+        QSignalSpy errorWatchingFileSystemChangesSpy(&myListing, &LocalFileListing::errorWatchingFileSystemChanges);
+
+        myListing.init();
+
+        myListing.setAllRootPaths({musicPath});
+
+        myListing.refreshContent();
+
+        QCOMPARE(tracksListSpy.count(), 0);
+        QCOMPARE(indexingStartedSpy.count(), 1);
+        QCOMPARE(indexingFinishedSpy.count(), 1);
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/test1.ogg")), true);
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/test2.ogg")), true);
+        QCOMPARE(rootDirectory.mkpath(QStringLiteral("music3/album")), true);
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/album/test3.ogg")), true);
+
+        auto newFilesWorking = tracksListSpy.wait();
+
+        if (!newFilesWorking && errorWatchingFileSystemChangesSpy.count()) {
+            QEXPECT_FAIL("", "Impossible watching file system for changes", Abort);
+        }
+        QCOMPARE(newFilesWorking, true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(indexingStartedSpy.count(), 2);
+        QCOMPARE(indexingFinishedSpy.count(), 2);
+
+        const auto &newTracks = tracksListSpy.at(0).at(0).value<QList<MusicAudioTrack>>();
+        QCOMPARE(newTracks.count(), 3);
+    }
+
+    void rankedCoverCandidates()
+    {
+        LocalFileListing myListing;
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music4");
+        QDir musicDirectory(musicPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        musicDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("music4"));
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/test.ogg")), true);
+        QFile myCover(musicOriginPath + QStringLiteral("/cover.jpg"));
+        QCOMPARE(myCover.copy(musicPath + QStringLiteral("/folder.jpg")), true);
+        QCOMPARE(myCover.copy(musicPath + QStringLiteral("/front.png")), true);
+        QCOMPARE(myCover.copy(musicPath + QStringLiteral("/Album Cover.JPG")), true);
+        QCOMPARE(myCover.copy(musicPath + QStringLiteral("/cover.txt")), true);
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+
+        myListing.init();
+
+        myListing.setAllRootPaths({musicPath});
+
+        myListing.refreshContent();
+
+        QVERIFY(tracksListSpy.count() > 0);
+
+        const auto &newCovers = tracksListSpy.last().at(1).value<QHash<QString, QUrl>>();
+        const auto &trackUrl = QUrl::fromLocalFile(QFileInfo(musicPath + QStringLiteral("/test.ogg")).canonicalFilePath());
+
+        QCOMPARE(newCovers.count(), 1);
+        QCOMPARE(newCovers.value(trackUrl.toString()).fileName(), QStringLiteral("Album Cover.JPG"));
+    }
+
+    void rescanFilesRetaggedInUnchangedDirectory()
+    {
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music5");
+        QDir musicDirectory(musicPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        musicDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("music5/album"));
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/album/test.ogg")), true);
+
+        const auto &trackUrl = QUrl::fromLocalFile(QFileInfo(musicPath + QStringLiteral("/album/test.ogg")).canonicalFilePath());
+
+        auto indexedDirectories = DatabaseInterface::DirectoriesDataType{};
+        auto trackModificationTime = QDateTime{};
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy directoriesIndexedSpy(&myListing, &LocalFileListing::directoriesIndexed);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.refreshContent();
+
+            QCOMPARE(tracksListSpy.count(), 1);
+            QCOMPARE(directoriesIndexedSpy.count(), 1);
+
+            const auto &newTracks = tracksListSpy.at(0).at(0).value<QList<MusicAudioTrack>>();
+            QCOMPARE(newTracks.count(), 1);
+            QCOMPARE(newTracks.at(0).resourceURI(), trackUrl);
+
+            trackModificationTime = newTracks.at(0).fileModificationTime();
+            indexedDirectories = directoriesIndexedSpy.at(0).at(0).value<DatabaseInterface::DirectoriesDataType>();
+            QCOMPARE(indexedDirectories.count(), 2);
+        }
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.restoredDirectories(indexedDirectories);
+            myListing.restoredTracks({{trackUrl, trackModificationTime}});
+
+            QCOMPARE(tracksListSpy.count(), 0);
+            QCOMPARE(removedTracksListSpy.count(), 0);
+        }
+
+        const auto albumModificationTime = QFileInfo(musicPath + QStringLiteral("/album")).fileTime(QFile::FileModificationTime);
+
+        // rewrite the file in place, as a tag editor does
+        QFile retaggedTrack(musicPath + QStringLiteral("/album/test.ogg"));
+        QCOMPARE(retaggedTrack.open(QIODevice::ReadWrite), true);
+        const auto trackContent = retaggedTrack.readAll();
+        QCOMPARE(retaggedTrack.seek(0), true);
+        QCOMPARE(retaggedTrack.write(trackContent), trackContent.size());
+        QCOMPARE(retaggedTrack.flush(), true);
+        QCOMPARE(retaggedTrack.setFileTime(trackModificationTime.addSecs(60), QFileDevice::FileModificationTime), true);
+        retaggedTrack.close();
+
+        QCOMPARE(QFileInfo(musicPath + QStringLiteral("/album")).fileTime(QFile::FileModificationTime), albumModificationTime);
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.restoredDirectories(indexedDirectories);
+            myListing.restoredTracks({{trackUrl, trackModificationTime}});
+
+            QCOMPARE(tracksListSpy.count(), 1);
+
+            const auto &rescannedTracks = tracksListSpy.at(0).at(0).value<QList<MusicAudioTrack>>();
+            QCOMPARE(rescannedTracks.count(), 1);
+            QCOMPARE(rescannedTracks.at(0).resourceURI(), trackUrl);
+            QCOMPARE(rescannedTracks.at(0).fileModificationTime(), trackModificationTime.addSecs(60));
+        }
+    }
+
+    void restoreUnchangedDirectoryWithoutAudioFiles()
+    {
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music6");
+        QDir musicDirectory(musicPath);
+        QDir rootDirectory(QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH));
+
+        musicDirectory.removeRecursively();
+        rootDirectory.mkpath(QStringLiteral("music6/album"));
+        rootDirectory.mkpath(QStringLiteral("music6/extras"));
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/album/test.ogg")), true);
+
+        QFile notesFile(musicPath + QStringLiteral("/extras/notes.txt"));
+        QCOMPARE(notesFile.open(QIODevice::WriteOnly), true);
+        notesFile.write("liner notes");
+        notesFile.close();
+
+        const auto &trackUrl = QUrl::fromLocalFile(QFileInfo(musicPath + QStringLiteral("/album/test.ogg")).canonicalFilePath());
+        const auto &extrasUrl = QUrl::fromLocalFile(QFileInfo(musicPath + QStringLiteral("/extras")).canonicalFilePath());
+
+        auto indexedDirectories = DatabaseInterface::DirectoriesDataType{};
+        auto trackModificationTime = QDateTime{};
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy directoriesIndexedSpy(&myListing, &LocalFileListing::directoriesIndexed);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.refreshContent();
+
+            QCOMPARE(tracksListSpy.count(), 1);
+            QCOMPARE(directoriesIndexedSpy.count(), 1);
+
+            trackModificationTime = tracksListSpy.at(0).at(0).value<QList<MusicAudioTrack>>().at(0).fileModificationTime();
+            indexedDirectories = directoriesIndexedSpy.at(0).at(0).value<DatabaseInterface::DirectoriesDataType>();
+            QCOMPARE(indexedDirectories.count(), 3);
+            QCOMPARE(indexedDirectories.contains(extrasUrl), true);
+            QCOMPARE(indexedDirectories.value(extrasUrl).mEntriesCount, 0);
+        }
+
+        {
+            LocalFileListing myListing;
+
+            QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+            QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+            QSignalSpy directoriesIndexedSpy(&myListing, &LocalFileListing::directoriesIndexed);
+
+            myListing.init();
+            myListing.setAllRootPaths({musicPath});
+            myListing.restoredDirectories(indexedDirectories);
+            myListing.restoredTracks({{trackUrl, trackModificationTime}});
+
+            QCOMPARE(tracksListSpy.count(), 0);
+            QCOMPARE(removedTracksListSpy.count(), 0);
+            QCOMPARE(directoriesIndexedSpy.count(), 0);
+        }
+    }
+
     void restoreRemovedTracks()
     {
         LocalFileListing myListing;
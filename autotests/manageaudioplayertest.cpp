@@ -8931,6 +8931,66 @@ void ManageAudioPlayerTest::testRestorePlayListAndSettingsAutomaticPlay()
 
     QCOMPARE(skipNextTrackSpy.wait(300), true);
 }
+void ManageAudioPlayerTest::playTrackAndAdvanceToPreloadedTrack()
+{
+    ManageAudioPlayer myPlayer;
+    QStandardItemModel myPlayList;
+
+    QSignalSpy currentTrackChangedSpy(&myPlayer, &ManageAudioPlayer::currentTrackChanged);
+    QSignalSpy playerSourceChangedSpy(&myPlayer, &ManageAudioPlayer::playerSourceChanged);
+    QSignalSpy playerPlaySpy(&myPlayer, &ManageAudioPlayer::playerPlay);
+    QSignalSpy playerStopSpy(&myPlayer, &ManageAudioPlayer::playerStop);
+    QSignalSpy skipNextTrackSpy(&myPlayer, &ManageAudioPlayer::skipNextTrack);
+    QSignalSpy startedPlayingTrackSpy(&myPlayer, &ManageAudioPlayer::startedPlayingTrack);
+
+    myPlayList.appendRow(new QStandardItem);
+    myPlayList.appendRow(new QStandardItem);
+    myPlayList.appendRow(new QStandardItem);
+
+    myPlayList.item(0, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///1.mp3")), ManageAudioPlayerTest::ResourceRole);
+    myPlayList.item(1, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///2.mp3")), ManageAudioPlayerTest::ResourceRole);
+    myPlayList.item(2, 0)->setData(QUrl::fromUserInput(QStringLiteral("file:///3.mp3")), ManageAudioPlayerTest::ResourceRole);
+
+    connect(&myPlayer, &ManageAudioPlayer::skipNextTrack, &myPlayer, [&myPlayer, &myPlayList]() {
+        myPlayer.setCurrentTrack(myPlayList.index(myPlayer.currentTrack().row() + 1, 0));
+    });
+
+    myPlayer.setPlayListModel(&myPlayList);
+    myPlayer.setUrlRole(ManageAudioPlayerTest::ResourceRole);
+    myPlayer.setIsPlayingRole(ManageAudioPlayerTest::IsPlayingRole);
+    myPlayer.setCurrentTrack(myPlayList.index(0, 0));
+
+    QCOMPARE(currentTrackChangedSpy.count(), 1);
+    QCOMPARE(playerSourceChangedSpy.count(), 1);
+    QCOMPARE(myPlayer.playerSource(), QUrl::fromUserInput(QStringLiteral("file:///1.mp3")));
+
+    myPlayer.ensurePlay();
+    myPlayer.setPlayerStatus(QMediaPlayer::LoadingMedia);
+    myPlayer.setPlayerStatus(QMediaPlayer::LoadedMedia);
+
+    QCOMPARE(playerPlaySpy.wait(), true);
+
+    myPlayer.setPlayerStatus(QMediaPlayer::BufferedMedia);
+    myPlayer.setPlayerPlaybackState(QMediaPlayer::PlayingState);
+
+    QCOMPARE(startedPlayingTrackSpy.count(), 1);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), true);
+
+    myPlayer.playerSourceAdvanced(QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+
+    QCOMPARE(skipNextTrackSpy.count(), 1);
+    QCOMPARE(currentTrackChangedSpy.count(), 2);
+    QCOMPARE(playerSourceChangedSpy.count(), 2);
+    QCOMPARE(playerSourceChangedSpy.last().at(0).toUrl(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+    QCOMPARE(playerStopSpy.count(), 0);
+    QCOMPARE(startedPlayingTrackSpy.count(), 2);
+    QCOMPARE(startedPlayingTrackSpy.last().at(0).toUrl(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+    QCOMPARE(myPlayer.currentTrack(), QPersistentModelIndex(myPlayList.index(1, 0)));
+    QCOMPARE(myPlayer.playerPlaybackState(), QMediaPlayer::PlayingState);
+    QCOMPARE(myPlayer.playerSource(), QUrl::fromUserInput(QStringLiteral("file:///2.mp3")));
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), ManageAudioPlayerTest::IsPlayingRole).toBool(), true);
+}
 
 QTEST_GUILESS_MAIN(ManageAudioPlayerTest)
 
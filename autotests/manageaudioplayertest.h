@@ -91,6 +91,8 @@ private Q_SLOTS:
 
     void playSingleAndClearPlayListTrack();
 
+    void playTrackAndAdvanceToPreloadedTrack();
+
 };
 
 #endif // MANAGEAUDIOPLAYERTEST_H
@@ -1880,6 +1880,8 @@ void ManageHeaderBarTest::moveCurrentTrack()
 
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList);
     connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
@@ -2143,6 +2145,8 @@ void ManageHeaderBarTest::moveAnotherTrack()
 
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList);
     connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
@@ -2412,6 +2416,8 @@ void ManageHeaderBarTest::setCurrentTrackTest()
 
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList);
     connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
@@ -2679,6 +2685,8 @@ void ManageHeaderBarTest::setPlayListModelTest()
 
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged);
     connect(&myPlayList, &MediaPlayList::newEntryInList,
             &myListener, &TracksListener::newEntryInList);
     connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
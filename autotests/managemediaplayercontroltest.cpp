@@ -421,6 +421,9 @@ void ManageMediaPlayerControlTest::moveCurrentTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -524,6 +527,9 @@ void ManageMediaPlayerControlTest::moveAnotherTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -627,6 +633,9 @@ void ManageMediaPlayerControlTest::setCurrentTrackTest()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -78,6 +78,9 @@ void MediaPlayListTest::simpleInitialCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -164,6 +167,9 @@ void MediaPlayListTest::enqueueAlbumCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -251,6 +257,82 @@ void MediaPlayListTest::enqueueAlbumCase()
     QCOMPARE(myPlayList.data(myPlayList.index(5, 0), MediaPlayList::AlbumIdRole).toULongLong(), 2);
 }
 
+void MediaPlayListTest::modifySeveralTracksCase()
+{
+    MediaPlayList myPlayList;
+    QAbstractItemModelTester testModel(&myPlayList);
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListener(&myDatabaseContent);
+
+    QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+    connect(&myListener, &TracksListener::trackHasChanged,
+            &myPlayList, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksListAdded,
+            &myPlayList, &MediaPlayList::tracksListAdded,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
+            &myListener, &TracksListener::trackByNameInList,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newEntryInList,
+            &myListener, &TracksListener::newEntryInList,
+            Qt::QueuedConnection);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
+
+    auto albumId = myDatabaseContent.albumIdFromTitleAndArtist(QStringLiteral("album2"), QStringLiteral("artist1"));
+    myPlayList.enqueue({albumId, QStringLiteral("album2")}, ElisaUtils::Album);
+
+    QVERIFY(dataChangedSpy.wait());
+
+    QCOMPARE(rowsInsertedSpy.count(), 2);
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(myPlayList.rowCount(), 6);
+
+    auto albumTracks = myDatabaseContent.albumData(albumId);
+    QCOMPARE(albumTracks.count(), 6);
+
+    auto modifiedTracks = MediaPlayList::ListTrackDataType{};
+    for (auto oneTrack : albumTracks) {
+        if (oneTrack.trackNumber() == 3 || oneTrack.trackNumber() == 5) {
+            continue;
+        }
+
+        oneTrack.setDuration(QTime::fromMSecsSinceStartOfDay(100 + oneTrack.trackNumber()));
+        modifiedTracks.push_back(oneTrack);
+    }
+
+    myPlayList.tracksChanged(modifiedTracks);
+
+    QCOMPARE(dataChangedSpy.count(), 4);
+    QCOMPARE(dataChangedSpy.at(1).at(0).value<QModelIndex>().row(), 0);
+    QCOMPARE(dataChangedSpy.at(1).at(1).value<QModelIndex>().row(), 1);
+    QCOMPARE(dataChangedSpy.at(2).at(0).value<QModelIndex>().row(), 3);
+    QCOMPARE(dataChangedSpy.at(2).at(1).value<QModelIndex>().row(), 3);
+    QCOMPARE(dataChangedSpy.at(3).at(0).value<QModelIndex>().row(), 5);
+    QCOMPARE(dataChangedSpy.at(3).at(1).value<QModelIndex>().row(), 5);
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 101);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 102);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 7);
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 104);
+    QCOMPARE(myPlayList.data(myPlayList.index(4, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 9);
+    QCOMPARE(myPlayList.data(myPlayList.index(5, 0), MediaPlayList::MilliSecondsDurationRole).toInt(), 106);
+
+    myPlayList.tracksChanged(modifiedTracks);
+
+    QCOMPARE(dataChangedSpy.count(), 4);
+}
+
 void MediaPlayListTest::clearPlayListCase()
 {
     MediaPlayList myPlayList;
@@ -289,6 +371,9 @@ void MediaPlayListTest::clearPlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -435,6 +520,9 @@ void MediaPlayListTest::undoClearPlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -640,6 +728,9 @@ void MediaPlayListTest::undoReplacePlayListCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -865,6 +956,9 @@ void MediaPlayListTest::enqueueArtistCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -998,6 +1092,9 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1088,6 +1185,9 @@ void MediaPlayListTest::testHasHeader()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1269,6 +1369,9 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1427,6 +1530,9 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1621,6 +1727,9 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1802,6 +1911,9 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -1983,6 +2095,9 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2164,6 +2279,9 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2345,6 +2463,9 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2539,6 +2660,9 @@ void MediaPlayListTest::enqueueReplaceAndPlay()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2714,6 +2838,9 @@ void MediaPlayListTest::crashOnEnqueue()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2802,6 +2929,9 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -2952,6 +3082,9 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -3203,6 +3336,9 @@ void MediaPlayListTest::testSavePersistentState()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -3217,6 +3353,9 @@ void MediaPlayListTest::testSavePersistentState()
     connect(&myListenerRead, &TracksListener::trackHasChanged,
             &myPlayListRead, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRead, &TracksListener::tracksHaveChanged,
+            &myPlayListRead, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRead, &TracksListener::tracksListAdded,
             &myPlayListRead, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -3532,6 +3671,9 @@ void MediaPlayListTest::testReplaceAndPlayArtist()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -3674,6 +3816,9 @@ void MediaPlayListTest::testReplaceAndPlayTrackId()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -3826,6 +3971,9 @@ void MediaPlayListTest::testSetData()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4035,6 +4183,9 @@ void MediaPlayListTest::testRemoveSelection()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4203,6 +4354,9 @@ void MediaPlayListTest::testTrackBeenRemoved()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4393,6 +4547,9 @@ void MediaPlayListTest::testBringUpCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4453,6 +4610,9 @@ void MediaPlayListTest::testBringUpCaseFromNewAlbum()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4511,6 +4671,9 @@ void MediaPlayListTest::testBringUpAndDownCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4580,6 +4743,9 @@ void MediaPlayListTest::testBringUpAndRemoveCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4644,6 +4810,9 @@ void MediaPlayListTest::testBringUpAndRemoveMultipleCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4717,6 +4886,9 @@ void MediaPlayListTest::testBringUpAndRemoveMultipleNotBeginCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4808,6 +4980,9 @@ void MediaPlayListTest::testBringUpAndPlayCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4875,6 +5050,9 @@ void MediaPlayListTest::testBringUpAndSkipNextCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -4942,6 +5120,9 @@ void MediaPlayListTest::testBringUpAndSkipPreviousCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5018,6 +5199,9 @@ void MediaPlayListTest::testBringUpAndSkipPreviousAndContinueCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5199,6 +5383,9 @@ void MediaPlayListTest::finishPlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5275,6 +5462,9 @@ void MediaPlayListTest::randomPlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5383,6 +5573,9 @@ void MediaPlayListTest::randomAndContinuePlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5502,6 +5695,9 @@ void MediaPlayListTest::continuePlayList()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5601,6 +5797,90 @@ void MediaPlayListTest::continuePlayList()
     QCOMPARE(myPlayList.currentTrack(), QPersistentModelIndex(myPlayList.index(0, 0)));
 }
 
+void MediaPlayListTest::nextTrackUrlFollowsPlayList()
+{
+    MediaPlayList myPlayList;
+    QAbstractItemModelTester testModel(&myPlayList);
+    DatabaseInterface myDatabaseContent;
+    TracksListener myListener(&myDatabaseContent);
+
+    QSignalSpy currentTrackChangedSpy(&myPlayList, &MediaPlayList::currentTrackChanged);
+    QSignalSpy nextTrackUrlChangedSpy(&myPlayList, &MediaPlayList::nextTrackUrlChanged);
+
+    myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+    connect(&myListener, &TracksListener::trackHasChanged,
+            &myPlayList, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksListAdded,
+            &myPlayList, &MediaPlayList::tracksListAdded,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newTrackByNameInList,
+            &myListener, &TracksListener::trackByNameInList,
+            Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newEntryInList,
+            &myListener, &TracksListener::newEntryInList,
+            Qt::QueuedConnection);
+    connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
+            &myListener, &TracksListener::tracksAdded);
+
+    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
+
+    myPlayList.enqueue({myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1),
+                        QStringLiteral("track1")},
+                       ElisaUtils::Track);
+    myPlayList.enqueue({myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"), 3, 3),
+                        QStringLiteral("track3")},
+                       ElisaUtils::Track);
+    myPlayList.enqueue({myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track5"), QStringLiteral("artist1"), QStringLiteral("album2"), 5, 1),
+                        QStringLiteral("track5")},
+                       ElisaUtils::Track);
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 0);
+    QCOMPARE(myPlayList.nextTrackUrl(), QUrl());
+
+    QCOMPARE(currentTrackChangedSpy.wait(), true);
+
+    const auto &firstTrackUrl = myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl();
+    const auto &secondTrackUrl = myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl();
+    const auto &thirdTrackUrl = myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl();
+
+    QVERIFY(!secondTrackUrl.isEmpty());
+    QVERIFY(!thirdTrackUrl.isEmpty());
+
+    QCOMPARE(myPlayList.currentTrack(), QPersistentModelIndex(myPlayList.index(0, 0)));
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 1);
+    QCOMPARE(myPlayList.nextTrackUrl(), secondTrackUrl);
+
+    myPlayList.skipNextTrack();
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 2);
+    QCOMPARE(myPlayList.nextTrackUrl(), thirdTrackUrl);
+
+    myPlayList.skipNextTrack();
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 3);
+    QCOMPARE(myPlayList.nextTrackUrl(), QUrl());
+
+    myPlayList.setRepeatPlay(true);
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 4);
+    QCOMPARE(myPlayList.nextTrackUrl(), firstTrackUrl);
+
+    myPlayList.setRandomPlay(true);
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 5);
+    QCOMPARE(myPlayList.nextTrackUrl(), QUrl());
+
+    myPlayList.setRandomPlay(false);
+
+    QCOMPARE(nextTrackUrlChangedSpy.count(), 6);
+    QCOMPARE(myPlayList.nextTrackUrl(), firstTrackUrl);
+}
+
 void MediaPlayListTest::testRestoreSettings()
 {
     MediaPlayList myPlayList;
@@ -5618,6 +5898,9 @@ void MediaPlayListTest::testRestoreSettings()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5698,6 +5981,9 @@ void MediaPlayListTest::testSaveAndRestoreSettings()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5713,6 +5999,9 @@ void MediaPlayListTest::testSaveAndRestoreSettings()
     connect(&myListenerRestore, &TracksListener::trackHasChanged,
             &myPlayListRestore, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksHaveChanged,
+            &myPlayListRestore, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRestore, &TracksListener::tracksListAdded,
             &myPlayListRestore, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5871,6 +6160,9 @@ void MediaPlayListTest::removeBeforeCurrentTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -5969,6 +6261,9 @@ void MediaPlayListTest::switchToTrackTest()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6045,6 +6340,9 @@ void MediaPlayListTest::singleTrack()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6114,6 +6412,9 @@ void MediaPlayListTest::testBringUpAndRemoveLastCase()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6218,6 +6519,9 @@ void MediaPlayListTest::testSaveLoadPlayList()
     connect(&myListenerSave, &TracksListener::trackHasChanged,
             &myPlayListSave, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerSave, &TracksListener::tracksHaveChanged,
+            &myPlayListSave, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerSave, &TracksListener::tracksListAdded,
             &myPlayListSave, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6233,6 +6537,9 @@ void MediaPlayListTest::testSaveLoadPlayList()
     connect(&myListenerRestore, &TracksListener::trackHasChanged,
             &myPlayListRestore, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListenerRestore, &TracksListener::tracksHaveChanged,
+            &myPlayListRestore, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListenerRestore, &TracksListener::tracksListAdded,
             &myPlayListRestore, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6416,6 +6723,9 @@ void MediaPlayListTest::testEnqueueFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6517,6 +6827,9 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -6622,6 +6935,9 @@ void MediaPlayListTest::testEmptyEnqueue()
     connect(&myListener, &TracksListener::trackHasChanged,
             &myPlayList, &MediaPlayList::trackChanged,
             Qt::QueuedConnection);
+    connect(&myListener, &TracksListener::tracksHaveChanged,
+            &myPlayList, &MediaPlayList::tracksChanged,
+            Qt::QueuedConnection);
     connect(&myListener, &TracksListener::tracksListAdded,
             &myPlayList, &MediaPlayList::tracksListAdded,
             Qt::QueuedConnection);
@@ -47,6 +47,8 @@ private Q_SLOTS:
 
     void enqueueAlbumCase();
 
+    void modifySeveralTracksCase();
+
     void enqueueArtistCase();
 
     void removeFirstTrackOfAlbum();
@@ -115,6 +117,8 @@ private Q_SLOTS:
 
     void continuePlayList();
 
+    void nextTrackUrlFollowsPlayList();
+
     void testRestoreSettings();
 
     void removeBeforeCurrentTrack();
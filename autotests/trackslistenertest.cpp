@@ -81,10 +81,11 @@ private Q_SLOTS:
 
         myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
 
-        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksRemoved, &myListener, &TracksListener::tracksRemoved);
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
@@ -203,10 +204,11 @@ private Q_SLOTS:
 
         myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
 
-        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksRemoved, &myListener, &TracksListener::tracksRemoved);
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
@@ -270,10 +272,11 @@ private Q_SLOTS:
 
         myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
 
-        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksRemoved, &myListener, &TracksListener::tracksRemoved);
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
@@ -329,27 +332,31 @@ private Q_SLOTS:
         TracksListener myListener(&myDatabaseContent);
 
         QSignalSpy trackHasChangedSpy(&myListener, &TracksListener::trackHasChanged);
+        QSignalSpy tracksHaveChangedSpy(&myListener, &TracksListener::tracksHaveChanged);
         QSignalSpy trackHasBeenRemovedSpy(&myListener, &TracksListener::trackHasBeenRemoved);
         QSignalSpy tracksListAddedSpy(&myListener, &TracksListener::tracksListAdded);
 
         myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
 
-        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksRemoved, &myListener, &TracksListener::tracksRemoved);
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
         connect(&myPlayList, &MediaPlayList::newTrackByNameInList, &myListener, &TracksListener::trackByNameInList);
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(tracksHaveChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(tracksListAddedSpy.count(), 0);
 
         myPlayList.enqueueRestoredEntry({QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1});
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(tracksHaveChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(tracksListAddedSpy.count(), 0);
 
@@ -364,7 +371,8 @@ private Q_SLOTS:
 
         myDatabaseContent.insertTracksList(mNewTracks, mNewCovers);
 
-        QCOMPARE(trackHasChangedSpy.count(), 1);
+        QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(tracksHaveChangedSpy.count(), 1);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(tracksListAddedSpy.count(), 0);
 
@@ -377,7 +385,8 @@ private Q_SLOTS:
 
         myDatabaseContent.removeTracksList({QUrl::fromLocalFile(QStringLiteral("/$1"))});
 
-        QCOMPARE(trackHasChangedSpy.count(), 1);
+        QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(tracksHaveChangedSpy.count(), 1);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 1);
         QCOMPARE(tracksListAddedSpy.count(), 0);
 
@@ -403,10 +412,11 @@ private Q_SLOTS:
 
         myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
 
-        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksRemoved, &myListener, &TracksListener::tracksRemoved);
         connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
         connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
         connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::tracksHaveChanged, &myPlayList, &MediaPlayList::tracksChanged);
         connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
         connect(&myListener, &TracksListener::tracksListAdded, &myPlayList, &MediaPlayList::tracksListAdded);
         connect(&myPlayList, &MediaPlayList::newEntryInList, &myListener, &TracksListener::newEntryInList);
@@ -55,11 +55,17 @@ void AbstractFileListener::setDatabaseInterface(DatabaseInterface *model)
         connect(this, &AbstractFileListener::newTrackFile, d->mFileListing, &AbstractFileListing::newTrackFile);
         connect(d->mFileListing, &AbstractFileListing::tracksList, model, &DatabaseInterface::insertTracksList);
         connect(d->mFileListing, &AbstractFileListing::removedTracksList, model, &DatabaseInterface::removeTracksList);
+        connect(d->mFileListing, &AbstractFileListing::tracksOffline, model, &DatabaseInterface::setTracksOffline);
+        connect(d->mFileListing, &AbstractFileListing::rootPathOnline, model, &DatabaseInterface::setDirectoryOnline);
         connect(d->mFileListing, &AbstractFileListing::modifyTracksList, model, &DatabaseInterface::insertTracksList);
         connect(d->mFileListing, &AbstractFileListing::askRestoredTracks,
                 model, &DatabaseInterface::askRestoredTracks);
+        connect(model, &DatabaseInterface::restoredDirectories,
+                d->mFileListing, &AbstractFileListing::restoredDirectories);
         connect(model, &DatabaseInterface::restoredTracks,
                 d->mFileListing, &AbstractFileListing::restoredTracks);
+        connect(d->mFileListing, &AbstractFileListing::directoriesIndexed,
+                model, &DatabaseInterface::updateDirectoriesIndex);
         connect(model, &DatabaseInterface::cleanedDatabase,
                 d->mFileListing, &AbstractFileListing::refreshContent);
         connect(model, &DatabaseInterface::finishRemovingTracksList,
@@ -91,6 +97,12 @@ void AbstractFileListener::setAllRootPaths(const QStringList &allRootPaths)
     d->mFileListing->setAllRootPaths(allRootPaths);
 }
 
+void AbstractFileListener::setScalableFileSystemWatcher(bool useScalableWatcher)
+{
+    QMetaObject::invokeMethod(d->mFileListing, "setScalableFileSystemWatcher", Qt::QueuedConnection,
+                              Q_ARG(bool, useScalableWatcher));
+}
+
 void AbstractFileListener::setFileListing(AbstractFileListing *fileIndexer)
 {
     d->mFileListing = fileIndexer;
@@ -77,6 +77,8 @@ public Q_SLOTS:
 
     void setAllRootPaths(const QStringList &allRootPaths);
 
+    void setScalableFileSystemWatcher(bool useScalableWatcher);
+
 protected:
 
     void setFileListing(AbstractFileListing *fileIndexer);
@@ -21,53 +21,192 @@
 
 #include "abstractfile/indexercommon.h"
 
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+#include "abstractfile/inotifyfilesystemwatcher.h"
+#endif
+
 #include "musicaudiotrack.h"
 #include "notificationitem.h"
 #include "filescanner.h"
 
-#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
-#include <KFileMetaData/EmbeddedImageData>
-#endif
-
 #include <QThread>
 #include <QHash>
 #include <QFileInfo>
 #include <QFile>
 #include <QDir>
 #include <QFileSystemWatcher>
+#include <QStorageInfo>
 #include <QMimeDatabase>
 #include <QSet>
 #include <QPair>
 #include <QAtomicInt>
+#include <QThreadPool>
+#include <QThreadStorage>
+#include <QFuture>
+#include <QQueue>
+#include <QTimer>
 #include <QDebug>
 
+#include <QtConcurrentRun>
+
 #include <QtGlobal>
 
 #include <algorithm>
 #include <utility>
 
+namespace {
+
+/*
+ * Rank of an image file as the cover of the album stored in a directory named
+ * directoryName: lower is better and -1 means the file is not a candidate.
+ */
+int coverCandidateRank(const QString &fileName, const QString &directoryName)
+{
+    if (!fileName.endsWith(QStringLiteral(".jpg"), Qt::CaseInsensitive) &&
+            !fileName.endsWith(QStringLiteral(".png"), Qt::CaseInsensitive)) {
+        return -1;
+    }
+
+    if (fileName.contains(QStringLiteral("cover"), Qt::CaseInsensitive)) {
+        return 0;
+    }
+
+    if (fileName.contains(QStringLiteral("folder"), Qt::CaseInsensitive)) {
+        return 1;
+    }
+
+    if (fileName.contains(QStringLiteral("front"), Qt::CaseInsensitive)) {
+        return 2;
+    }
+
+    if (!directoryName.isEmpty() && fileName.contains(directoryName, Qt::CaseInsensitive)) {
+        return 3;
+    }
+
+    auto compactDirectoryName = directoryName;
+    compactDirectoryName.remove(QLatin1Char(' '));
+    if (!compactDirectoryName.isEmpty() && fileName.contains(compactDirectoryName, Qt::CaseInsensitive)) {
+        return 4;
+    }
+
+    return -1;
+}
+
+QUrl bestCoverCandidate(const QFileInfoList &directoryEntries, const QString &directoryName)
+{
+    auto bestRank = -1;
+    auto bestCandidate = QFileInfo{};
+
+    for (const auto &oneEntry : directoryEntries) {
+        if (!oneEntry.isFile()) {
+            continue;
+        }
+
+        const auto &fileName = oneEntry.fileName();
+        const auto rank = coverCandidateRank(fileName, directoryName);
+        if (rank == -1) {
+            continue;
+        }
+
+        if (bestRank == -1 || rank < bestRank ||
+                (rank == bestRank && fileName.compare(bestCandidate.fileName(), Qt::CaseInsensitive) < 0)) {
+            bestRank = rank;
+            bestCandidate = oneEntry;
+        }
+    }
+
+    if (bestRank == -1) {
+        return {};
+    }
+
+    return QUrl::fromLocalFile(bestCandidate.absoluteFilePath());
+}
+
+/*
+ * Key of a directory in the persisted directory index. Files and subdirectories are
+ * discovered through their canonical path, so directories are indexed the same way.
+ */
+QUrl indexedDirectoryKey(const QUrl &path)
+{
+    const auto &canonicalPath = QFileInfo(path.toLocalFile()).canonicalFilePath();
+    if (canonicalPath.isEmpty()) {
+        return path;
+    }
+
+    return QUrl::fromLocalFile(canonicalPath);
+}
+
+}
+
+class MetadataExtractionWorker
+{
+public:
+
+    FileScanner mFileScanner;
+
+};
+
+struct PendingMetadataExtraction
+{
+
+    QFuture<MusicAudioTrack> mResult;
+
+    QFileInfo mFileInfo;
+
+    QUrl mDirectory;
+
+};
+
 class AbstractFileListingPrivate
 {
 public:
 
+    MusicAudioTrack extractOneFile(const QUrl &scanFile, const QDateTime &fileModificationTime);
+
     QStringList mAllRootPaths;
 
+    QStringList mOfflineRootPaths;
+
+    // file system mounted at each available root path when the scan started
+    QHash<QUrl, QString> mRootMountPoints;
+
     QFileSystemWatcher mFileSystemWatcher;
 
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+    InotifyFileSystemWatcher *mInotifyWatcher = nullptr;
+#endif
+
+    bool mUseScalableWatcher = false;
+
     QHash<QString, QUrl> mAllAlbumCover;
 
+    // best cover image of each scanned directory, an empty url when it has none
+    QHash<QString, QUrl> mDirectoryCovers;
+
     QHash<QUrl, QSet<QPair<QUrl, bool>>> mDiscoveredFiles;
 
     FileScanner mFileScanner;
 
     QMimeDatabase mMimeDb;
 
-#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
-    KFileMetaData::EmbeddedImageData mImageScanner;
-#endif
-
     QHash<QUrl, QDateTime> mAllFiles;
 
+    DatabaseInterface::DirectoriesDataType mKnownDirectories;
+
+    QHash<QUrl, QList<QUrl>> mKnownFilesByDirectory;
+
+    QHash<QUrl, QList<QUrl>> mKnownSubDirectories;
+
+    DatabaseInterface::DirectoriesDataType mIndexedDirectories;
+
+    QList<QUrl> mRemovedDirectories;
+
+    QSet<QString> mChangedDirectories;
+
+    QSet<QUrl> mDirectoriesToRevisit;
+
+    QTimer *mChangedDirectoriesTimer = nullptr;
+
     QAtomicInt mStopRequest = 0;
 
     int mImportedTracksCount = 0;
@@ -82,18 +221,74 @@ public:
 
     bool mErrorWatchingFileSystemChanges = false;
 
+    bool mParallelMetadataExtraction = false;
+
+    bool mDeferNewFilesEmission = false;
+
+    QQueue<PendingMetadataExtraction> mPendingExtractions;
+
+    QThreadStorage<MetadataExtractionWorker*> mExtractionWorkers;
+
+    QThreadPool mExtractionThreadPool;
+
 };
 
+MusicAudioTrack AbstractFileListingPrivate::extractOneFile(const QUrl &scanFile, const QDateTime &fileModificationTime)
+{
+    if (mStopRequest == 1) {
+        return {};
+    }
+
+    if (!mExtractionWorkers.hasLocalData()) {
+        mExtractionWorkers.setLocalData(new MetadataExtractionWorker);
+    }
+
+    auto &worker = *mExtractionWorkers.localData();
+
+    auto frontCover = FileScanner::EmbeddedCover{};
+    auto newTrack = worker.mFileScanner.scanOneFile(scanFile, mMimeDb, frontCover);
+
+    if (newTrack.isValid()) {
+        newTrack.setFileModificationTime(fileModificationTime);
+    }
+
+    return newTrack;
+}
+
 AbstractFileListing::AbstractFileListing(QObject *parent) : QObject(parent), d(std::make_unique<AbstractFileListingPrivate>())
 {
+    d->mExtractionThreadPool.setMaxThreadCount(std::max(1, QThread::idealThreadCount()));
+
+    d->mChangedDirectoriesTimer = new QTimer(this);
+    d->mChangedDirectoriesTimer->setSingleShot(true);
+    d->mChangedDirectoriesTimer->setInterval(1000);
+
+    connect(d->mChangedDirectoriesTimer, &QTimer::timeout,
+            this, &AbstractFileListing::processChangedDirectories);
+
     connect(&d->mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
             this, &AbstractFileListing::directoryChanged);
     connect(&d->mFileSystemWatcher, &QFileSystemWatcher::fileChanged,
             this, &AbstractFileListing::fileChanged);
+
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+    d->mInotifyWatcher = new InotifyFileSystemWatcher(this);
+    d->mUseScalableWatcher = d->mInotifyWatcher->isValid();
+
+    connect(d->mInotifyWatcher, &InotifyFileSystemWatcher::directoryChanged,
+            this, &AbstractFileListing::directoryChanged);
+    connect(d->mInotifyWatcher, &InotifyFileSystemWatcher::fileChanged,
+            this, &AbstractFileListing::fileChanged);
+    connect(d->mInotifyWatcher, &InotifyFileSystemWatcher::watchedDirectoryRemoved,
+            this, &AbstractFileListing::rootDirectoryRemoved);
+#endif
 }
 
 AbstractFileListing::~AbstractFileListing()
-= default;
+{
+    d->mStopRequest = 1;
+    d->mExtractionThreadPool.waitForDone();
+}
 
 void AbstractFileListing::init()
 {
@@ -110,6 +305,11 @@ void AbstractFileListing::newTrackFile(const MusicAudioTrack &partialTrack)
     }
 }
 
+void AbstractFileListing::restoredDirectories(const DatabaseInterface::DirectoriesDataType &allDirectories)
+{
+    d->mKnownDirectories = allDirectories;
+}
+
 void AbstractFileListing::restoredTracks(QHash<QUrl, QDateTime> allFiles)
 {
     executeInit(std::move(allFiles));
@@ -138,6 +338,59 @@ void AbstractFileListing::databaseFinishedRemovingTracksList()
     }
 }
 
+void AbstractFileListing::setScalableFileSystemWatcher(bool useScalableWatcher)
+{
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+    useScalableWatcher = useScalableWatcher && d->mInotifyWatcher->isValid();
+
+    if (d->mUseScalableWatcher == useScalableWatcher) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::setScalableFileSystemWatcher" << useScalableWatcher;
+
+    if (useScalableWatcher) {
+        const auto watchedDirectories = d->mFileSystemWatcher.directories();
+        const auto watchedFiles = d->mFileSystemWatcher.files();
+
+        if (!watchedDirectories.isEmpty()) {
+            d->mFileSystemWatcher.removePaths(watchedDirectories);
+        }
+        if (!watchedFiles.isEmpty()) {
+            d->mFileSystemWatcher.removePaths(watchedFiles);
+        }
+
+        d->mUseScalableWatcher = true;
+
+        for (const auto &oneDirectory : watchedDirectories) {
+            watchPath(oneDirectory);
+        }
+        for (const auto &oneFile : watchedFiles) {
+            watchFile(oneFile);
+        }
+    } else {
+        const auto watchedDirectories = d->mInotifyWatcher->directories();
+
+        d->mInotifyWatcher->removeAllPaths();
+
+        d->mUseScalableWatcher = false;
+
+        for (const auto &oneDirectory : watchedDirectories) {
+            watchPath(oneDirectory);
+
+            const auto &directoryListingFiles = d->mDiscoveredFiles.value(QUrl::fromLocalFile(oneDirectory));
+            for (const auto &oneEntry : directoryListingFiles) {
+                if (oneEntry.second) {
+                    watchFile(oneEntry.first.toLocalFile());
+                }
+            }
+        }
+    }
+#else
+    Q_UNUSED(useScalableWatcher)
+#endif
+}
+
 void AbstractFileListing::applicationAboutToQuit()
 {
     d->mStopRequest = 1;
@@ -148,12 +401,28 @@ const QStringList &AbstractFileListing::allRootPaths() const
     return d->mAllRootPaths;
 }
 
+int AbstractFileListing::directoryChangesCoalescingInterval() const
+{
+    return d->mChangedDirectoriesTimer->interval();
+}
+
+void AbstractFileListing::setDirectoryChangesCoalescingInterval(int interval)
+{
+    d->mChangedDirectoriesTimer->setInterval(interval);
+}
+
 void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path)
 {
     if (d->mStopRequest == 1) {
         return;
     }
 
+    if (d->mHandleNewFiles && restoreUnchangedDirectory(newFiles, path)) {
+        return;
+    }
+
+    const auto directoryModifiedTime = QFileInfo(path.toLocalFile()).fileTime(QFile::FileModificationTime);
+
     QDir rootDirectory(path.toLocalFile());
     rootDirectory.refresh();
 
@@ -167,12 +436,26 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
 
     rootDirectory.refresh();
     const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
+
+    if (d->mHandleNewFiles) {
+        d->mDirectoryCovers[rootDirectory.canonicalPath()] = bestCoverCandidate(entryList, rootDirectory.dirName());
+    }
+
+    // only directories and audio files are ever restored from the index, a directory
+    // holding nothing else must record 0 entries to be trusted at the next scan
+    auto indexedEntriesCount = 0;
+
     for (const auto &oneEntry : entryList) {
         auto newFilePath = QUrl::fromLocalFile(oneEntry.canonicalFilePath());
 
         if (oneEntry.isDir() || oneEntry.isFile()) {
             currentFilesList.insert(newFilePath);
         }
+
+        if (oneEntry.isDir() ||
+                (oneEntry.isFile() && d->mMimeDb.mimeTypeForFile(oneEntry).name().startsWith(QStringLiteral("audio/")))) {
+            ++indexedEntriesCount;
+        }
     }
 
     auto removedTracks = QVector<QPair<QUrl, bool>>();
@@ -207,12 +490,31 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
         return;
     }
 
+    const auto &directoryKey = indexedDirectoryKey(path);
+
+    for (const auto &knownSubDirectory : d->mKnownSubDirectories.value(directoryKey)) {
+        if (!currentFilesList.contains(knownSubDirectory)) {
+            d->mKnownDirectories.remove(knownSubDirectory);
+            d->mRemovedDirectories.push_back(knownSubDirectory);
+        }
+    }
+    d->mKnownSubDirectories.remove(directoryKey);
+    d->mKnownFilesByDirectory.remove(directoryKey);
+
     for (const auto &newFilePath : currentFilesList) {
         QFileInfo oneEntry(newFilePath.toLocalFile());
 
         auto itFilePath = std::find(currentDirectoryListingFiles.begin(), currentDirectoryListingFiles.end(), QPair<QUrl, bool>{newFilePath, oneEntry.isFile()});
 
         if (itFilePath != currentDirectoryListingFiles.end()) {
+            if (!itFilePath->second && d->mDirectoriesToRevisit.remove(newFilePath)) {
+                scanDirectory(newFiles, newFilePath);
+
+                if (d->mStopRequest == 1) {
+                    break;
+                }
+            }
+
             continue;
         }
 
@@ -230,30 +532,167 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
             continue;
         }
 
-        auto newTrack = scanOneFile(newFilePath, oneEntry);
+        if (d->mParallelMetadataExtraction) {
+            enqueueMetadataExtraction(newFiles, newFilePath, oneEntry, path);
+        } else {
+            addNewTrack(newFiles, scanOneFile(newFilePath, oneEntry), path);
+        }
 
-        if (newTrack.isValid() && d->mStopRequest == 0) {
-            addCover(newTrack);
+        if (d->mStopRequest == 1) {
+            break;
+        }
+    }
 
-            addFileInDirectory(newTrack.resourceURI(), path);
-            newFiles.push_back(newTrack);
+    if (d->mStopRequest == 0 && directoryModifiedTime.isValid()) {
+        auto &indexedDirectory = d->mIndexedDirectories[directoryKey];
+        indexedDirectory.mModifiedTime = directoryModifiedTime;
+        indexedDirectory.mEntriesCount = indexedEntriesCount;
+        indexedDirectory.mMountPoint = d->mRootMountPoints.value(directoryKey);
 
-            ++d->mImportedTracksCount;
-            if (d->mImportedTracksCount % d->mNotificationUpdateInterval == 0) {
-                d->mNotificationUpdateInterval = std::min(50, 1 + d->mNotificationUpdateInterval * 2);
-            }
+        d->mKnownDirectories[directoryKey] = indexedDirectory;
 
-            if (newFiles.size() > d->mNewFilesEmitInterval && d->mStopRequest == 0) {
-                d->mNewFilesEmitInterval = std::min(50, 1 + d->mNewFilesEmitInterval * d->mNewFilesEmitInterval);
-                emitNewFiles(newFiles);
-                newFiles.clear();
-            }
+        // entry stored by a previous version under the symbolic link of a root path
+        if (directoryKey != path && d->mKnownDirectories.remove(path)) {
+            d->mRemovedDirectories.push_back(path);
+        }
+    }
+}
+
+bool AbstractFileListing::restoreUnchangedDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path)
+{
+    if (d->mDiscoveredFiles.contains(path)) {
+        return false;
+    }
+
+    const auto &directoryKey = indexedDirectoryKey(path);
+
+    const auto itKnownDirectory = d->mKnownDirectories.constFind(directoryKey);
+    if (itKnownDirectory == d->mKnownDirectories.constEnd()) {
+        return false;
+    }
+
+    const auto directoryModifiedTime = QFileInfo(path.toLocalFile()).fileTime(QFile::FileModificationTime);
+    if (!directoryModifiedTime.isValid() || directoryModifiedTime != itKnownDirectory->mModifiedTime) {
+        return false;
+    }
+
+    const auto knownFiles = d->mKnownFilesByDirectory.take(directoryKey);
+    const auto knownSubDirectories = d->mKnownSubDirectories.take(directoryKey);
+    const auto knownEntriesCount = knownFiles.size() + knownSubDirectories.size();
+
+    if (knownEntriesCount > itKnownDirectory->mEntriesCount ||
+            (knownEntriesCount == 0 && itKnownDirectory->mEntriesCount != 0)) {
+        qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::restoreUnchangedDirectory" << "inconsistent index for" << path;
+        return false;
+    }
+
+    qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::restoreUnchangedDirectory" << path << knownFiles.size() << knownSubDirectories.size();
+
+    watchPath(path.toLocalFile());
+
+    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
+
+    for (const auto &oneKnownFile : knownFiles) {
+        const auto knownFileInfo = QFileInfo(oneKnownFile.toLocalFile());
+        if (!knownFileInfo.exists()) {
+            continue;
+        }
+
+        currentDirectoryListingFiles.insert({oneKnownFile, true});
+
+        // tags edited in place do not change the modification time of the directory
+        const auto itKnownFile = d->mAllFiles.find(oneKnownFile);
+        if (itKnownFile != d->mAllFiles.end() && *itKnownFile >= knownFileInfo.fileTime(QFile::FileModificationTime)) {
+            d->mAllFiles.erase(itKnownFile);
+            watchFile(oneKnownFile.toLocalFile());
+            continue;
+        }
+
+        if (d->mParallelMetadataExtraction) {
+            enqueueMetadataExtraction(newFiles, oneKnownFile, knownFileInfo, path);
+        } else {
+            addNewTrack(newFiles, scanOneFile(oneKnownFile, knownFileInfo), path);
         }
 
+        if (d->mStopRequest == 1) {
+            return true;
+        }
+    }
+
+    for (const auto &oneKnownSubDirectory : knownSubDirectories) {
+        currentDirectoryListingFiles.insert({oneKnownSubDirectory, false});
+        scanDirectory(newFiles, oneKnownSubDirectory);
+
         if (d->mStopRequest == 1) {
             break;
         }
     }
+
+    return true;
+}
+
+void AbstractFileListing::addNewTrack(QList<MusicAudioTrack> &newFiles, const MusicAudioTrack &newTrack, const QUrl &directory)
+{
+    if (!newTrack.isValid() || d->mStopRequest == 1) {
+        return;
+    }
+
+    addCover(newTrack);
+
+    addFileInDirectory(newTrack.resourceURI(), directory);
+    newFiles.push_back(newTrack);
+
+    ++d->mImportedTracksCount;
+    if (d->mImportedTracksCount % d->mNotificationUpdateInterval == 0) {
+        d->mNotificationUpdateInterval = std::min(50, 1 + d->mNotificationUpdateInterval * 2);
+    }
+
+    if (!d->mDeferNewFilesEmission && newFiles.size() > d->mNewFilesEmitInterval && d->mStopRequest == 0) {
+        d->mNewFilesEmitInterval = std::min(50, 1 + d->mNewFilesEmitInterval * d->mNewFilesEmitInterval);
+        emitNewFiles(newFiles);
+        newFiles.clear();
+    }
+}
+
+void AbstractFileListing::enqueueMetadataExtraction(QList<MusicAudioTrack> &newFiles, const QUrl &scanFile,
+                                                    const QFileInfo &scanFileInfo, const QUrl &directory)
+{
+    if (!isNewOrModifiedAudioFile(scanFile, scanFileInfo)) {
+        return;
+    }
+
+    const auto fileModificationTime = scanFileInfo.fileTime(QFile::FileModificationTime);
+    auto extractionResult = QtConcurrent::run(&d->mExtractionThreadPool, [=] () {
+        return d->extractOneFile(scanFile, fileModificationTime);
+    });
+
+    d->mPendingExtractions.enqueue({extractionResult, scanFileInfo, directory});
+
+    while (d->mPendingExtractions.size() > 4 * d->mExtractionThreadPool.maxThreadCount()) {
+        processOnePendingExtraction(newFiles);
+    }
+}
+
+void AbstractFileListing::processOnePendingExtraction(QList<MusicAudioTrack> &newFiles)
+{
+    auto pendingExtraction = d->mPendingExtractions.dequeue();
+
+    const auto &newTrack = pendingExtraction.mResult.result();
+
+    if (newTrack.isValid() && d->mStopRequest == 0) {
+        if (pendingExtraction.mFileInfo.exists()) {
+            watchFile(newTrack.resourceURI().toLocalFile());
+        }
+
+        addNewTrack(newFiles, newTrack, pendingExtraction.mDirectory);
+    }
+}
+
+void AbstractFileListing::processPendingExtractions(QList<MusicAudioTrack> &newFiles)
+{
+    while (!d->mPendingExtractions.isEmpty()) {
+        processOnePendingExtraction(newFiles);
+    }
 }
 
 void AbstractFileListing::directoryChanged(const QString &path)
@@ -263,9 +702,121 @@ void AbstractFileListing::directoryChanged(const QString &path)
         return;
     }
 
+    d->mChangedDirectories.insert(path);
+
+    if (!d->mChangedDirectoriesTimer->isActive()) {
+        d->mChangedDirectoriesTimer->start();
+    }
+}
+
+void AbstractFileListing::rootDirectoryRemoved(const QString &path)
+{
+    const auto itRootPath = std::find_if(d->mAllRootPaths.cbegin(), d->mAllRootPaths.cend(),
+                                         [&path](const auto &oneRootPath) {
+        return oneRootPath == path || QFileInfo(oneRootPath).canonicalFilePath() == path;
+    });
+
+    if (itRootPath == d->mAllRootPaths.cend()) {
+        directoryChanged(path);
+        return;
+    }
+
+    const auto &rootPath = *itRootPath;
+
+    if (isRootPathAvailable(rootPath)) {
+        directoryChanged(path);
+        return;
+    }
+
+    qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::rootDirectoryRemoved" << rootPath << "is not available anymore, its tracks are kept offline";
+
+    if (!d->mOfflineRootPaths.contains(rootPath)) {
+        d->mOfflineRootPaths.push_back(rootPath);
+    }
+
+    const auto &rootPathPrefix = QString(QUrl::fromLocalFile(path).toString() + QLatin1Char('/'));
+
+    auto offlineFiles = QList<QUrl>();
+    for (auto itDirectory = d->mDiscoveredFiles.begin(); itDirectory != d->mDiscoveredFiles.end(); ) {
+        if (itDirectory.key().toLocalFile() != path && !itDirectory.key().toString().startsWith(rootPathPrefix)) {
+            ++itDirectory;
+            continue;
+        }
+
+        for (const auto &oneFile : *itDirectory) {
+            if (oneFile.second) {
+                offlineFiles.push_back(oneFile.first);
+            }
+        }
+
+        d->mDirectoryCovers.remove(itDirectory.key().toLocalFile());
+        itDirectory = d->mDiscoveredFiles.erase(itDirectory);
+    }
+
+    if (!offlineFiles.isEmpty()) {
+        Q_EMIT tracksOffline(offlineFiles);
+    }
+}
+
+void AbstractFileListing::processChangedDirectories()
+{
+    if (d->mChangedDirectories.isEmpty() || d->mStopRequest == 1) {
+        return;
+    }
+
+    const auto changedDirectories = std::exchange(d->mChangedDirectories, {});
+
+    auto rescannedDirectories = QStringList();
+    for (const auto &oneDirectory : changedDirectories) {
+        auto intermediateDirectories = QList<QUrl>();
+        auto isCoveredByAncestor = false;
+
+        auto currentDirectory = oneDirectory;
+        auto ancestorDirectory = QFileInfo(currentDirectory).path();
+        while (ancestorDirectory != currentDirectory) {
+            if (changedDirectories.contains(ancestorDirectory)) {
+                isCoveredByAncestor = true;
+                break;
+            }
+
+            intermediateDirectories.push_back(QUrl::fromLocalFile(ancestorDirectory));
+
+            currentDirectory = ancestorDirectory;
+            ancestorDirectory = QFileInfo(currentDirectory).path();
+        }
+
+        if (!isCoveredByAncestor) {
+            rescannedDirectories.push_back(oneDirectory);
+            continue;
+        }
+
+        d->mDirectoriesToRevisit.insert(QUrl::fromLocalFile(oneDirectory));
+        for (const auto &oneIntermediateDirectory : intermediateDirectories) {
+            d->mDirectoriesToRevisit.insert(oneIntermediateDirectory);
+        }
+    }
+
+    qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::processChangedDirectories" << changedDirectories.size() << "changed" << rescannedDirectories;
+
     Q_EMIT indexingStarted();
 
-    scanDirectoryTree(path);
+    auto newFiles = QList<MusicAudioTrack>();
+
+    d->mDeferNewFilesEmission = true;
+
+    for (const auto &oneDirectory : rescannedDirectories) {
+        scanDirectory(newFiles, QUrl::fromLocalFile(oneDirectory));
+
+        if (d->mStopRequest == 1) {
+            break;
+        }
+    }
+
+    d->mDirectoriesToRevisit.clear();
+
+    finishDirectoryScan(newFiles);
+
+    d->mDeferNewFilesEmission = false;
 
     Q_EMIT indexingFinished();
 }
@@ -285,11 +836,74 @@ void AbstractFileListing::fileChanged(const QString &modifiedFileName)
 void AbstractFileListing::executeInit(QHash<QUrl, QDateTime> allFiles)
 {
     d->mAllFiles = std::move(allFiles);
+
+    d->mKnownFilesByDirectory.clear();
+    d->mKnownSubDirectories.clear();
+
+    if (!d->mHandleNewFiles || d->mKnownDirectories.isEmpty()) {
+        return;
+    }
+
+    for (auto itFile = d->mAllFiles.cbegin(); itFile != d->mAllFiles.cend(); ++itFile) {
+        d->mKnownFilesByDirectory[itFile.key().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash)].push_back(itFile.key());
+    }
+
+    for (auto itDirectory = d->mKnownDirectories.cbegin(); itDirectory != d->mKnownDirectories.cend(); ++itDirectory) {
+        d->mKnownSubDirectories[itDirectory.key().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash)].push_back(itDirectory.key());
+    }
 }
 
 void AbstractFileListing::triggerRefreshOfContent()
 {
     d->mImportedTracksCount = 0;
+
+    d->mOfflineRootPaths.clear();
+    d->mRootMountPoints.clear();
+    for (const auto &oneRootPath : qAsConst(d->mAllRootPaths)) {
+        if (isRootPathAvailable(oneRootPath)) {
+            const auto &rootKey = indexedDirectoryKey(QUrl::fromLocalFile(oneRootPath));
+            const auto &mountPoint = QStorageInfo(oneRootPath).rootPath();
+
+            d->mRootMountPoints[rootKey] = mountPoint;
+
+            auto itKnownRoot = d->mKnownDirectories.find(rootKey);
+            if (itKnownRoot != d->mKnownDirectories.end() && itKnownRoot->mMountPoint != mountPoint) {
+                itKnownRoot->mMountPoint = mountPoint;
+                d->mIndexedDirectories[rootKey] = *itKnownRoot;
+            }
+
+            Q_EMIT rootPathOnline(QUrl::fromLocalFile(oneRootPath));
+        } else {
+            qCInfo(orgKdeElisaIndexer()) << "AbstractFileListing::triggerRefreshOfContent" << oneRootPath << "is not available, its tracks are kept offline";
+            d->mOfflineRootPaths.push_back(oneRootPath);
+        }
+    }
+}
+
+bool AbstractFileListing::isRootPathAvailable(const QString &rootPath) const
+{
+    const auto rootDirectory = QDir(rootPath);
+
+    if (!rootDirectory.exists()) {
+        return false;
+    }
+
+    const auto itKnownRoot = d->mKnownDirectories.constFind(indexedDirectoryKey(QUrl::fromLocalFile(rootPath)));
+    if (itKnownRoot == d->mKnownDirectories.constEnd() || itKnownRoot->mMountPoint.isEmpty()) {
+        return true;
+    }
+
+    if (QStorageInfo(rootPath).rootPath() == itKnownRoot->mMountPoint) {
+        return true;
+    }
+
+    // the file system holding the root is not mounted: only its empty mount point is left
+    return !rootDirectory.isEmpty();
+}
+
+bool AbstractFileListing::isRootPathOffline(const QString &rootPath) const
+{
+    return d->mOfflineRootPaths.contains(rootPath);
 }
 
 void AbstractFileListing::refreshContent()
@@ -303,11 +917,29 @@ MusicAudioTrack AbstractFileListing::scanOneFile(const QUrl &scanFile, const QFi
 
     qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::scanOneFile" << scanFile;
 
-    auto localFileName = scanFile.toLocalFile();
+    if (!isNewOrModifiedAudioFile(scanFile, scanFileInfo)) {
+        return newTrack;
+    }
 
-    const auto &fileMimeType = d->mMimeDb.mimeTypeForFile(localFileName);
+    auto frontCover = FileScanner::EmbeddedCover{};
+    newTrack = d->mFileScanner.scanOneFile(scanFile, d->mMimeDb, frontCover);
+
+    if (newTrack.isValid()) {
+        newTrack.setFileModificationTime(scanFileInfo.fileTime(QFile::FileModificationTime));
+
+        if (scanFileInfo.exists()) {
+            watchFile(scanFile.toLocalFile());
+        }
+    }
+
+    return newTrack;
+}
+
+bool AbstractFileListing::isNewOrModifiedAudioFile(const QUrl &scanFile, const QFileInfo &scanFileInfo)
+{
+    const auto &fileMimeType = d->mMimeDb.mimeTypeForFile(scanFile.toLocalFile());
     if (!fileMimeType.name().startsWith(QStringLiteral("audio/"))) {
-        return newTrack;
+        return false;
     }
 
     if (scanFileInfo.exists()) {
@@ -315,28 +947,23 @@ MusicAudioTrack AbstractFileListing::scanOneFile(const QUrl &scanFile, const QFi
         if (itExistingFile != d->mAllFiles.end()) {
             if (*itExistingFile >= scanFileInfo.fileTime(QFile::FileModificationTime)) {
                 d->mAllFiles.erase(itExistingFile);
-                return newTrack;
+                return false;
             }
         }
     }
 
-    newTrack = d->mFileScanner.scanOneFile(scanFile, d->mMimeDb);
-
-    if (newTrack.isValid()) {
-        newTrack.setHasEmbeddedCover(checkEmbeddedCoverImage(localFileName));
-        newTrack.setFileModificationTime(scanFileInfo.fileTime(QFile::FileModificationTime));
-
-        if (scanFileInfo.exists()) {
-            watchPath(scanFile.toLocalFile());
-        }
-    }
-
-    return newTrack;
+    return true;
 }
 
 void AbstractFileListing::watchPath(const QString &pathName)
 {
-    if (!d->mFileSystemWatcher.addPath(pathName)) {
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+    const auto watchResult = (d->mUseScalableWatcher ? d->mInotifyWatcher->addPath(pathName) : d->mFileSystemWatcher.addPath(pathName));
+#else
+    const auto watchResult = d->mFileSystemWatcher.addPath(pathName);
+#endif
+
+    if (!watchResult) {
         qCDebug(orgKdeElisaIndexer) << "AbstractFileListing::watchPath" << "fail for" << pathName;
 
         if (!d->mErrorWatchingFileSystemChanges) {
@@ -346,6 +973,23 @@ void AbstractFileListing::watchPath(const QString &pathName)
     }
 }
 
+void AbstractFileListing::watchFile(const QString &fileName)
+{
+#if defined HAVE_SYS_INOTIFY_H && HAVE_SYS_INOTIFY_H
+    if (d->mUseScalableWatcher) {
+        const auto directoryName = QFileInfo(fileName).absolutePath();
+
+        if (!d->mInotifyWatcher->isWatched(directoryName)) {
+            watchPath(directoryName);
+        }
+
+        return;
+    }
+#endif
+
+    watchPath(fileName);
+}
+
 void AbstractFileListing::addFileInDirectory(const QUrl &newFile, const QUrl &directoryName)
 {
     const auto directoryEntry = d->mDiscoveredFiles.find(directoryName);
@@ -378,9 +1022,23 @@ void AbstractFileListing::scanDirectoryTree(const QString &path)
 
     scanDirectory(newFiles, QUrl::fromLocalFile(path));
 
+    finishDirectoryScan(newFiles);
+}
+
+void AbstractFileListing::finishDirectoryScan(QList<MusicAudioTrack> &newFiles)
+{
+    processPendingExtractions(newFiles);
+
     if (!newFiles.isEmpty() && d->mStopRequest == 0) {
         emitNewFiles(newFiles);
     }
+
+    if (d->mStopRequest == 0 && (!d->mIndexedDirectories.isEmpty() || !d->mRemovedDirectories.isEmpty())) {
+        Q_EMIT directoriesIndexed(d->mIndexedDirectories, d->mRemovedDirectories);
+
+        d->mIndexedDirectories.clear();
+        d->mRemovedDirectories.clear();
+    }
 }
 
 void AbstractFileListing::setHandleNewFiles(bool handleThem)
@@ -388,6 +1046,11 @@ void AbstractFileListing::setHandleNewFiles(bool handleThem)
     d->mHandleNewFiles = handleThem;
 }
 
+void AbstractFileListing::setParallelMetadataExtraction(bool parallelExtraction)
+{
+    d->mParallelMetadataExtraction = parallelExtraction;
+}
+
 void AbstractFileListing::emitNewFiles(const QList<MusicAudioTrack> &tracks)
 {
     Q_EMIT tracksList(tracks, d->mAllAlbumCover);
@@ -395,30 +1058,26 @@ void AbstractFileListing::emitNewFiles(const QList<MusicAudioTrack> &tracks)
 
 void AbstractFileListing::addCover(const MusicAudioTrack &newTrack)
 {
-    auto itCover = d->mAllAlbumCover.find(newTrack.albumName());
-    if (itCover != d->mAllAlbumCover.end()) {
+    const auto &trackKey = newTrack.resourceURI().toString();
+    if (d->mAllAlbumCover.contains(trackKey)) {
         return;
     }
 
-    QFileInfo trackFilePath(newTrack.resourceURI().toLocalFile());
-    QDir trackFileDir = trackFilePath.absoluteDir();
-    QString dirNamePattern = QStringLiteral("*") + trackFileDir.dirName() + QStringLiteral("*");
-    QStringList filters;
-    filters << QStringLiteral("*[Cc]over*.jpg") << QStringLiteral("*[Cc]over*.png")
-            << QStringLiteral("*[Ff]older*.jpg") << QStringLiteral("*[Ff]older*.png")
-            << QStringLiteral("*[Ff]ront*.jpg") << QStringLiteral("*[Ff]ront*.png")
-            << dirNamePattern + QStringLiteral(".jpg") << dirNamePattern + QStringLiteral(".png")
-            << dirNamePattern.toLower() + QStringLiteral(".jpg") << dirNamePattern.toLower() + QStringLiteral(".png");
-    dirNamePattern.remove(QLatin1Char(' '));
-    filters << dirNamePattern + QStringLiteral(".jpg") << dirNamePattern + QStringLiteral(".png")
-            << dirNamePattern.toLower() + QStringLiteral(".jpg") << dirNamePattern.toLower() + QStringLiteral(".png");
-    trackFileDir.setNameFilters(filters);
-    QFileInfoList coverFiles = trackFileDir.entryInfoList();
-    if (coverFiles.isEmpty()) {
+    const auto &trackDirectoryPath = QFileInfo(newTrack.resourceURI().toLocalFile()).absolutePath();
+
+    auto itDirectoryCover = d->mDirectoryCovers.constFind(trackDirectoryPath);
+    if (itDirectoryCover == d->mDirectoryCovers.constEnd()) {
+        // tracks not discovered by scanDirectory (e.g. reported by Baloo) need one listing of their directory
+        QDir trackDirectory(trackDirectoryPath);
+        itDirectoryCover = d->mDirectoryCovers.insert(trackDirectoryPath,
+                                                      bestCoverCandidate(trackDirectory.entryInfoList(QDir::Files), trackDirectory.dirName()));
+    }
+
+    if (itDirectoryCover->isEmpty()) {
         return;
-    } else {
-        d->mAllAlbumCover[newTrack.resourceURI().toString()] = QUrl::fromLocalFile(coverFiles.at(0).absoluteFilePath());
     }
+
+    d->mAllAlbumCover[trackKey] = *itDirectoryCover;
 }
 
 void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QUrl> &allRemovedFiles)
@@ -440,6 +1099,11 @@ void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QU
     }
 
     d->mDiscoveredFiles.erase(itRemovedDirectory);
+
+    d->mDirectoryCovers.remove(removedDirectory.toLocalFile());
+    d->mKnownDirectories.remove(removedDirectory);
+    d->mIndexedDirectories.remove(removedDirectory);
+    d->mRemovedDirectories.push_back(removedDirectory);
 }
 
 void AbstractFileListing::removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &allRemovedFiles)
@@ -458,9 +1122,27 @@ QHash<QUrl, QDateTime> &AbstractFileListing::allFiles()
 void AbstractFileListing::checkFilesToRemove()
 {
     QList<QUrl> allRemovedFiles;
+    QList<QUrl> allOfflineFiles;
+
+    auto offlinePathPrefixes = QStringList{};
+    for (const auto &oneRootPath : qAsConst(d->mOfflineRootPaths)) {
+        offlinePathPrefixes.push_back(QUrl::fromLocalFile(oneRootPath).toString() + QLatin1Char('/'));
+    }
 
     for (auto itFile = d->mAllFiles.begin(); itFile != d->mAllFiles.end(); ++itFile) {
-        allRemovedFiles.push_back(itFile.key());
+        const auto &fileName = itFile.key().toString();
+        const auto isOffline = std::any_of(offlinePathPrefixes.cbegin(), offlinePathPrefixes.cend(),
+                                           [&fileName](const auto &onePrefix) {return fileName.startsWith(onePrefix);});
+
+        if (isOffline) {
+            allOfflineFiles.push_back(itFile.key());
+        } else {
+            allRemovedFiles.push_back(itFile.key());
+        }
+    }
+
+    if (!allOfflineFiles.isEmpty()) {
+        Q_EMIT tracksOffline(allOfflineFiles);
     }
 
     if (!allRemovedFiles.isEmpty()) {
@@ -476,17 +1158,9 @@ FileScanner &AbstractFileListing::fileScanner()
 
 bool AbstractFileListing::checkEmbeddedCoverImage(const QString &localFileName)
 {
-#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
-    auto imageData = d->mImageScanner.imageData(localFileName);
-
-    if (imageData.contains(KFileMetaData::EmbeddedImageData::FrontCover)) {
-        if (!imageData[KFileMetaData::EmbeddedImageData::FrontCover].isEmpty()) {
-            return true;
-        }
-    }
-#endif
+    const auto &fileMimeType = d->mMimeDb.mimeTypeForFile(localFileName);
 
-    return false;
+    return d->mFileScanner.locateFrontCover(localFileName, fileMimeType.name()).isValid();
 }
 
 bool AbstractFileListing::waitEndTrackRemoval() const
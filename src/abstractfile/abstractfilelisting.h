@@ -21,6 +21,7 @@
 #include "elisaLib_export.h"
 
 #include "notificationitem.h"
+#include "databaseinterface.h"
 
 #include <QObject>
 #include <QString>
@@ -53,12 +54,20 @@ public:
 
     const QStringList& allRootPaths() const;
 
+    int directoryChangesCoalescingInterval() const;
+
+    void setDirectoryChangesCoalescingInterval(int interval);
+
 Q_SIGNALS:
 
     void tracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers);
 
     void removedTracksList(const QList<QUrl> &removedTracks);
 
+    void tracksOffline(const QList<QUrl> &offlineTracks);
+
+    void rootPathOnline(const QUrl &rootPath);
+
     void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers);
 
     void indexingStarted();
@@ -71,6 +80,9 @@ Q_SIGNALS:
 
     void askRestoredTracks();
 
+    void directoriesIndexed(const DatabaseInterface::DirectoriesDataType &indexedDirectories,
+                            const QList<QUrl> &removedDirectories);
+
     void errorWatchingFileSystemChanges();
 
 public Q_SLOTS:
@@ -81,6 +93,8 @@ public Q_SLOTS:
 
     void newTrackFile(const MusicAudioTrack &partialTrack);
 
+    void restoredDirectories(const DatabaseInterface::DirectoriesDataType &allDirectories);
+
     void restoredTracks(QHash<QUrl, QDateTime> allFiles);
 
     void setAllRootPaths(const QStringList &allRootPaths);
@@ -89,12 +103,18 @@ public Q_SLOTS:
 
     void databaseFinishedRemovingTracksList();
 
+    void setScalableFileSystemWatcher(bool useScalableWatcher);
+
 protected Q_SLOTS:
 
     void directoryChanged(const QString &path);
 
     void fileChanged(const QString &modifiedFileName);
 
+    void rootDirectoryRemoved(const QString &path);
+
+    void processChangedDirectories();
+
 protected:
 
     virtual void executeInit(QHash<QUrl, QDateTime> allFiles);
@@ -105,14 +125,20 @@ protected:
 
     virtual MusicAudioTrack scanOneFile(const QUrl &scanFile, const QFileInfo &scanFileInfo);
 
+    bool isNewOrModifiedAudioFile(const QUrl &scanFile, const QFileInfo &scanFileInfo);
+
     void watchPath(const QString &pathName);
 
+    void watchFile(const QString &fileName);
+
     void addFileInDirectory(const QUrl &newFile, const QUrl &directoryName);
 
     void scanDirectoryTree(const QString &path);
 
     void setHandleNewFiles(bool handleThem);
 
+    void setParallelMetadataExtraction(bool parallelExtraction);
+
     void emitNewFiles(const QList<MusicAudioTrack> &tracks);
 
     void addCover(const MusicAudioTrack &newTrack);
@@ -125,6 +151,8 @@ protected:
 
     void checkFilesToRemove();
 
+    bool isRootPathOffline(const QString &rootPath) const;
+
     FileScanner& fileScanner();
 
     bool checkEmbeddedCoverImage(const QString &localFileName);
@@ -137,6 +165,21 @@ protected:
 
 private:
 
+    bool isRootPathAvailable(const QString &rootPath) const;
+
+    bool restoreUnchangedDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path);
+
+    void addNewTrack(QList<MusicAudioTrack> &newFiles, const MusicAudioTrack &newTrack, const QUrl &directory);
+
+    void enqueueMetadataExtraction(QList<MusicAudioTrack> &newFiles, const QUrl &scanFile,
+                                   const QFileInfo &scanFileInfo, const QUrl &directory);
+
+    void processOnePendingExtraction(QList<MusicAudioTrack> &newFiles);
+
+    void processPendingExtractions(QList<MusicAudioTrack> &newFiles);
+
+    void finishDirectoryScan(QList<MusicAudioTrack> &newFiles);
+
     std::unique_ptr<AbstractFileListingPrivate> d;
 
 };
@@ -0,0 +1,350 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "inotifyfilesystemwatcher.h"
+
+#include "abstractfile/indexercommon.h"
+
+#include <QSocketNotifier>
+#include <QTimer>
+#include <QHash>
+#include <QSet>
+#include <QFile>
+#include <QFileInfo>
+#include <QDebug>
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+class InotifyFileSystemWatcherPrivate
+{
+public:
+
+    void handleEvent(const inotify_event &event);
+
+    void renameWatchedTree(const QString &oldDirectoryName, const QString &newDirectoryName);
+
+    void removeWatchedTree(const QString &directoryName);
+
+    void forgetWatchDescriptor(int watchDescriptor);
+
+    int mInotifyDescriptor = -1;
+
+    QSocketNotifier *mNotifier = nullptr;
+
+    QTimer *mCoalescingTimer = nullptr;
+
+    QHash<int, QString> mWatchedDirectories;
+
+    QHash<QString, int> mWatchDescriptors;
+
+    QHash<quint32, QString> mPendingMoves;
+
+    QSet<QString> mChangedDirectories;
+
+    QSet<QString> mChangedFiles;
+
+    QSet<QString> mCreatedFiles;
+
+    QSet<QString> mRemovedRootDirectories;
+
+};
+
+void InotifyFileSystemWatcherPrivate::handleEvent(const inotify_event &event)
+{
+    if (event.mask & IN_Q_OVERFLOW) {
+        qCInfo(orgKdeElisaIndexer()) << "InotifyFileSystemWatcher::readEvents" << "event queue overflow: rescan all watched directories";
+
+        for (const auto &oneDirectory : qAsConst(mWatchedDirectories)) {
+            mChangedDirectories.insert(oneDirectory);
+        }
+
+        return;
+    }
+
+    const auto itDirectory = mWatchedDirectories.constFind(event.wd);
+    if (itDirectory == mWatchedDirectories.constEnd()) {
+        return;
+    }
+
+    if (event.mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT)) {
+        // sub-directories are followed through the events of their watched parent
+        const auto parentDirectoryName = QFileInfo(*itDirectory).path();
+        if (!mWatchDescriptors.contains(parentDirectoryName)) {
+            mRemovedRootDirectories.insert(*itDirectory);
+        }
+
+        return;
+    }
+
+    if (event.mask & IN_IGNORED) {
+        forgetWatchDescriptor(event.wd);
+        return;
+    }
+
+    if (event.len == 0) {
+        return;
+    }
+
+    const auto directoryName = *itDirectory;
+    const auto entryPath = QString(directoryName + QLatin1Char('/') + QFile::decodeName(event.name));
+    const auto isDirectory = (event.mask & IN_ISDIR) != 0;
+
+    if (event.mask & IN_CLOSE_WRITE) {
+        if (!mCreatedFiles.contains(entryPath)) {
+            mChangedFiles.insert(entryPath);
+        }
+
+        return;
+    }
+
+    mChangedDirectories.insert(directoryName);
+
+    if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+        if (!isDirectory) {
+            mCreatedFiles.insert(entryPath);
+            mChangedFiles.remove(entryPath);
+        } else if (event.mask & IN_MOVED_TO) {
+            const auto itMove = mPendingMoves.find(event.cookie);
+            if (itMove != mPendingMoves.end()) {
+                renameWatchedTree(*itMove, entryPath);
+                mPendingMoves.erase(itMove);
+            }
+        }
+    } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+        if (!isDirectory) {
+            mChangedFiles.remove(entryPath);
+        } else if (event.mask & IN_MOVED_FROM) {
+            mPendingMoves[event.cookie] = entryPath;
+        }
+    }
+}
+
+void InotifyFileSystemWatcherPrivate::renameWatchedTree(const QString &oldDirectoryName, const QString &newDirectoryName)
+{
+    const auto oldDirectoryPrefix = QString(oldDirectoryName + QLatin1Char('/'));
+
+    for (auto itDirectory = mWatchedDirectories.begin(); itDirectory != mWatchedDirectories.end(); ++itDirectory) {
+        if (*itDirectory != oldDirectoryName && !itDirectory->startsWith(oldDirectoryPrefix)) {
+            continue;
+        }
+
+        mWatchDescriptors.remove(*itDirectory);
+        itDirectory->replace(0, oldDirectoryName.size(), newDirectoryName);
+        mWatchDescriptors[*itDirectory] = itDirectory.key();
+    }
+}
+
+void InotifyFileSystemWatcherPrivate::removeWatchedTree(const QString &directoryName)
+{
+    const auto directoryPrefix = QString(directoryName + QLatin1Char('/'));
+
+    auto removedWatchDescriptors = QList<int>();
+    for (auto itDirectory = mWatchedDirectories.cbegin(); itDirectory != mWatchedDirectories.cend(); ++itDirectory) {
+        if (*itDirectory == directoryName || itDirectory->startsWith(directoryPrefix)) {
+            removedWatchDescriptors.push_back(itDirectory.key());
+        }
+    }
+
+    for (auto oneWatchDescriptor : removedWatchDescriptors) {
+        inotify_rm_watch(mInotifyDescriptor, oneWatchDescriptor);
+        forgetWatchDescriptor(oneWatchDescriptor);
+    }
+}
+
+void InotifyFileSystemWatcherPrivate::forgetWatchDescriptor(int watchDescriptor)
+{
+    const auto itDirectory = mWatchedDirectories.find(watchDescriptor);
+    if (itDirectory == mWatchedDirectories.end()) {
+        return;
+    }
+
+    mWatchDescriptors.remove(*itDirectory);
+    mWatchedDirectories.erase(itDirectory);
+}
+
+InotifyFileSystemWatcher::InotifyFileSystemWatcher(QObject *parent) : QObject(parent), d(std::make_unique<InotifyFileSystemWatcherPrivate>())
+{
+    d->mCoalescingTimer = new QTimer(this);
+    d->mCoalescingTimer->setSingleShot(true);
+    d->mCoalescingTimer->setInterval(250);
+
+    connect(d->mCoalescingTimer, &QTimer::timeout,
+            this, &InotifyFileSystemWatcher::emitPendingChanges);
+
+    d->mInotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (d->mInotifyDescriptor == -1) {
+        qCInfo(orgKdeElisaIndexer()) << "InotifyFileSystemWatcher::InotifyFileSystemWatcher" << "inotify is not available" << std::strerror(errno);
+        return;
+    }
+
+    d->mNotifier = new QSocketNotifier(d->mInotifyDescriptor, QSocketNotifier::Read, this);
+
+    connect(d->mNotifier, &QSocketNotifier::activated,
+            this, &InotifyFileSystemWatcher::readEvents);
+}
+
+InotifyFileSystemWatcher::~InotifyFileSystemWatcher()
+{
+    if (d->mInotifyDescriptor != -1) {
+        ::close(d->mInotifyDescriptor);
+    }
+}
+
+bool InotifyFileSystemWatcher::isValid() const
+{
+    return d->mInotifyDescriptor != -1;
+}
+
+bool InotifyFileSystemWatcher::addPath(const QString &directoryName)
+{
+    if (d->mInotifyDescriptor == -1) {
+        return false;
+    }
+
+    if (d->mWatchDescriptors.contains(directoryName)) {
+        return true;
+    }
+
+    const auto watchDescriptor = inotify_add_watch(d->mInotifyDescriptor, QFile::encodeName(directoryName).constData(),
+                                                   IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                                   IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+
+    if (watchDescriptor == -1) {
+        qCDebug(orgKdeElisaIndexer) << "InotifyFileSystemWatcher::addPath" << directoryName << std::strerror(errno);
+        return false;
+    }
+
+    d->forgetWatchDescriptor(watchDescriptor);
+
+    d->mWatchedDirectories[watchDescriptor] = directoryName;
+    d->mWatchDescriptors[directoryName] = watchDescriptor;
+
+    return true;
+}
+
+bool InotifyFileSystemWatcher::removePath(const QString &directoryName)
+{
+    const auto itWatchDescriptor = d->mWatchDescriptors.find(directoryName);
+    if (itWatchDescriptor == d->mWatchDescriptors.end()) {
+        return false;
+    }
+
+    const auto watchDescriptor = *itWatchDescriptor;
+
+    inotify_rm_watch(d->mInotifyDescriptor, watchDescriptor);
+    d->forgetWatchDescriptor(watchDescriptor);
+
+    return true;
+}
+
+void InotifyFileSystemWatcher::removeAllPaths()
+{
+    for (auto itDirectory = d->mWatchedDirectories.cbegin(); itDirectory != d->mWatchedDirectories.cend(); ++itDirectory) {
+        inotify_rm_watch(d->mInotifyDescriptor, itDirectory.key());
+    }
+
+    d->mWatchedDirectories.clear();
+    d->mWatchDescriptors.clear();
+    d->mPendingMoves.clear();
+    d->mRemovedRootDirectories.clear();
+}
+
+QStringList InotifyFileSystemWatcher::directories() const
+{
+    return d->mWatchDescriptors.keys();
+}
+
+bool InotifyFileSystemWatcher::isWatched(const QString &directoryName) const
+{
+    return d->mWatchDescriptors.contains(directoryName);
+}
+
+int InotifyFileSystemWatcher::coalescingInterval() const
+{
+    return d->mCoalescingTimer->interval();
+}
+
+void InotifyFileSystemWatcher::setCoalescingInterval(int interval)
+{
+    d->mCoalescingTimer->setInterval(interval);
+}
+
+void InotifyFileSystemWatcher::readEvents()
+{
+    alignas(inotify_event) char eventsBuffer[4096];
+
+    while (true) {
+        const auto readBytes = ::read(d->mInotifyDescriptor, eventsBuffer, sizeof(eventsBuffer));
+
+        if (readBytes <= 0) {
+            break;
+        }
+
+        for (auto position = ssize_t(0); position < readBytes; ) {
+            const auto &oneEvent = *reinterpret_cast<const inotify_event*>(eventsBuffer + position);
+
+            d->handleEvent(oneEvent);
+
+            position += sizeof(inotify_event) + oneEvent.len;
+        }
+    }
+
+    if (!d->mCoalescingTimer->isActive() &&
+            (!d->mChangedDirectories.isEmpty() || !d->mChangedFiles.isEmpty() ||
+             !d->mPendingMoves.isEmpty() || !d->mRemovedRootDirectories.isEmpty())) {
+        d->mCoalescingTimer->start();
+    }
+}
+
+void InotifyFileSystemWatcher::emitPendingChanges()
+{
+    for (const auto &oneMovedDirectory : qAsConst(d->mPendingMoves)) {
+        d->removeWatchedTree(oneMovedDirectory);
+    }
+    d->mPendingMoves.clear();
+
+    const auto removedRootDirectories = std::exchange(d->mRemovedRootDirectories, {});
+    for (const auto &oneRemovedDirectory : removedRootDirectories) {
+        d->removeWatchedTree(oneRemovedDirectory);
+    }
+
+    const auto changedDirectories = std::exchange(d->mChangedDirectories, {});
+    const auto changedFiles = std::exchange(d->mChangedFiles, {});
+    d->mCreatedFiles.clear();
+
+    for (const auto &oneDirectory : changedDirectories) {
+        Q_EMIT directoryChanged(oneDirectory);
+    }
+
+    for (const auto &oneFile : changedFiles) {
+        Q_EMIT fileChanged(oneFile);
+    }
+
+    for (const auto &oneRemovedDirectory : removedRootDirectories) {
+        Q_EMIT watchedDirectoryRemoved(oneRemovedDirectory);
+    }
+}
+
+
+#include "moc_inotifyfilesystemwatcher.cpp"
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef INOTIFYFILESYSTEMWATCHER_H
+#define INOTIFYFILESYSTEMWATCHER_H
+
+#include "elisaLib_export.h"
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+#include <memory>
+
+class InotifyFileSystemWatcherPrivate;
+
+class ELISALIB_EXPORT InotifyFileSystemWatcher : public QObject
+{
+
+    Q_OBJECT
+
+public:
+
+    explicit InotifyFileSystemWatcher(QObject *parent = nullptr);
+
+    ~InotifyFileSystemWatcher() override;
+
+    bool isValid() const;
+
+    bool addPath(const QString &directoryName);
+
+    bool removePath(const QString &directoryName);
+
+    void removeAllPaths();
+
+    QStringList directories() const;
+
+    bool isWatched(const QString &directoryName) const;
+
+    int coalescingInterval() const;
+
+    void setCoalescingInterval(int interval);
+
+Q_SIGNALS:
+
+    void directoryChanged(const QString &path);
+
+    void fileChanged(const QString &path);
+
+    void watchedDirectoryRemoved(const QString &path);
+
+private Q_SLOTS:
+
+    void readEvents();
+
+    void emitPendingChanges();
+
+private:
+
+    std::unique_ptr<InotifyFileSystemWatcherPrivate> d;
+
+};
+
+#endif // INOTIFYFILESYSTEMWATCHER_H
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "albumartimageprovider.h"
+
+AlbumArtImageProvider::AlbumArtImageProvider()
+    : QQuickImageProvider(QQuickImageProvider::Image, QQmlImageProviderBase::ForceAsynchronousImageLoading),
+      mStore(AlbumArtStore::defaultPackFileName())
+{
+}
+
+QImage AlbumArtImageProvider::requestImage(const QString &id, QSize *size, const QSize &requestedSize)
+{
+    auto result = mStore.image(id, requestedSize);
+
+    if (!result.isNull() && requestedSize.isValid() &&
+            (result.width() > requestedSize.width() || result.height() > requestedSize.height())) {
+        result = result.scaled(requestedSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    if (size) {
+        *size = result.size();
+    }
+
+    return result;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ALBUMARTIMAGEPROVIDER_H
+#define ALBUMARTIMAGEPROVIDER_H
+
+#include "albumartstore.h"
+
+#include <QQuickImageProvider>
+
+class AlbumArtImageProvider : public QQuickImageProvider
+{
+public:
+
+    AlbumArtImageProvider();
+
+    QImage requestImage(const QString &id, QSize *size, const QSize &requestedSize) override;
+
+private:
+
+    AlbumArtStore mStore;
+
+};
+
+#endif // ALBUMARTIMAGEPROVIDER_H
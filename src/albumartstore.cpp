@@ -0,0 +1,387 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "albumartstore.h"
+
+#include "databaseLogging.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QUuid>
+#include <QBuffer>
+#include <QDataStream>
+#include <QImageReader>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QHash>
+#include <QVector>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QDebug>
+
+#include <algorithm>
+
+namespace {
+
+constexpr quint32 RecordMagic = 0x45415254;
+
+constexpr int KeyLength = 20;
+
+// magic, key, thumbnail size and data length
+constexpr int RecordHeaderLength = 4 + KeyLength + 4 + 4;
+
+// a record of this size holds the identifier written at the start of a compacted pack
+constexpr qint32 PackIdPixelSize = 0;
+
+// compacting a smaller pack is not worth rewriting it
+constexpr qint64 MinimumDeadLength = 4 * 1024 * 1024;
+
+QByteArray packRecord(const QByteArray &key, qint32 pixelSize, const QByteArray &data)
+{
+    QByteArray record;
+    QDataStream recordStream(&record, QIODevice::WriteOnly);
+    recordStream << RecordMagic;
+    recordStream.writeRawData(key.constData(), KeyLength);
+    recordStream << pixelSize << qint32(data.size());
+    recordStream.writeRawData(data.constData(), data.size());
+
+    return record;
+}
+
+QByteArray readPackId(QIODevice &pack)
+{
+    QDataStream header(pack.read(RecordHeaderLength));
+
+    auto magic = quint32{0};
+    auto key = QByteArray(KeyLength, Qt::Uninitialized);
+    auto pixelSize = qint32{0};
+    auto length = qint32{0};
+
+    header >> magic;
+    header.readRawData(key.data(), KeyLength);
+    header >> pixelSize >> length;
+
+    if (header.status() != QDataStream::Ok || magic != RecordMagic || pixelSize != PackIdPixelSize || length <= 0) {
+        return {};
+    }
+
+    return pack.read(length);
+}
+
+}
+
+class AlbumArtStorePrivate
+{
+public:
+
+    class Thumbnail
+    {
+    public:
+
+        qint32 mPixelSize = 0;
+
+        qint64 mOffset = 0;
+
+        qint32 mLength = 0;
+
+    };
+
+    explicit AlbumArtStorePrivate(QString packFileName) : mPackFile(std::move(packFileName))
+    {
+    }
+
+    void refreshIndex();
+
+    void resetIndex();
+
+    QFile mPackFile;
+
+    QMutex mMutex;
+
+    qint64 mIndexedEnd = 0;
+
+    QByteArray mPackId;
+
+    QHash<QByteArray, QVector<Thumbnail>> mIndex;
+
+};
+
+void AlbumArtStorePrivate::resetIndex()
+{
+    mPackFile.close();
+    mIndex.clear();
+    mIndexedEnd = 0;
+    mPackId.clear();
+}
+
+void AlbumArtStorePrivate::refreshIndex()
+{
+    // another instance may have replaced the file with a compacted one
+    if (mPackFile.isOpen()) {
+        QFile currentPackFile(mPackFile.fileName());
+        if (currentPackFile.open(QIODevice::ReadOnly) && readPackId(currentPackFile) != mPackId) {
+            resetIndex();
+        }
+    }
+
+    if (!mPackFile.isOpen() && !mPackFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    const auto packSize = mPackFile.size();
+
+    while (mIndexedEnd + RecordHeaderLength <= packSize) {
+        if (!mPackFile.seek(mIndexedEnd)) {
+            return;
+        }
+
+        QDataStream header(mPackFile.read(RecordHeaderLength));
+
+        auto magic = quint32{0};
+        auto key = QByteArray(KeyLength, Qt::Uninitialized);
+        auto pixelSize = qint32{0};
+        auto length = qint32{0};
+
+        header >> magic;
+        header.readRawData(key.data(), KeyLength);
+        header >> pixelSize >> length;
+
+        // a record still being written by another instance is picked up on a later refresh
+        if (header.status() != QDataStream::Ok || magic != RecordMagic || length <= 0 ||
+                mIndexedEnd + RecordHeaderLength + length > packSize) {
+            return;
+        }
+
+        if (pixelSize == PackIdPixelSize) {
+            if (mIndexedEnd == 0) {
+                mPackId = mPackFile.read(length);
+            }
+        } else {
+            mIndex[key].push_back({pixelSize, mIndexedEnd + RecordHeaderLength, length});
+        }
+
+        mIndexedEnd += RecordHeaderLength + length;
+    }
+}
+
+AlbumArtStore::AlbumArtStore(QString packFileName) : d(std::make_unique<AlbumArtStorePrivate>(std::move(packFileName)))
+{
+}
+
+AlbumArtStore::~AlbumArtStore()
+= default;
+
+QString AlbumArtStore::defaultPackFileName()
+{
+    const auto &localDataPaths = QStandardPaths::standardLocations(QStandardPaths::AppDataLocation);
+    if (localDataPaths.isEmpty()) {
+        return {};
+    }
+
+    return localDataPaths.first() + QStringLiteral("/elisaAlbumArt.pack");
+}
+
+QString AlbumArtStore::insert(const QByteArray &sourceImageData)
+{
+    if (sourceImageData.isEmpty()) {
+        return {};
+    }
+
+    const auto &key = QCryptographicHash::hash(sourceImageData, QCryptographicHash::Sha1);
+
+    QMutexLocker lock(&d->mMutex);
+
+    d->refreshIndex();
+
+    if (d->mIndex.contains(key)) {
+        return QString::fromLatin1(key.toHex());
+    }
+
+    auto sourceData = sourceImageData;
+    QBuffer sourceBuffer(&sourceData);
+    sourceBuffer.open(QIODevice::ReadOnly);
+
+    QImageReader sourceReader(&sourceBuffer);
+
+    const auto &fullSize = sourceReader.size();
+    if (fullSize.isValid() && (fullSize.width() > HeaderSize || fullSize.height() > HeaderSize)) {
+        sourceReader.setScaledSize(fullSize.scaled(HeaderSize, HeaderSize, Qt::KeepAspectRatio));
+    }
+
+    const auto &headerImage = sourceReader.read();
+    if (headerImage.isNull()) {
+        qCDebug(orgKdeElisaDatabase()) << "AlbumArtStore::insert" << "cannot decode cover" << sourceReader.errorString();
+        return {};
+    }
+
+    auto thumbnails = QList<QPair<qint32, QImage>>{};
+    if (std::max(headerImage.width(), headerImage.height()) > GridSize) {
+        thumbnails.push_back({GridSize, headerImage.scaled(GridSize, GridSize, Qt::KeepAspectRatio, Qt::SmoothTransformation)});
+        thumbnails.push_back({HeaderSize, headerImage});
+    } else {
+        thumbnails.push_back({GridSize, headerImage});
+    }
+
+    QFile packFile(d->mPackFile.fileName());
+    if (!packFile.open(QIODevice::ReadWrite)) {
+        qCInfo(orgKdeElisaDatabase()) << "AlbumArtStore::insert" << packFile.fileName() << packFile.errorString();
+        return {};
+    }
+
+    // drop the tail left by an interrupted write
+    if (packFile.size() > d->mIndexedEnd) {
+        packFile.resize(d->mIndexedEnd);
+    }
+
+    packFile.seek(d->mIndexedEnd);
+
+    for (const auto &oneThumbnail : qAsConst(thumbnails)) {
+        QByteArray encodedThumbnail;
+        QBuffer encodedBuffer(&encodedThumbnail);
+        encodedBuffer.open(QIODevice::WriteOnly);
+        oneThumbnail.second.save(&encodedBuffer, oneThumbnail.second.hasAlphaChannel() ? "PNG" : "JPG", 90);
+
+        const auto &record = packRecord(key, oneThumbnail.first, encodedThumbnail);
+
+        if (packFile.write(record) != record.size()) {
+            qCInfo(orgKdeElisaDatabase()) << "AlbumArtStore::insert" << packFile.fileName() << packFile.errorString();
+            return {};
+        }
+    }
+
+    packFile.close();
+
+    // the read-only handle may have been opened on an empty file
+    d->mPackFile.close();
+    d->refreshIndex();
+
+    return d->mIndex.contains(key) ? QString::fromLatin1(key.toHex()) : QString();
+}
+
+bool AlbumArtStore::contains(const QString &key)
+{
+    const auto &rawKey = QByteArray::fromHex(key.toLatin1());
+
+    QMutexLocker lock(&d->mMutex);
+
+    if (!d->mIndex.contains(rawKey)) {
+        d->refreshIndex();
+    }
+
+    return d->mIndex.contains(rawKey);
+}
+
+QImage AlbumArtStore::image(const QString &key, const QSize &requestedSize)
+{
+    const auto &rawKey = QByteArray::fromHex(key.toLatin1());
+    const auto requestedExtent = std::max(requestedSize.width(), requestedSize.height());
+
+    QByteArray encodedThumbnail;
+
+    {
+        QMutexLocker lock(&d->mMutex);
+
+        auto itThumbnails = d->mIndex.constFind(rawKey);
+        if (itThumbnails == d->mIndex.constEnd()) {
+            d->refreshIndex();
+
+            itThumbnails = d->mIndex.constFind(rawKey);
+            if (itThumbnails == d->mIndex.constEnd()) {
+                return {};
+            }
+        }
+
+        const auto &allThumbnails = itThumbnails.value();
+
+        auto selectedThumbnail = std::max_element(allThumbnails.cbegin(), allThumbnails.cend(),
+                                                  [](const auto &left, const auto &right) {return left.mPixelSize < right.mPixelSize;});
+        for (auto itThumbnail = allThumbnails.cbegin(); itThumbnail != allThumbnails.cend(); ++itThumbnail) {
+            if (itThumbnail->mPixelSize >= requestedExtent && itThumbnail->mPixelSize < selectedThumbnail->mPixelSize) {
+                selectedThumbnail = itThumbnail;
+            }
+        }
+
+        if (!d->mPackFile.seek(selectedThumbnail->mOffset)) {
+            return {};
+        }
+
+        encodedThumbnail = d->mPackFile.read(selectedThumbnail->mLength);
+    }
+
+    return QImage::fromData(encodedThumbnail);
+}
+
+bool AlbumArtStore::compact(const QSet<QString> &liveKeys)
+{
+    QMutexLocker lock(&d->mMutex);
+
+    d->refreshIndex();
+
+    auto liveRawKeys = QList<QByteArray>{};
+    auto liveLength = qint64{0};
+
+    for (const auto &oneKey : liveKeys) {
+        const auto &rawKey = QByteArray::fromHex(oneKey.toLatin1());
+
+        const auto itThumbnails = d->mIndex.constFind(rawKey);
+        if (itThumbnails == d->mIndex.constEnd()) {
+            continue;
+        }
+
+        liveRawKeys.push_back(rawKey);
+        for (const auto &oneThumbnail : itThumbnails.value()) {
+            liveLength += RecordHeaderLength + oneThumbnail.mLength;
+        }
+    }
+
+    const auto deadLength = d->mIndexedEnd - liveLength;
+    if (deadLength < MinimumDeadLength || deadLength < liveLength) {
+        return false;
+    }
+
+    QSaveFile compactedFile(d->mPackFile.fileName());
+    if (!compactedFile.open(QIODevice::WriteOnly)) {
+        qCInfo(orgKdeElisaDatabase()) << "AlbumArtStore::compact" << compactedFile.fileName() << compactedFile.errorString();
+        return false;
+    }
+
+    compactedFile.write(packRecord(QByteArray(KeyLength, '\0'), PackIdPixelSize, QUuid::createUuid().toRfc4122()));
+
+    for (const auto &oneKey : qAsConst(liveRawKeys)) {
+        for (const auto &oneThumbnail : d->mIndex[oneKey]) {
+            if (!d->mPackFile.seek(oneThumbnail.mOffset)) {
+                compactedFile.cancelWriting();
+                break;
+            }
+
+            compactedFile.write(packRecord(oneKey, oneThumbnail.mPixelSize, d->mPackFile.read(oneThumbnail.mLength)));
+        }
+    }
+
+    if (!compactedFile.commit()) {
+        qCInfo(orgKdeElisaDatabase()) << "AlbumArtStore::compact" << compactedFile.fileName() << compactedFile.errorString();
+        return false;
+    }
+
+    qCInfo(orgKdeElisaDatabase()) << "AlbumArtStore::compact" << d->mIndexedEnd << "bytes before" << liveLength << "bytes of live covers";
+
+    d->resetIndex();
+    d->refreshIndex();
+
+    return true;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef ALBUMARTSTORE_H
+#define ALBUMARTSTORE_H
+
+#include "elisaLib_export.h"
+
+#include <QString>
+#include <QByteArray>
+#include <QImage>
+#include <QSize>
+#include <QSet>
+
+#include <memory>
+
+class AlbumArtStorePrivate;
+
+/**
+ * Album covers rendered at the grid and header sizes and appended to a single pack file.
+ * A cover is keyed by the hash of its encoded source so identical artwork shared by
+ * several albums is stored once. The database thread writes to the store while the
+ * image provider reads from its own instance of the same file.
+ */
+class ELISALIB_EXPORT AlbumArtStore
+{
+
+public:
+
+    static constexpr int GridSize = 256;
+
+    static constexpr int HeaderSize = 512;
+
+    explicit AlbumArtStore(QString packFileName);
+
+    ~AlbumArtStore();
+
+    static QString defaultPackFileName();
+
+    /**
+     * Store the thumbnails of an encoded cover and return its key, or an empty string
+     * when the data cannot be decoded.
+     */
+    QString insert(const QByteArray &sourceImageData);
+
+    bool contains(const QString &key);
+
+    /**
+     * Return the smallest stored thumbnail covering requestedSize, or the largest one.
+     */
+    QImage image(const QString &key, const QSize &requestedSize);
+
+    /**
+     * Rewrite the pack file with only the thumbnails of liveKeys once most of it is
+     * made of covers no album uses anymore. Other instances reload the new file on
+     * their next miss. Return true when the file has been rewritten.
+     */
+    bool compact(const QSet<QString> &liveKeys);
+
+private:
+
+    std::unique_ptr<AlbumArtStorePrivate> d;
+
+};
+
+#endif // ALBUMARTSTORE_H
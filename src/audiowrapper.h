@@ -48,6 +48,11 @@ class ELISALIB_EXPORT AudioWrapper : public QObject
                WRITE setSource
                NOTIFY sourceChanged)
 
+    Q_PROPERTY(QUrl nextSource
+               READ nextSource
+               WRITE setNextSource
+               NOTIFY nextSourceChanged)
+
     Q_PROPERTY(QMediaPlayer::MediaStatus status
                READ status
                NOTIFY statusChanged)
@@ -80,6 +85,11 @@ class ELISALIB_EXPORT AudioWrapper : public QObject
 
 public:
 
+    /**
+     * Remaining playback time of the current source at which the next source is preloaded.
+     */
+    static constexpr qint64 PreloadDelay = 5000;
+
     explicit AudioWrapper(QObject *parent = nullptr);
 
     ~AudioWrapper() override;
@@ -90,6 +100,8 @@ public:
 
     QUrl source() const;
 
+    QUrl nextSource() const;
+
     QMediaPlayer::MediaStatus status() const;
 
     QMediaPlayer::State playbackState() const;
@@ -112,6 +124,14 @@ Q_SIGNALS:
 
     void sourceChanged();
 
+    void nextSourceChanged();
+
+    /**
+     * Playback continued on the preloaded next source without going through EndOfMedia.
+     * The next call to setSource() with this source is ignored.
+     */
+    void sourceAdvanced(const QUrl &source);
+
     void statusChanged(QMediaPlayer::MediaStatus status);
 
     void playbackStateChanged(QMediaPlayer::State state);
@@ -140,6 +160,8 @@ public Q_SLOTS:
 
     void setSource(const QUrl &source);
 
+    void setNextSource(const QUrl &nextSource);
+
     void setPosition(qint64 position);
 
     void saveUndoPosition(qint64 position);
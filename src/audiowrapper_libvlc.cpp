@@ -24,6 +24,8 @@
 #include <QAudio>
 #include <QDir>
 
+#include <atomic>
+
 #if defined Q_OS_WIN
 
 #include <basetsd.h>
@@ -52,6 +54,12 @@ public:
 
     libvlc_media_t *mMedia = nullptr;
 
+    libvlc_media_t *mNextMedia = nullptr;
+
+    QUrl mNextSource;
+
+    QUrl mAdvancedSource;
+
     qint64 mMediaDuration = 0;
 
     QMediaPlayer::State mPreviousPlayerState = QMediaPlayer::StoppedState;
@@ -74,10 +82,21 @@ public:
 
     bool mHasSavedPosition = false;
 
+    // set from the libvlc event thread, read and reset from the main thread
+    std::atomic<bool> mNextMediaRequested{false};
+
     void vlcEventCallback(const struct libvlc_event_t *p_event);
 
     void mediaIsEnded();
 
+    libvlc_media_t* createMedia(const QUrl &source) const;
+
+    void preloadNextMedia();
+
+    bool startNextMedia();
+
+    void releaseNextMedia();
+
     bool signalPlaybackChange(QMediaPlayer::State newPlayerState);
 
     void signalMediaStatusChange(QMediaPlayer::MediaStatus newMediaStatus);
@@ -135,6 +154,8 @@ AudioWrapper::AudioWrapper(QObject *parent) : QObject(parent), d(std::make_uniqu
 
 AudioWrapper::~AudioWrapper()
 {
+    d->releaseNextMedia();
+
     if (d->mInstance) {
         libvlc_release(d->mInstance);
     }
@@ -163,6 +184,11 @@ QUrl AudioWrapper::source() const
     return {}/*d->mPlayer.media().canonicalUrl()*/;
 }
 
+QUrl AudioWrapper::nextSource() const
+{
+    return d->mNextSource;
+}
+
 QMediaPlayer::Error AudioWrapper::error() const
 {
     return d->mError;
@@ -231,23 +257,25 @@ void AudioWrapper::setVolume(qreal volume)
 
 void AudioWrapper::setSource(const QUrl &source)
 {
-    d->mMedia = libvlc_media_new_path(d->mInstance, QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData());
-    if (!d->mMedia) {
-        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource"
-                 << "failed creating media"
-                 << libvlc_errmsg()
-                 << QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData();
+    if (!d->mAdvancedSource.isEmpty() && source == d->mAdvancedSource) {
+        d->mAdvancedSource.clear();
+        return;
+    }
+
+    d->mAdvancedSource.clear();
 
-        d->mMedia = libvlc_media_new_path(d->mInstance, QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData());
+    if (d->mNextMedia && source == d->mNextSource) {
+        d->mMedia = d->mNextMedia;
+        d->mNextMedia = nullptr;
+    } else {
+        d->mMedia = d->createMedia(source);
         if (!d->mMedia) {
-            qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapper::setSource"
-                     << "failed creating media"
-                     << libvlc_errmsg()
-                     << QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData();
             return;
         }
     }
 
+    d->mNextMediaRequested = false;
+
     libvlc_media_player_set_media(d->mPlayer, d->mMedia);
 
     if (d->signalPlaybackChange(QMediaPlayer::StoppedState)) {
@@ -259,6 +287,21 @@ void AudioWrapper::setSource(const QUrl &source)
     d->signalMediaStatusChange(QMediaPlayer::BufferedMedia);
 }
 
+void AudioWrapper::setNextSource(const QUrl &nextSource)
+{
+    if (d->mNextSource == nextSource) {
+        return;
+    }
+
+    d->releaseNextMedia();
+    d->mNextSource = nextSource;
+    Q_EMIT nextSourceChanged();
+
+    if (d->mNextMediaRequested) {
+        d->preloadNextMedia();
+    }
+}
+
 void AudioWrapper::setPosition(qint64 position)
 {
     if (!d->mPlayer) {
@@ -317,6 +360,8 @@ void AudioWrapper::stop()
         return;
     }
 
+    d->mAdvancedSource.clear();
+
     libvlc_media_player_stop(d->mPlayer);
 }
 
@@ -431,10 +476,15 @@ void AudioWrapperPrivate::vlcEventCallback(const struct libvlc_event_t *p_event)
         break;
     case libvlc_MediaPlayerEndReached:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerEndReached";
-        signalMediaStatusChange(QMediaPlayer::BufferedMedia);
-        signalMediaStatusChange(QMediaPlayer::NoMedia);
-        signalMediaStatusChange(QMediaPlayer::EndOfMedia);
-        mediaIsEnded();
+        // the player cannot be driven from inside one of its callbacks
+        QMetaObject::invokeMethod(mParent, [this]() {
+            mediaIsEnded();
+            if (!startNextMedia()) {
+                signalMediaStatusChange(QMediaPlayer::BufferedMedia);
+                signalMediaStatusChange(QMediaPlayer::NoMedia);
+                signalMediaStatusChange(QMediaPlayer::EndOfMedia);
+            }
+        }, Qt::QueuedConnection);
         break;
     case libvlc_MediaPlayerEncounteredError:
         qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::vlcEventCallback" << "libvlc_MediaPlayerEncounteredError";
@@ -485,6 +535,79 @@ void AudioWrapperPrivate::mediaIsEnded()
     mMedia = nullptr;
 }
 
+libvlc_media_t* AudioWrapperPrivate::createMedia(const QUrl &source) const
+{
+    auto newMedia = libvlc_media_new_path(mInstance, QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData());
+    if (!newMedia) {
+        qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia"
+                 << "failed creating media"
+                 << libvlc_errmsg()
+                 << QDir::toNativeSeparators(source.toLocalFile()).toUtf8().constData();
+
+        newMedia = libvlc_media_new_path(mInstance, QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData());
+        if (!newMedia) {
+            qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::createMedia"
+                     << "failed creating media"
+                     << libvlc_errmsg()
+                     << QDir::toNativeSeparators(source.toLocalFile()).toLatin1().constData();
+        }
+    }
+
+    return newMedia;
+}
+
+void AudioWrapperPrivate::preloadNextMedia()
+{
+    if (mNextMedia || !mNextSource.isLocalFile()) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::preloadNextMedia" << mNextSource;
+
+    mNextMedia = createMedia(mNextSource);
+    if (!mNextMedia) {
+        return;
+    }
+
+    // opens the file and reads its headers ahead so that the switch does not start cold
+#if LIBVLC_VERSION_INT >= LIBVLC_VERSION(3, 0, 0, 0)
+    libvlc_media_parse_with_options(mNextMedia, libvlc_media_parse_local, -1);
+#else
+    libvlc_media_parse_async(mNextMedia);
+#endif
+}
+
+bool AudioWrapperPrivate::startNextMedia()
+{
+    if (!mNextMedia || !mPlayer) {
+        return false;
+    }
+
+    qCDebug(orgKdeElisaPlayerVlc) << "AudioWrapperPrivate::startNextMedia" << mNextSource;
+
+    const auto advancedSource = mNextSource;
+
+    mAdvancedSource = advancedSource;
+    mMedia = mNextMedia;
+    mNextMedia = nullptr;
+    mNextMediaRequested = false;
+
+    libvlc_media_player_set_media(mPlayer, mMedia);
+    libvlc_media_player_play(mPlayer);
+
+    Q_EMIT mParent->sourceAdvanced(advancedSource);
+
+    return true;
+}
+
+void AudioWrapperPrivate::releaseNextMedia()
+{
+    if (mNextMedia) {
+        libvlc_media_release(mNextMedia);
+        mNextMedia = nullptr;
+    }
+}
+
 bool AudioWrapperPrivate::signalPlaybackChange(QMediaPlayer::State newPlayerState)
 {
     if (mPreviousPlayerState != newPlayerState) {
@@ -550,6 +673,11 @@ void AudioWrapperPrivate::signalPositionChange(float newPosition)
 
     auto computedPosition = qRound64(newPosition * mMediaDuration);
 
+    if (mMediaDuration > 0 && mMediaDuration - computedPosition <= AudioWrapper::PreloadDelay &&
+            !mNextMediaRequested.exchange(true)) {
+        QMetaObject::invokeMethod(mParent, [this]() {preloadNextMedia();}, Qt::QueuedConnection);
+    }
+
     if (mPreviousPosition != computedPosition) {
         mPreviousPosition = computedPosition;
 
@@ -22,6 +22,8 @@
 #include <QTimer>
 #include <QAudio>
 
+#include <utility>
+
 #include "config-upnp-qt.h"
 
 class AudioWrapperPrivate
@@ -29,7 +31,15 @@ class AudioWrapperPrivate
 
 public:
 
-    QMediaPlayer mPlayer;
+    AudioWrapper *mParent = nullptr;
+
+    std::unique_ptr<QMediaPlayer> mPlayer = std::make_unique<QMediaPlayer>();
+
+    std::unique_ptr<QMediaPlayer> mNextPlayer;
+
+    QUrl mNextSource;
+
+    QUrl mAdvancedSource;
 
     qint64 mSavedPosition = 0.0;
 
@@ -37,21 +47,116 @@ public:
 
     bool mHasSavedPosition = false;
 
+    void connectPlayer();
+
+    bool isNearEnd() const;
+
+    void preloadNextPlayer();
+
+    bool startNextPlayer();
+
 };
 
+void AudioWrapperPrivate::connectPlayer()
+{
+    auto *player = mPlayer.get();
+
+    QObject::connect(player, &QMediaPlayer::mutedChanged, mParent, &AudioWrapper::playerMutedChanged);
+    QObject::connect(player, &QMediaPlayer::volumeChanged, mParent, &AudioWrapper::playerVolumeChanged);
+    QObject::connect(player, &QMediaPlayer::mediaChanged, mParent, &AudioWrapper::sourceChanged);
+    QObject::connect(player, &QMediaPlayer::mediaStatusChanged, mParent, [this](QMediaPlayer::MediaStatus status) {
+        if (status == QMediaPlayer::EndOfMedia && startNextPlayer()) {
+            return;
+        }
+        Q_EMIT mParent->statusChanged(status);
+    });
+    QObject::connect(player, &QMediaPlayer::mediaStatusChanged, mParent, &AudioWrapper::mediaStatusChanged);
+    QObject::connect(player, &QMediaPlayer::stateChanged, mParent, [this](QMediaPlayer::State state) {
+        // the end of media may be notified after the stopped state
+        if (state == QMediaPlayer::StoppedState && mPlayer->mediaStatus() == QMediaPlayer::EndOfMedia && startNextPlayer()) {
+            return;
+        }
+        Q_EMIT mParent->playbackStateChanged(state);
+        mParent->playerStateChanged();
+    });
+    QObject::connect(player, QOverload<QMediaPlayer::Error>::of(&QMediaPlayer::error), mParent, &AudioWrapper::errorChanged);
+    QObject::connect(player, &QMediaPlayer::durationChanged, mParent, &AudioWrapper::durationChanged);
+    QObject::connect(player, &QMediaPlayer::positionChanged, mParent, &AudioWrapper::positionChanged);
+    QObject::connect(player, &QMediaPlayer::positionChanged, mParent, [this]() {
+        if (isNearEnd()) {
+            preloadNextPlayer();
+        }
+    });
+    QObject::connect(player, &QMediaPlayer::seekableChanged, mParent, &AudioWrapper::seekableChanged);
+}
+
+bool AudioWrapperPrivate::isNearEnd() const
+{
+    return mPlayer->duration() > 0 && mPlayer->duration() - mPlayer->position() <= AudioWrapper::PreloadDelay;
+}
+
+void AudioWrapperPrivate::preloadNextPlayer()
+{
+    if (mNextSource.isEmpty() || (mNextPlayer && mNextPlayer->media().canonicalUrl() == mNextSource)) {
+        return;
+    }
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapperPrivate::preloadNextPlayer" << mNextSource;
+
+    if (!mNextPlayer) {
+        mNextPlayer = std::make_unique<QMediaPlayer>();
+    }
+
+    // the backend opens and prerolls the media while the current one is still playing
+    mNextPlayer->setAudioRole(mPlayer->audioRole());
+    mNextPlayer->setMedia({mNextSource});
+}
+
+bool AudioWrapperPrivate::startNextPlayer()
+{
+    if (!mNextPlayer || mNextPlayer->media().canonicalUrl() != mNextSource) {
+        return false;
+    }
+
+    if (mNextPlayer->mediaStatus() != QMediaPlayer::LoadedMedia && mNextPlayer->mediaStatus() != QMediaPlayer::BufferedMedia) {
+        return false;
+    }
+
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapperPrivate::startNextPlayer" << mNextSource;
+
+    const auto advancedSource = mNextSource;
+
+    mAdvancedSource = advancedSource;
+
+    QObject::disconnect(mPlayer.get(), nullptr, mParent, nullptr);
+
+    mNextPlayer->setVolume(mPlayer->volume());
+    mNextPlayer->setMuted(mPlayer->isMuted());
+
+    std::swap(mPlayer, mNextPlayer);
+    connectPlayer();
+
+    mPlayer->play();
+
+    Q_EMIT mParent->sourceAdvanced(advancedSource);
+    Q_EMIT mParent->sourceChanged();
+    Q_EMIT mParent->durationChanged(mPlayer->duration());
+    Q_EMIT mParent->seekableChanged(mPlayer->isSeekable());
+
+    // the previous player is still delivering its end of media notification
+    QTimer::singleShot(0, mParent, [this]() {
+        if (mNextPlayer && mNextPlayer->media().canonicalUrl() != mNextSource) {
+            mNextPlayer->setMedia({});
+        }
+    });
+
+    return true;
+}
+
 AudioWrapper::AudioWrapper(QObject *parent) : QObject(parent), d(std::make_unique<AudioWrapperPrivate>())
 {
-    connect(&d->mPlayer, &QMediaPlayer::mutedChanged, this, &AudioWrapper::playerMutedChanged);
-    connect(&d->mPlayer, &QMediaPlayer::volumeChanged, this, &AudioWrapper::playerVolumeChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaChanged, this, &AudioWrapper::sourceChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::statusChanged);
-    connect(&d->mPlayer, &QMediaPlayer::mediaStatusChanged, this, &AudioWrapper::mediaStatusChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playbackStateChanged);
-    connect(&d->mPlayer, &QMediaPlayer::stateChanged, this, &AudioWrapper::playerStateChanged);
-    connect(&d->mPlayer, QOverload<QMediaPlayer::Error>::of(&QMediaPlayer::error), this, &AudioWrapper::errorChanged);
-    connect(&d->mPlayer, &QMediaPlayer::durationChanged, this, &AudioWrapper::durationChanged);
-    connect(&d->mPlayer, &QMediaPlayer::positionChanged, this, &AudioWrapper::positionChanged);
-    connect(&d->mPlayer, &QMediaPlayer::seekableChanged, this, &AudioWrapper::seekableChanged);
+    d->mParent = this;
+    d->connectPlayer();
 }
 
 AudioWrapper::~AudioWrapper()
@@ -59,12 +164,12 @@ AudioWrapper::~AudioWrapper()
 
 bool AudioWrapper::muted() const
 {
-    return d->mPlayer.isMuted();
+    return d->mPlayer->isMuted();
 }
 
 qreal AudioWrapper::volume() const
 {
-    auto realVolume = static_cast<qreal>(d->mPlayer.volume() / 100.0);
+    auto realVolume = static_cast<qreal>(d->mPlayer->volume() / 100.0);
     auto userVolume = static_cast<qreal>(QAudio::convertVolume(realVolume, QAudio::LinearVolumeScale, QAudio::LogarithmicVolumeScale));
 
     return userVolume * 100.0;
@@ -72,51 +177,56 @@ qreal AudioWrapper::volume() const
 
 QUrl AudioWrapper::source() const
 {
-    return d->mPlayer.media().canonicalUrl();
+    return d->mPlayer->media().canonicalUrl();
+}
+
+QUrl AudioWrapper::nextSource() const
+{
+    return d->mNextSource;
 }
 
 QMediaPlayer::Error AudioWrapper::error() const
 {
-    if (d->mPlayer.error() != QMediaPlayer::NoError) {
-        qDebug() << "AudioWrapper::error" << d->mPlayer.errorString();
+    if (d->mPlayer->error() != QMediaPlayer::NoError) {
+        qDebug() << "AudioWrapper::error" << d->mPlayer->errorString();
     }
 
-    return d->mPlayer.error();
+    return d->mPlayer->error();
 }
 
 qint64 AudioWrapper::duration() const
 {
-    return d->mPlayer.duration();
+    return d->mPlayer->duration();
 }
 
 qint64 AudioWrapper::position() const
 {
-    return d->mPlayer.position();
+    return d->mPlayer->position();
 }
 
 bool AudioWrapper::seekable() const
 {
-    return d->mPlayer.isSeekable();
+    return d->mPlayer->isSeekable();
 }
 
 QAudio::Role AudioWrapper::audioRole() const
 {
-    return d->mPlayer.audioRole();
+    return d->mPlayer->audioRole();
 }
 
 QMediaPlayer::State AudioWrapper::playbackState() const
 {
-    return d->mPlayer.state();
+    return d->mPlayer->state();
 }
 
 QMediaPlayer::MediaStatus AudioWrapper::status() const
 {
-    return d->mPlayer.mediaStatus();
+    return d->mPlayer->mediaStatus();
 }
 
 void AudioWrapper::setMuted(bool muted)
 {
-    d->mPlayer.setMuted(muted);
+    d->mPlayer->setMuted(muted);
 }
 
 void AudioWrapper::setVolume(qreal volume)
@@ -124,33 +234,56 @@ void AudioWrapper::setVolume(qreal volume)
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setVolume" << volume;
 
     auto realVolume = static_cast<qreal>(QAudio::convertVolume(volume / 100.0, QAudio::LogarithmicVolumeScale, QAudio::LinearVolumeScale));
-    d->mPlayer.setVolume(qRound(realVolume * 100));
+    d->mPlayer->setVolume(qRound(realVolume * 100));
 }
 
 void AudioWrapper::setSource(const QUrl &source)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setSource" << source;
 
-    d->mPlayer.setMedia({source});
+    if (!d->mAdvancedSource.isEmpty() && source == d->mAdvancedSource) {
+        d->mAdvancedSource.clear();
+        return;
+    }
+
+    d->mAdvancedSource.clear();
+
+    d->mPlayer->setMedia({source});
+}
+
+void AudioWrapper::setNextSource(const QUrl &nextSource)
+{
+    qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setNextSource" << nextSource;
+
+    if (d->mNextSource == nextSource) {
+        return;
+    }
+
+    d->mNextSource = nextSource;
+    Q_EMIT nextSourceChanged();
+
+    if (d->isNearEnd()) {
+        d->preloadNextPlayer();
+    }
 }
 
 void AudioWrapper::setPosition(qint64 position)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::setPosition" << position;
 
-    if (d->mPlayer.duration() <= 0) {
+    if (d->mPlayer->duration() <= 0) {
         savePosition(position);
         return;
     }
 
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::play()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::play";
 
-    d->mPlayer.play();
+    d->mPlayer->play();
 
     if (d->mHasSavedPosition) {
         qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerDurationSignalChanges" << "restore old position" << d->mSavedPosition;
@@ -164,26 +297,28 @@ void AudioWrapper::pause()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::pause";
 
-    d->mPlayer.pause();
+    d->mPlayer->pause();
 }
 
 void AudioWrapper::stop()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::stop";
 
-    d->mPlayer.stop();
+    d->mAdvancedSource.clear();
+
+    d->mPlayer->stop();
 }
 
 void AudioWrapper::seek(qint64 position)
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::seek" << position;
 
-    d->mPlayer.setPosition(position);
+    d->mPlayer->setPosition(position);
 }
 
 void AudioWrapper::setAudioRole(QAudio::Role audioRole)
 {
-    d->mPlayer.setAudioRole(audioRole);
+    d->mPlayer->setAudioRole(audioRole);
 }
 
 void AudioWrapper::mediaStatusChanged()
@@ -195,7 +330,7 @@ void AudioWrapper::playerStateChanged()
 {
     qCDebug(orgKdeElisaPlayerQtMultimedia) << "AudioWrapper::playerStateChanged";
 
-    switch(d->mPlayer.state())
+    switch(d->mPlayer->state())
     {
     case QMediaPlayer::State::StoppedState:
         Q_EMIT stopped();
@@ -409,15 +409,16 @@ MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile, const Q
 
     fileScanner().scanProperties(match, newTrack);
 
-    if (!newTrack.isValid()) {
+    if (newTrack.isValid()) {
+        newTrack.setHasEmbeddedCover(checkEmbeddedCoverImage(localFileName));
+    } else {
         qCDebug(orgKdeElisaBaloo) << "LocalBalooFileListing::scanOneFile" << scanFile << "falling back to plain file metadata analysis";
         newTrack = AbstractFileListing::scanOneFile(scanFile, scanFileInfo);
     }
 
     if (newTrack.isValid()) {
-        newTrack.setHasEmbeddedCover(checkEmbeddedCoverImage(localFileName));
         addCover(newTrack);
-        watchPath(localFileName);
+        watchFile(localFileName);
     } else {
         qCDebug(orgKdeElisaBaloo) << "LocalBalooFileListing::scanOneFile" << scanFile << "invalid track";
     }
@@ -0,0 +1,261 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "collectionsnapshot.h"
+
+#include "databaseLogging.h"
+
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include <algorithm>
+
+namespace {
+
+constexpr quint32 SnapshotMagic = 0x454c534e;
+
+constexpr quint32 SnapshotFormatVersion = 2;
+
+/*
+ * Each list is stored column by column: the rows count, the roles present in at least one
+ * row, then for each role the values of all rows (an invalid QVariant for a missing field).
+ */
+template <typename DataListType>
+void writeColumns(QDataStream &out, const DataListType &allData)
+{
+    auto allRoles = QList<int>{};
+    for (int role = DatabaseInterface::TitleRole; role <= DatabaseInterface::LyricsRole; ++role) {
+        const auto key = static_cast<DatabaseInterface::ColumnsRoles>(role);
+        if (std::any_of(allData.cbegin(), allData.cend(), [key](const auto &oneData) {return oneData.contains(key);})) {
+            allRoles.push_back(role);
+        }
+    }
+
+    out << quint32(allData.size()) << allRoles;
+
+    for (auto role : qAsConst(allRoles)) {
+        const auto key = static_cast<DatabaseInterface::ColumnsRoles>(role);
+        for (const auto &oneData : allData) {
+            out << (oneData.contains(key) ? oneData.value(key) : QVariant{});
+        }
+    }
+}
+
+template <typename DataListType>
+bool readColumns(QDataStream &in, DataListType &allData)
+{
+    auto rowsCount = quint32{0};
+    auto allRoles = QList<int>{};
+
+    in >> rowsCount >> allRoles;
+
+    if (in.status() != QDataStream::Ok || rowsCount > quint32(in.device()->size())) {
+        return false;
+    }
+
+    allData.clear();
+    allData.reserve(int(rowsCount));
+    for (quint32 row = 0; row < rowsCount; ++row) {
+        allData.push_back({});
+    }
+
+    for (auto role : qAsConst(allRoles)) {
+        if (role < DatabaseInterface::TitleRole || role > DatabaseInterface::LyricsRole) {
+            return false;
+        }
+
+        const auto key = static_cast<DatabaseInterface::ColumnsRoles>(role);
+        for (auto &oneData : allData) {
+            QVariant value;
+            in >> value;
+
+            if (value.isValid()) {
+                oneData.insert(key, value);
+            }
+        }
+
+        if (in.status() != QDataStream::Ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+class CollectionSnapshotPrivate
+{
+public:
+
+    QString mIdentity;
+
+    qulonglong mGeneration = 0;
+
+    bool mIsValid = false;
+
+    CollectionSnapshot::ListAlbumDataType mAllAlbums;
+
+    CollectionSnapshot::ListArtistDataType mAllArtists;
+
+    CollectionSnapshot::ListGenreDataType mAllGenres;
+
+    CollectionSnapshot::ListTrackDataType mAllTracks;
+
+};
+
+CollectionSnapshot::CollectionSnapshot() : d(std::make_unique<CollectionSnapshotPrivate>())
+{
+}
+
+CollectionSnapshot::~CollectionSnapshot()
+= default;
+
+bool CollectionSnapshot::load(const QString &fileName)
+{
+    clear();
+
+    QFile snapshotFile(fileName);
+    if (!snapshotFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QElapsedTimer loadTimer;
+    loadTimer.start();
+
+    const auto snapshotSize = snapshotFile.size();
+    auto *mappedData = snapshotFile.map(0, snapshotSize);
+    if (!mappedData) {
+        qCInfo(orgKdeElisaDatabase()) << "CollectionSnapshot::load" << fileName << "cannot be mapped" << snapshotFile.errorString();
+        return false;
+    }
+
+    const auto rawData = QByteArray::fromRawData(reinterpret_cast<const char*>(mappedData), int(snapshotSize));
+    QDataStream in(rawData);
+    in.setVersion(QDataStream::Qt_5_10);
+
+    auto magic = quint32{0};
+    auto formatVersion = quint32{0};
+    auto identity = QString{};
+    auto generation = quint64{0};
+
+    in >> magic >> formatVersion;
+
+    if (in.status() != QDataStream::Ok || magic != SnapshotMagic || formatVersion != SnapshotFormatVersion) {
+        qCInfo(orgKdeElisaDatabase()) << "CollectionSnapshot::load" << fileName << "has an unknown format";
+        return false;
+    }
+
+    in >> identity >> generation;
+
+    if (!readColumns(in, d->mAllAlbums) || !readColumns(in, d->mAllArtists) ||
+            !readColumns(in, d->mAllGenres) || !readColumns(in, d->mAllTracks)) {
+        qCInfo(orgKdeElisaDatabase()) << "CollectionSnapshot::load" << fileName << "is corrupted";
+        clear();
+        return false;
+    }
+
+    d->mIdentity = identity;
+    d->mGeneration = generation;
+    d->mIsValid = true;
+
+    qCInfo(orgKdeElisaDatabase()) << "CollectionSnapshot::load" << "generation" << d->mGeneration
+                                  << d->mAllAlbums.size() << "albums" << d->mAllArtists.size() << "artists"
+                                  << d->mAllGenres.size() << "genres" << d->mAllTracks.size() << "tracks"
+                                  << "in" << loadTimer.elapsed() << "ms";
+
+    return true;
+}
+
+bool CollectionSnapshot::write(const QString &fileName, const QString &identity, qulonglong generation,
+                               const ListAlbumDataType &allAlbums, const ListArtistDataType &allArtists,
+                               const ListGenreDataType &allGenres, const ListTrackDataType &allTracks)
+{
+    QSaveFile snapshotFile(fileName);
+    if (!snapshotFile.open(QIODevice::WriteOnly)) {
+        qCInfo(orgKdeElisaDatabase()) << "CollectionSnapshot::write" << fileName << snapshotFile.errorString();
+        return false;
+    }
+
+    QDataStream out(&snapshotFile);
+    out.setVersion(QDataStream::Qt_5_10);
+
+    out << SnapshotMagic << SnapshotFormatVersion << identity << quint64(generation);
+
+    writeColumns(out, allAlbums);
+    writeColumns(out, allArtists);
+    writeColumns(out, allGenres);
+    writeColumns(out, allTracks);
+
+    if (out.status() != QDataStream::Ok) {
+        snapshotFile.cancelWriting();
+        return false;
+    }
+
+    return snapshotFile.commit();
+}
+
+bool CollectionSnapshot::isValid() const
+{
+    return d->mIsValid;
+}
+
+void CollectionSnapshot::clear()
+{
+    d->mIdentity.clear();
+    d->mGeneration = 0;
+    d->mIsValid = false;
+    d->mAllAlbums.clear();
+    d->mAllArtists.clear();
+    d->mAllGenres.clear();
+    d->mAllTracks.clear();
+}
+
+QString CollectionSnapshot::identity() const
+{
+    return d->mIdentity;
+}
+
+qulonglong CollectionSnapshot::generation() const
+{
+    return d->mGeneration;
+}
+
+const CollectionSnapshot::ListAlbumDataType &CollectionSnapshot::allAlbums() const
+{
+    return d->mAllAlbums;
+}
+
+const CollectionSnapshot::ListArtistDataType &CollectionSnapshot::allArtists() const
+{
+    return d->mAllArtists;
+}
+
+const CollectionSnapshot::ListGenreDataType &CollectionSnapshot::allGenres() const
+{
+    return d->mAllGenres;
+}
+
+const CollectionSnapshot::ListTrackDataType &CollectionSnapshot::allTracks() const
+{
+    return d->mAllTracks;
+}
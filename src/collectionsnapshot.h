@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef COLLECTIONSNAPSHOT_H
+#define COLLECTIONSNAPSHOT_H
+
+#include "elisaLib_export.h"
+
+#include "databaseinterface.h"
+
+#include <QString>
+
+#include <memory>
+
+class CollectionSnapshotPrivate;
+
+/**
+ * Copy of the unfiltered albums, artists, genres and tracks lists stored in a flat file
+ * next to the database. The views can be filled from it at startup before the database
+ * is ready. It is only meaningful while its identity and generation match the ones of the
+ * database.
+ */
+class ELISALIB_EXPORT CollectionSnapshot
+{
+
+public:
+
+    using ListAlbumDataType = DatabaseInterface::ListAlbumDataType;
+
+    using ListArtistDataType = DatabaseInterface::ListArtistDataType;
+
+    using ListGenreDataType = DatabaseInterface::ListGenreDataType;
+
+    using ListTrackDataType = DatabaseInterface::ListTrackDataType;
+
+    CollectionSnapshot();
+
+    ~CollectionSnapshot();
+
+    bool load(const QString &fileName);
+
+    static bool write(const QString &fileName, const QString &identity, qulonglong generation,
+                      const ListAlbumDataType &allAlbums, const ListArtistDataType &allArtists,
+                      const ListGenreDataType &allGenres, const ListTrackDataType &allTracks);
+
+    bool isValid() const;
+
+    void clear();
+
+    QString identity() const;
+
+    qulonglong generation() const;
+
+    const ListAlbumDataType& allAlbums() const;
+
+    const ListArtistDataType& allArtists() const;
+
+    const ListGenreDataType& allGenres() const;
+
+    const ListTrackDataType& allTracks() const;
+
+private:
+
+    std::unique_ptr<CollectionSnapshotPrivate> d;
+
+};
+
+#endif // COLLECTIONSNAPSHOT_H
@@ -18,8 +18,12 @@
 #include "databaseinterface.h"
 
 #include "databaseLogging.h"
+#include "databaseProfilerLogging.h"
 
 #include "musicaudiotrack.h"
+#include "collectionsnapshot.h"
+#include "albumartstore.h"
+#include "filescanner.h"
 
 #include <KI18n/KLocalizedString>
 
@@ -31,15 +35,188 @@
 #include <QSqlRecord>
 #include <QSqlError>
 
+#include <QFile>
+#include <QMimeDatabase>
+
 #include <QDateTime>
+#include <QStringList>
+#include <QVector>
+#include <QRegularExpression>
 #include <QMutex>
 #include <QVariant>
 #include <QAtomicInt>
 #include <QElapsedTimer>
+#include <QTimer>
+#include <QThread>
+#include <QThreadPool>
+#include <QUuid>
 #include <QDebug>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include <algorithm>
 
+static QString refreshAlbumSummaryQueryText(const QString &albumFilter, bool hasOfflineTracks = true)
+{
+    const auto &onlineTracksFilter = (hasOfflineTracks ?
+                                          QStringLiteral("AND NOT EXISTS ("
+                                                         "SELECT 1 "
+                                                         "FROM "
+                                                         "`TracksData` offlineTracks "
+                                                         "WHERE "
+                                                         "offlineTracks.`FileName` = %1.`FileName` AND "
+                                                         "offlineTracks.`IsOffline` = 1"
+                                                         ") ") :
+                                          QString());
+
+    return QStringLiteral("INSERT OR REPLACE INTO `AlbumSummary` "
+                          "(`AlbumID`, `AllArtists`, `AllGenres`, `HighestRating`, `DiscsCount`, `TracksCount`, `EmbeddedCover`) "
+                          "SELECT "
+                          "album.`ID`, "
+                          "GROUP_CONCAT(tracks.`ArtistName`, ', '), "
+                          "GROUP_CONCAT(genres.`Name`, ', '), "
+                          "MAX(tracks.`Rating`), "
+                          "COUNT(DISTINCT tracks.`DiscNumber`), "
+                          "COUNT(tracks.`ID`), "
+                          "( "
+                          "SELECT tracksCover.`FileName` "
+                          "FROM "
+                          "`Tracks` tracksCover "
+                          "WHERE "
+                          "tracksCover.`HasEmbeddedCover` = 1 AND "
+                          "tracksCover.`AlbumTitle` = album.`Title` AND "
+                          "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
+                          "(tracksCover.`AlbumArtistName` IS NULL AND "
+                          "album.`ArtistName` IS NULL "
+                          ") "
+                          ") AND "
+                          "tracksCover.`AlbumPath` = album.`AlbumPath` "
+                          "%1"
+                          ") "
+                          "FROM "
+                          "`Albums` album LEFT JOIN "
+                          "`Tracks` tracks ON "
+                          "tracks.`AlbumTitle` = album.`Title` AND "
+                          "("
+                          "tracks.`AlbumArtistName` = album.`ArtistName` OR "
+                          "("
+                          "tracks.`AlbumArtistName` IS NULL AND "
+                          "album.`ArtistName` IS NULL"
+                          ")"
+                          ") AND "
+                          "tracks.`AlbumPath` = album.`AlbumPath` "
+                          "%2"
+                          "LEFT JOIN "
+                          "`Genre` genres ON tracks.`Genre` = genres.`Name` "
+                          "%3"
+                          "GROUP BY album.`ID`").arg(onlineTracksFilter.arg(QStringLiteral("tracksCover")),
+                                                     onlineTracksFilter.arg(QStringLiteral("tracks")),
+                                                     albumFilter);
+}
+
+static QString searchMatchExpression(const QString &columns, const QString &filterText)
+{
+    auto prefixTokens = QStringList{};
+
+    const auto &allTokens = filterText.split(QRegularExpression(QStringLiteral("\\s+")), QString::SkipEmptyParts);
+    for (auto oneToken : allTokens) {
+        oneToken.remove(QLatin1Char('"'));
+
+        if (!oneToken.isEmpty()) {
+            prefixTokens.push_back(QLatin1Char('"') + oneToken + QStringLiteral("\"*"));
+        }
+    }
+
+    if (prefixTokens.isEmpty()) {
+        return {};
+    }
+
+    return QLatin1Char('{') + columns + QStringLiteral("} : (") + prefixTokens.join(QLatin1Char(' ')) + QLatin1Char(')');
+}
+
+static QAtomicInt slowQueryThreshold = 10;
+
+class StatementStatistics
+{
+public:
+
+    void record(qint64 duration, int rows)
+    {
+        static const int maximumLatestDurations = 1000;
+
+        ++mCount;
+        mTotalDuration += duration;
+        mMaximumDuration = std::max(mMaximumDuration, duration);
+
+        if (rows > 0) {
+            mRows += rows;
+        }
+
+        if (mLatestDurations.size() < maximumLatestDurations) {
+            mLatestDurations.push_back(duration);
+        } else {
+            mLatestDurations[mNextDurationIndex] = duration;
+            mNextDurationIndex = (mNextDurationIndex + 1) % maximumLatestDurations;
+        }
+    }
+
+    qint64 percentile99Duration() const
+    {
+        if (mLatestDurations.isEmpty()) {
+            return 0;
+        }
+
+        auto sortedDurations = mLatestDurations;
+        std::sort(sortedDurations.begin(), sortedDurations.end());
+
+        return sortedDurations[(sortedDurations.size() - 1) * 99 / 100];
+    }
+
+    qint64 mCount = 0;
+
+    qint64 mTotalDuration = 0;
+
+    qint64 mMaximumDuration = 0;
+
+    qint64 mRows = 0;
+
+    QVector<qint64> mLatestDurations;
+
+    int mNextDurationIndex = 0;
+
+};
+
+class PendingPlayStatistics
+{
+public:
+
+    QDateTime mFirstPlayDate;
+
+    QDateTime mLastPlayDate;
+
+    int mPlayCount = 0;
+
+};
+
+class PlayStatisticsJournal
+{
+public:
+
+    QMutex mMutex;
+
+    QHash<QUrl, PendingPlayStatistics> mPendingStatistics;
+
+};
+
+static void applyPendingPlayStatistics(DatabaseInterface::TrackDataType &track, const PendingPlayStatistics &statistics)
+{
+    if (!track.firstPlayDate().isValid()) {
+        track.setFirstPlayDate(statistics.mFirstPlayDate);
+    }
+    track.setLastPlayDate(statistics.mLastPlayDate);
+    track.setPlayCounter(track.playCounter() + statistics.mPlayCount);
+}
+
 class DatabaseInterfacePrivate
 {
 public:
@@ -84,7 +261,22 @@ public:
           mSelectAllRecentlyPlayedTracksQuery(mTracksDatabase), mSelectAllFrequentlyPlayedTracksQuery(mTracksDatabase),
           mClearTracksTable(mTracksDatabase), mClearAlbumsTable(mTracksDatabase), mClearArtistsTable(mTracksDatabase),
           mClearComposerTable(mTracksDatabase), mClearGenreTable(mTracksDatabase), mClearLyricistTable(mTracksDatabase),
-          mArtistMatchGenreQuery(mTracksDatabase), mSelectTrackIdQuery(mTracksDatabase)
+          mArtistMatchGenreQuery(mTracksDatabase), mSelectTrackIdQuery(mTracksDatabase),
+          mSelectAllDirectoriesQuery(mTracksDatabase), mInsertDirectoryQuery(mTracksDatabase),
+          mRemoveDirectoryQuery(mTracksDatabase), mClearDirectoriesTable(mTracksDatabase),
+          mRefreshAlbumSummaryQuery(mTracksDatabase),
+          mRemoveAlbumSummaryQuery(mTracksDatabase), mClearAlbumSummaryTable(mTracksDatabase),
+          mSelectTracksPageQuery(mTracksDatabase), mSelectAlbumsShortPageQuery(mTracksDatabase),
+          mSelectArtistsPageQuery(mTracksDatabase), mRemoveTrackSearchQuery(mTracksDatabase),
+          mInsertTrackSearchQuery(mTracksDatabase), mClearSearchTable(mTracksDatabase),
+          mSearchTracksQuery(mTracksDatabase), mSearchAlbumsQuery(mTracksDatabase),
+          mSearchArtistsQuery(mTracksDatabase), mUpdateTrackOfflineQuery(mTracksDatabase),
+          mSelectAlbumIdFromTrackFileNameQuery(mTracksDatabase), mSelectArtistIdsFromTrackIdQuery(mTracksDatabase),
+          mSelectAlbumOnlineTracksCountQuery(mTracksDatabase), mSelectArtistHasOnlineTracksQuery(mTracksDatabase),
+          mSelectOfflineTracksInDirectoryQuery(mTracksDatabase), mUpdateDirectoryOnlineQuery(mTracksDatabase),
+          mSelectAlbumArtSourceQuery(mTracksDatabase), mUpdateAlbumCoverCacheKeyQuery(mTracksDatabase),
+          mSelectAlbumsWithoutCoverCacheKeyQuery(mTracksDatabase), mUpdateTrackLyricsQuery(mTracksDatabase),
+          mSelectTrackLyricsQuery(mTracksDatabase), mSelectAlbumCoverCacheKeysQuery(mTracksDatabase)
     {
     }
 
@@ -248,6 +440,64 @@ public:
 
     QSqlQuery mSelectTrackIdQuery;
 
+    QSqlQuery mSelectAllDirectoriesQuery;
+
+    QSqlQuery mInsertDirectoryQuery;
+
+    QSqlQuery mRemoveDirectoryQuery;
+
+    QSqlQuery mClearDirectoriesTable;
+
+    QSqlQuery mRefreshAlbumSummaryQuery;
+
+    QSqlQuery mRemoveAlbumSummaryQuery;
+
+    QSqlQuery mClearAlbumSummaryTable;
+
+    QSqlQuery mSelectTracksPageQuery;
+
+    QSqlQuery mSelectAlbumsShortPageQuery;
+
+    QSqlQuery mSelectArtistsPageQuery;
+
+    QSqlQuery mRemoveTrackSearchQuery;
+
+    QSqlQuery mInsertTrackSearchQuery;
+
+    QSqlQuery mClearSearchTable;
+
+    QSqlQuery mSearchTracksQuery;
+
+    QSqlQuery mSearchAlbumsQuery;
+
+    QSqlQuery mSearchArtistsQuery;
+
+    QSqlQuery mUpdateTrackOfflineQuery;
+
+    QSqlQuery mSelectAlbumIdFromTrackFileNameQuery;
+
+    QSqlQuery mSelectArtistIdsFromTrackIdQuery;
+
+    QSqlQuery mSelectAlbumOnlineTracksCountQuery;
+
+    QSqlQuery mSelectArtistHasOnlineTracksQuery;
+
+    QSqlQuery mSelectOfflineTracksInDirectoryQuery;
+
+    QSqlQuery mUpdateDirectoryOnlineQuery;
+
+    QSqlQuery mSelectAlbumArtSourceQuery;
+
+    QSqlQuery mUpdateAlbumCoverCacheKeyQuery;
+
+    QSqlQuery mSelectAlbumsWithoutCoverCacheKeyQuery;
+
+    QSqlQuery mSelectAlbumCoverCacheKeysQuery;
+
+    QSqlQuery mUpdateTrackLyricsQuery;
+
+    QSqlQuery mSelectTrackLyricsQuery;
+
     QSet<qulonglong> mModifiedTrackIds;
 
     QSet<qulonglong> mModifiedAlbumIds;
@@ -260,6 +510,30 @@ public:
 
     QSet<qulonglong> mInsertedArtists;
 
+    QSet<qulonglong> mInsertedGenres;
+
+    QSet<qulonglong> mInsertedComposers;
+
+    QSet<qulonglong> mInsertedLyricists;
+
+    QSet<qulonglong> mStaleAlbumSummaries;
+
+    QSet<qulonglong> mStaleSearchEntries;
+
+    QHash<QString, qulonglong> mArtistIdCache;
+
+    QHash<QString, qulonglong> mComposerIdCache;
+
+    QHash<QString, qulonglong> mLyricistIdCache;
+
+    QHash<QString, qulonglong> mGenreIdCache;
+
+    QHash<QStringList, qulonglong> mAlbumIdCache;
+
+    QHash<qulonglong, QPair<QVariant, QVariant>> mAlbumTitleArtistCache;
+
+    QString mSelectTracksFromIdsQueryText;
+
     qulonglong mAlbumId = 1;
 
     qulonglong mArtistId = 1;
@@ -274,19 +548,53 @@ public:
 
     QAtomicInt mStopRequest = 0;
 
+    QAtomicInt mCollectionGeneration = 0;
+
+    QString mCollectionIdentity;
+
     bool mInitFinished = false;
 
     bool mIsInBadState = false;
 
+    bool mIsBulkInsert = false;
+
+    bool mHasSearchIndex = false;
+
+    bool mHasNameDictionaries = false;
+
+    QHash<QString, StatementStatistics> mStatementStatistics;
+
+    StatementStatistics mTransactionStatistics;
+
+    QElapsedTimer mTransactionTimer;
+
+    QTimer mFlushPlayStatisticsTimer;
+
+    std::unique_ptr<AlbumArtStore> mAlbumArtStore;
+
+    std::unique_ptr<FileScanner> mAlbumArtScanner;
+
+    QSet<qulonglong> mPendingAlbumArt;
+
+    QTimer mAlbumArtTimer;
+
+    QThreadPool mAlbumArtThreadPool;
+
+    bool mAlbumArtInProgress = false;
+
+    int mAlbumArtGeneration = 0;
+
 };
 
-DatabaseInterface::DatabaseInterface(QObject *parent) : QObject(parent), d(nullptr)
+DatabaseInterface::DatabaseInterface(QObject *parent) : QObject(parent), d(nullptr),
+    mPlayStatisticsJournal(std::make_shared<PlayStatisticsJournal>())
 {
 }
 
 DatabaseInterface::~DatabaseInterface()
 {
     if (d) {
+        d->mAlbumArtThreadPool.waitForDone();
         d->mTracksDatabase.close();
     }
 }
@@ -300,7 +608,11 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
     } else {
         tracksDatabase.setDatabaseName(QStringLiteral("file:memdb1?mode=memory"));
     }
-    tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;locking_mode = EXCLUSIVE;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
+    if (!databaseFileName.isEmpty()) {
+        tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
+    } else {
+        tracksDatabase.setConnectOptions(QStringLiteral("foreign_keys = ON;locking_mode = EXCLUSIVE;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
+    }
 
     auto result = tracksDatabase.open();
     if (result) {
@@ -312,14 +624,53 @@ void DatabaseInterface::init(const QString &dbName, const QString &databaseFileN
 
     tracksDatabase.exec(QStringLiteral("PRAGMA foreign_keys = ON;"));
 
+    if (!databaseFileName.isEmpty()) {
+        tracksDatabase.exec(QStringLiteral("PRAGMA journal_mode = WAL;"));
+        tracksDatabase.exec(QStringLiteral("PRAGMA synchronous = NORMAL;"));
+    }
+
     d = std::make_unique<DatabaseInterfacePrivate>(tracksDatabase);
 
+    d->mFlushPlayStatisticsTimer.setSingleShot(true);
+    d->mFlushPlayStatisticsTimer.setInterval(5000);
+    connect(&d->mFlushPlayStatisticsTimer, &QTimer::timeout,
+            this, &DatabaseInterface::flushPlayStatistics);
+
+    d->mAlbumArtTimer.setSingleShot(true);
+    d->mAlbumArtTimer.setInterval(100);
+    connect(&d->mAlbumArtTimer, &QTimer::timeout,
+            this, &DatabaseInterface::generateAlbumArt);
+
+    // one batch at a time so that the scanner and the pack file are never used concurrently
+    d->mAlbumArtThreadPool.setMaxThreadCount(1);
+
     initDatabase();
     initRequest();
 
     if (!databaseFileName.isEmpty()) {
         reloadExistingDatabase();
+    } else {
+        loadNameDictionaries();
+    }
+}
+
+void DatabaseInterface::initReadOnly(const QString &dbName, const QString &databaseFileName)
+{
+    QSqlDatabase tracksDatabase = QSqlDatabase::addDatabase(QStringLiteral("QSQLITE"), dbName);
+
+    tracksDatabase.setDatabaseName(QStringLiteral("file:") + databaseFileName);
+    tracksDatabase.setConnectOptions(QStringLiteral("QSQLITE_OPEN_READONLY;QSQLITE_OPEN_URI;QSQLITE_BUSY_TIMEOUT=500000"));
+
+    auto result = tracksDatabase.open();
+    if (result) {
+        qCDebug(orgKdeElisaDatabase) << "read-only database open" << dbName;
+    } else {
+        qCDebug(orgKdeElisaDatabase) << "read-only database not open" << dbName;
     }
+
+    d = std::make_unique<DatabaseInterfacePrivate>(tracksDatabase);
+
+    initRequest();
 }
 
 qulonglong DatabaseInterface::albumIdFromTitleAndArtist(const QString &title, const QString &artist)
@@ -354,7 +705,91 @@ DatabaseInterface::ListTrackDataType DatabaseInterface::allTracksData()
         return result;
     }
 
-    result = internalAllTracksPartialData();
+    result = internalAllTracksPartialData(d->mSelectAllTracksQuery);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+DatabaseInterface::ListTrackDataType DatabaseInterface::tracksDataPage(const QString &afterTitle, qulonglong afterDatabaseId, int count)
+{
+    auto result = ListTrackDataType{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    d->mSelectTracksPageQuery.bindValue(QStringLiteral(":afterTitle"), afterTitle);
+    d->mSelectTracksPageQuery.bindValue(QStringLiteral(":afterDatabaseId"), afterDatabaseId);
+    d->mSelectTracksPageQuery.bindValue(QStringLiteral(":maximumResults"), count);
+
+    result = internalAllTracksPartialData(d->mSelectTracksPageQuery);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+bool DatabaseInterface::hasSearchIndex() const
+{
+    return d && d->mHasSearchIndex;
+}
+
+QList<qulonglong> DatabaseInterface::searchTracks(const QString &filterText)
+{
+    return internalSearch(d->mSearchTracksQuery, searchMatchExpression(QStringLiteral("Title ArtistName"), filterText));
+}
+
+QList<qulonglong> DatabaseInterface::searchAlbums(const QString &filterText)
+{
+    return internalSearch(d->mSearchAlbumsQuery, searchMatchExpression(QStringLiteral("AlbumTitle AlbumArtistName ArtistName"), filterText));
+}
+
+QList<qulonglong> DatabaseInterface::searchArtists(const QString &filterText)
+{
+    return internalSearch(d->mSearchArtistsQuery, searchMatchExpression(QStringLiteral("ArtistName"), filterText));
+}
+
+QList<qulonglong> DatabaseInterface::internalSearch(QSqlQuery &searchQuery, const QString &matchExpression)
+{
+    auto result = QList<qulonglong>{};
+
+    if (!hasSearchIndex() || matchExpression.isEmpty()) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    searchQuery.bindValue(QStringLiteral(":matchExpression"), matchExpression);
+
+    auto queryResult = execQuery(searchQuery);
+
+    if (!queryResult || !searchQuery.isSelect() || !searchQuery.isActive()) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearch" << searchQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearch" << searchQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalSearch" << searchQuery.lastError();
+    } else {
+        while (searchQuery.next()) {
+            result.push_back(searchQuery.record().value(0).toULongLong());
+        }
+    }
+
+    searchQuery.finish();
 
     transactionResult = finishTransaction();
     if (!transactionResult) {
@@ -379,6 +814,8 @@ DatabaseInterface::ListTrackDataType DatabaseInterface::recentlyPlayedTracksData
 
     result = internalRecentlyPlayedTracksData(count);
 
+    mergePendingPlayStatistics(result, count, false);
+
     transactionResult = finishTransaction();
     if (!transactionResult) {
         return result;
@@ -402,6 +839,8 @@ DatabaseInterface::ListTrackDataType DatabaseInterface::frequentlyPlayedTracksDa
 
     result = internalFrequentlyPlayedTracksData(count);
 
+    mergePendingPlayStatistics(result, count, true);
+
     transactionResult = finishTransaction();
     if (!transactionResult) {
         return result;
@@ -433,6 +872,33 @@ DatabaseInterface::ListAlbumDataType DatabaseInterface::allAlbumsData()
     return result;
 }
 
+DatabaseInterface::ListAlbumDataType DatabaseInterface::albumsDataPage(const QString &afterTitle, qulonglong afterDatabaseId, int count)
+{
+    auto result = ListAlbumDataType{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    d->mSelectAlbumsShortPageQuery.bindValue(QStringLiteral(":afterTitle"), afterTitle);
+    d->mSelectAlbumsShortPageQuery.bindValue(QStringLiteral(":afterDatabaseId"), afterDatabaseId);
+    d->mSelectAlbumsShortPageQuery.bindValue(QStringLiteral(":maximumResults"), count);
+
+    result = internalAllAlbumsPartialData(d->mSelectAlbumsShortPageQuery);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 DatabaseInterface::ListAlbumDataType DatabaseInterface::allAlbumsDataByGenreAndArtist(const QString &genre, const QString &artist)
 {
     auto result = ListAlbumDataType{};
@@ -571,6 +1037,33 @@ DatabaseInterface::ListArtistDataType DatabaseInterface::allArtistsData()
     return result;
 }
 
+DatabaseInterface::ListArtistDataType DatabaseInterface::artistsDataPage(const QString &afterName, qulonglong afterDatabaseId, int count)
+{
+    auto result = ListArtistDataType{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":afterName"), afterName);
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":afterDatabaseId"), afterDatabaseId);
+    d->mSelectArtistsPageQuery.bindValue(QStringLiteral(":maximumResults"), count);
+
+    result = internalAllArtistsPartialData(d->mSelectArtistsPageQuery);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 DatabaseInterface::ListArtistDataType DatabaseInterface::allArtistsDataByGenre(const QString &genre)
 {
     qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::allArtistsDataByGenre" << genre;
@@ -702,10 +1195,9 @@ DatabaseInterface::TrackDataType DatabaseInterface::trackDataFromDatabaseId(qulo
     return result;
 }
 
-qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const QString &album,
-                                                                   int trackNumber, int discNumber)
+bool DatabaseInterface::trackLyricsFromDatabaseId(qulonglong id, QString &lyrics)
 {
-    auto result = qulonglong(0);
+    auto result = false;
 
     if (!d) {
         return result;
@@ -716,10 +1208,63 @@ qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString
         return result;
     }
 
-    result = internalTrackIdFromTitleAlbumTracDiscNumber(title, artist, album, trackNumber, discNumber);
+    d->mSelectTrackLyricsQuery.bindValue(QStringLiteral(":trackId"), id);
 
-    transactionResult = finishTransaction();
-    if (!transactionResult) {
+    auto queryResult = execQuery(d->mSelectTrackLyricsQuery);
+
+    if (!queryResult || !d->mSelectTrackLyricsQuery.isSelect() || !d->mSelectTrackLyricsQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::trackLyricsFromDatabaseId" << d->mSelectTrackLyricsQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::trackLyricsFromDatabaseId" << d->mSelectTrackLyricsQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::trackLyricsFromDatabaseId" << d->mSelectTrackLyricsQuery.lastError();
+
+        d->mSelectTrackLyricsQuery.finish();
+
+        finishTransaction();
+
+        return result;
+    }
+
+    if (d->mSelectTrackLyricsQuery.next()) {
+        const auto &currentRecord = d->mSelectTrackLyricsQuery.record();
+
+        result = currentRecord.value(2).toBool();
+
+        if (result) {
+            const auto &storedLyrics = currentRecord.value(0).toByteArray();
+            lyrics = QString::fromUtf8(currentRecord.value(1).toBool() ? qUncompress(storedLyrics) : storedLyrics);
+        }
+    }
+
+    d->mSelectTrackLyricsQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return false;
+    }
+
+    return result;
+}
+
+qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const QString &album,
+                                                                   int trackNumber, int discNumber)
+{
+    auto result = qulonglong(0);
+
+    if (!d) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result = internalTrackIdFromTitleAlbumTracDiscNumber(title, artist, album, trackNumber, discNumber);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
         return result;
     }
 
@@ -754,6 +1299,62 @@ void DatabaseInterface::applicationAboutToQuit()
     d->mStopRequest = 1;
 }
 
+void DatabaseInterface::setSlowQueryThreshold(int milliseconds)
+{
+    slowQueryThreshold = milliseconds;
+}
+
+QStringList DatabaseInterface::statementStatistics() const
+{
+    auto result = QStringList{};
+
+    if (!d) {
+        return result;
+    }
+
+    auto formatStatistics = [](const StatementStatistics &statistics, const QString &name) {
+        return QStringLiteral("count: %1 total: %2 ms max: %3 ms p99: %4 ms rows: %5 -- %6")
+                .arg(statistics.mCount)
+                .arg(statistics.mTotalDuration / 1000000.0, 0, 'f', 3)
+                .arg(statistics.mMaximumDuration / 1000000.0, 0, 'f', 3)
+                .arg(statistics.percentile99Duration() / 1000000.0, 0, 'f', 3)
+                .arg(statistics.mRows)
+                .arg(name.simplified());
+    };
+
+    auto allStatements = d->mStatementStatistics.keys();
+    std::sort(allStatements.begin(), allStatements.end(), [this](const auto &left, const auto &right) {
+        return d->mStatementStatistics[left].mTotalDuration > d->mStatementStatistics[right].mTotalDuration;
+    });
+
+    if (d->mTransactionStatistics.mCount) {
+        result.push_back(formatStatistics(d->mTransactionStatistics, QStringLiteral("transactions")));
+    }
+
+    for (const auto &oneStatement : allStatements) {
+        result.push_back(formatStatistics(d->mStatementStatistics[oneStatement], oneStatement));
+    }
+
+    return result;
+}
+
+void DatabaseInterface::dumpStatementStatistics() const
+{
+    if (!d) {
+        return;
+    }
+
+    const auto &allStatistics = statementStatistics();
+    if (allStatistics.isEmpty()) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaDatabaseProfiler) << "statement statistics for" << d->mTracksDatabase.connectionName();
+    for (const auto &oneStatistics : allStatistics) {
+        qCInfo(orgKdeElisaDatabaseProfiler()).noquote() << oneStatistics;
+    }
+}
+
 void DatabaseInterface::askRestoredTracks()
 {
     auto transactionResult = startTransaction();
@@ -761,6 +1362,8 @@ void DatabaseInterface::askRestoredTracks()
         return;
     }
 
+    Q_EMIT restoredDirectories(internalAllDirectories());
+
     auto result = internalAllFileName();
 
     Q_EMIT restoredTracks(result);
@@ -771,17 +1374,80 @@ void DatabaseInterface::askRestoredTracks()
     }
 }
 
+void DatabaseInterface::updateDirectoriesIndex(const DatabaseInterface::DirectoriesDataType &indexedDirectories,
+                                               const QList<QUrl> &removedDirectories)
+{
+    if (!d) {
+        return;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    for (const auto &oneRemovedDirectory : removedDirectories) {
+        internalRemoveDirectory(oneRemovedDirectory);
+    }
+
+    for (auto itDirectory = indexedDirectories.begin(); itDirectory != indexedDirectories.end(); ++itDirectory) {
+        d->mInsertDirectoryQuery.bindValue(QStringLiteral(":path"), itDirectory.key());
+        d->mInsertDirectoryQuery.bindValue(QStringLiteral(":modifiedTime"), itDirectory->mModifiedTime);
+        d->mInsertDirectoryQuery.bindValue(QStringLiteral(":entriesCount"), itDirectory->mEntriesCount);
+        d->mInsertDirectoryQuery.bindValue(QStringLiteral(":mountPoint"), itDirectory->mMountPoint.isEmpty() ? QVariant{} : QVariant{itDirectory->mMountPoint});
+
+        auto queryResult = execQuery(d->mInsertDirectoryQuery);
+
+        if (!queryResult || !d->mInsertDirectoryQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesIndex" << d->mInsertDirectoryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesIndex" << d->mInsertDirectoryQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateDirectoriesIndex" << d->mInsertDirectoryQuery.lastError();
+        }
+
+        d->mInsertDirectoryQuery.finish();
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
 void DatabaseInterface::trackHasStartedPlaying(const QUrl &fileName, const QDateTime &time)
 {
+    auto pendingStatistics = PendingPlayStatistics{};
+    {
+        QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+
+        auto &journalStatistics = mPlayStatisticsJournal->mPendingStatistics[fileName];
+        if (!journalStatistics.mFirstPlayDate.isValid()) {
+            journalStatistics.mFirstPlayDate = time;
+        }
+        journalStatistics.mLastPlayDate = time;
+        ++journalStatistics.mPlayCount;
+
+        pendingStatistics = journalStatistics;
+    }
+
+    if (!d->mFlushPlayStatisticsTimer.isActive()) {
+        d->mFlushPlayStatisticsTimer.start();
+    }
+
     auto transactionResult = startTransaction();
     if (!transactionResult) {
         return;
     }
 
-    updateTrackStatistics(fileName, time);
     auto trackId = internalTrackIdFromFileName(fileName);
     if (trackId != 0) {
-        Q_EMIT trackModified(internalOneTrackPartialData(trackId));
+        auto modifiedTrack = internalOneTrackPartialData(trackId);
+
+        applyPendingPlayStatistics(modifiedTrack, pendingStatistics);
+
+        Q_EMIT trackModified(modifiedTrack);
+        Q_EMIT tracksModified({modifiedTrack});
     }
 
     transactionResult = finishTransaction();
@@ -790,111 +1456,932 @@ void DatabaseInterface::trackHasStartedPlaying(const QUrl &fileName, const QDate
     }
 }
 
-void DatabaseInterface::clearData()
+void DatabaseInterface::flushPlayStatistics()
 {
+    if (!d) {
+        return;
+    }
+
+    {
+        QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+        if (mPlayStatisticsJournal->mPendingStatistics.isEmpty()) {
+            return;
+        }
+    }
+
     auto transactionResult = startTransaction();
     if (!transactionResult) {
         return;
     }
 
-    auto queryResult = execQuery(d->mClearTracksTable);
+    internalFlushPlayStatistics();
 
-    if (!queryResult || !d->mClearTracksTable.isActive()) {
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::internalFlushPlayStatistics()
+{
+    d->mFlushPlayStatisticsTimer.stop();
+
+    auto pendingStatistics = QHash<QUrl, PendingPlayStatistics>{};
+    {
+        QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+        pendingStatistics = mPlayStatisticsJournal->mPendingStatistics;
+    }
+
+    if (pendingStatistics.isEmpty()) {
+        return;
+    }
+
+    for (auto itStatistics = pendingStatistics.cbegin(); itStatistics != pendingStatistics.cend(); ++itStatistics) {
+        updateTrackStatistics(itStatistics.key(), itStatistics.value());
+    }
+
+    // cleared before the commit so that a reader never finds the same
+    // play both in the journal and in the tables
+    QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+    mPlayStatisticsJournal->mPendingStatistics.clear();
+}
+
+void DatabaseInterface::mergePendingPlayStatistics(ListTrackDataType &tracks, int count, bool sortByPlayCount)
+{
+    // the journal is read after the tracks so that a flush committed in
+    // between cannot be counted twice
+    auto pendingStatistics = QHash<QUrl, PendingPlayStatistics>{};
+    {
+        QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+        pendingStatistics = mPlayStatisticsJournal->mPendingStatistics;
+    }
+
+    if (pendingStatistics.isEmpty()) {
+        return;
+    }
+
+    for (auto &oneTrack : tracks) {
+        const auto itStatistics = pendingStatistics.find(oneTrack.resourceURI());
+        if (itStatistics == pendingStatistics.end()) {
+            continue;
+        }
+
+        applyPendingPlayStatistics(oneTrack, itStatistics.value());
+        pendingStatistics.erase(itStatistics);
+    }
+
+    for (auto itStatistics = pendingStatistics.cbegin(); itStatistics != pendingStatistics.cend(); ++itStatistics) {
+        auto trackId = internalTrackIdFromFileName(itStatistics.key());
+        if (trackId == 0) {
+            continue;
+        }
+
+        auto oneTrack = internalOneTrackPartialData(trackId);
+        applyPendingPlayStatistics(oneTrack, itStatistics.value());
+        tracks.push_back(oneTrack);
+    }
+
+    if (sortByPlayCount) {
+        std::stable_sort(tracks.begin(), tracks.end(), [](const TrackDataType &first, const TrackDataType &second) {
+            return first.playCounter() > second.playCounter();
+        });
+    } else {
+        std::stable_sort(tracks.begin(), tracks.end(), [](const TrackDataType &first, const TrackDataType &second) {
+            return first.lastPlayDate() > second.lastPlayDate();
+        });
+    }
+
+    if (tracks.size() > count) {
+        tracks.erase(tracks.begin() + count, tracks.end());
+    }
+}
+
+void DatabaseInterface::sharePlayStatisticsJournal(const DatabaseInterface &writer)
+{
+    mPlayStatisticsJournal = writer.mPlayStatisticsJournal;
+}
+
+void DatabaseInterface::readCollectionGeneration()
+{
+    QSqlQuery selectGenerationQuery(d->mTracksDatabase);
+
+    auto queryResult = selectGenerationQuery.exec(QStringLiteral("PRAGMA user_version"));
+
+    if (!queryResult || !selectGenerationQuery.next()) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readCollectionGeneration" << selectGenerationQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readCollectionGeneration" << selectGenerationQuery.lastError();
+
+        return;
+    }
+
+    d->mCollectionGeneration.storeRelease(selectGenerationQuery.record().value(0).toInt());
+
+    selectGenerationQuery.finish();
+
+    queryResult = selectGenerationQuery.exec(QStringLiteral("SELECT `Identity` FROM `CollectionIdentity`"));
+
+    if (!queryResult || !selectGenerationQuery.next()) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readCollectionGeneration" << selectGenerationQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::readCollectionGeneration" << selectGenerationQuery.lastError();
+
+        return;
+    }
+
+    d->mCollectionIdentity = selectGenerationQuery.record().value(0).toString();
+}
+
+void DatabaseInterface::increaseCollectionGeneration()
+{
+    const auto newGeneration = d->mCollectionGeneration.loadAcquire() + 1;
+
+    QSqlQuery updateGenerationQuery(d->mTracksDatabase);
+
+    // pragmas cannot use bound values
+    auto queryResult = updateGenerationQuery.exec(QStringLiteral("PRAGMA user_version = %1").arg(newGeneration));
+
+    if (!queryResult) {
         Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.lastError();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::increaseCollectionGeneration" << updateGenerationQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::increaseCollectionGeneration" << updateGenerationQuery.lastError();
+
+        return;
     }
 
-    d->mClearTracksTable.finish();
+    d->mCollectionGeneration.storeRelease(newGeneration);
+}
 
-    queryResult = execQuery(d->mClearAlbumsTable);
+qulonglong DatabaseInterface::collectionGeneration() const
+{
+    if (!d) {
+        return 0;
+    }
+
+    return qulonglong(d->mCollectionGeneration.loadAcquire());
+}
+
+QString DatabaseInterface::collectionIdentity() const
+{
+    if (!d) {
+        return {};
+    }
+
+    return d->mCollectionIdentity;
+}
+
+void DatabaseInterface::writeCollectionSnapshot(const QString &fileName)
+{
+    if (!d || fileName.isEmpty()) {
+        return;
+    }
+
+    QElapsedTimer snapshotTimer;
+    snapshotTimer.start();
+
+    flushPlayStatistics();
+
+    const auto generation = collectionGeneration();
+
+    auto result = CollectionSnapshot::write(fileName, collectionIdentity(), generation, allAlbumsData(), allArtistsData(),
+                                            allGenresData(), allTracksData());
+
+    qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::writeCollectionSnapshot" << fileName << "generation" << generation
+                                << (result ? "written in" : "failed after") << snapshotTimer.elapsed() << "ms";
+}
+
+void DatabaseInterface::initAlbumArtStore(const QString &packFileName)
+{
+    if (!d || packFileName.isEmpty()) {
+        return;
+    }
+
+    d->mAlbumArtStore = std::make_unique<AlbumArtStore>(packFileName);
+    d->mAlbumArtScanner = std::make_unique<FileScanner>();
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto queryResult = execQuery(d->mSelectAlbumsWithoutCoverCacheKeyQuery);
+
+    if (!queryResult || !d->mSelectAlbumsWithoutCoverCacheKeyQuery.isSelect() || !d->mSelectAlbumsWithoutCoverCacheKeyQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initAlbumArtStore" << d->mSelectAlbumsWithoutCoverCacheKeyQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initAlbumArtStore" << d->mSelectAlbumsWithoutCoverCacheKeyQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initAlbumArtStore" << d->mSelectAlbumsWithoutCoverCacheKeyQuery.lastError();
+
+        d->mSelectAlbumsWithoutCoverCacheKeyQuery.finish();
+
+        finishTransaction();
+
+        return;
+    }
+
+    while (d->mSelectAlbumsWithoutCoverCacheKeyQuery.next()) {
+        d->mPendingAlbumArt.insert(d->mSelectAlbumsWithoutCoverCacheKeyQuery.record().value(0).toULongLong());
+    }
+
+    d->mSelectAlbumsWithoutCoverCacheKeyQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::initAlbumArtStore" << d->mPendingAlbumArt.size() << "albums without stored cover";
+
+    if (!d->mPendingAlbumArt.isEmpty()) {
+        d->mAlbumArtTimer.start();
+    }
+}
+
+void DatabaseInterface::generateAlbumArt()
+{
+    if (!d || !d->mAlbumArtStore || d->mAlbumArtInProgress || d->mPendingAlbumArt.isEmpty()) {
+        return;
+    }
+
+    // small batches let albums reset by a later import be picked up between two batches
+    static const auto albumArtBatchSize = 20;
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    struct AlbumArtSource
+    {
+        qulonglong mAlbumId;
+
+        QUrl mCoverFileName;
+
+        QUrl mEmbeddedCoverFileName;
+    };
+
+    auto albumArtSources = QList<AlbumArtSource>{};
+    auto processedAlbums = 0;
+
+    auto itAlbum = d->mPendingAlbumArt.begin();
+    while (itAlbum != d->mPendingAlbumArt.end() && processedAlbums < albumArtBatchSize) {
+        const auto albumId = *itAlbum;
+        itAlbum = d->mPendingAlbumArt.erase(itAlbum);
+        ++processedAlbums;
+
+        d->mSelectAlbumArtSourceQuery.bindValue(QStringLiteral(":albumId"), albumId);
+
+        auto queryResult = execQuery(d->mSelectAlbumArtSourceQuery);
+
+        if (!queryResult || !d->mSelectAlbumArtSourceQuery.isSelect() || !d->mSelectAlbumArtSourceQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::generateAlbumArt" << d->mSelectAlbumArtSourceQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::generateAlbumArt" << d->mSelectAlbumArtSourceQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::generateAlbumArt" << d->mSelectAlbumArtSourceQuery.lastError();
+
+            d->mSelectAlbumArtSourceQuery.finish();
+
+            continue;
+        }
+
+        if (!d->mSelectAlbumArtSourceQuery.next()) {
+            d->mSelectAlbumArtSourceQuery.finish();
+
+            continue;
+        }
+
+        const auto &currentRecord = d->mSelectAlbumArtSourceQuery.record();
+        const auto isAlreadyStored = !currentRecord.value(2).isNull();
+
+        if (!isAlreadyStored) {
+            albumArtSources.push_back({albumId, currentRecord.value(0).toUrl(), currentRecord.value(1).toUrl()});
+        }
+
+        d->mSelectAlbumArtSourceQuery.finish();
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    if (albumArtSources.isEmpty()) {
+        if (!d->mPendingAlbumArt.isEmpty()) {
+            d->mAlbumArtTimer.start();
+        }
+
+        return;
+    }
+
+    auto albumArtStore = d->mAlbumArtStore.get();
+    auto albumArtScanner = d->mAlbumArtScanner.get();
+    const auto generation = d->mAlbumArtGeneration;
+
+    d->mAlbumArtInProgress = true;
+
+    // reading and scaling the images does not need the database, keep them off its thread
+    QtConcurrent::run(&d->mAlbumArtThreadPool, [this, albumArtStore, albumArtScanner, generation, albumArtSources]() {
+        QThread::currentThread()->setPriority(QThread::LowestPriority);
+
+        QMimeDatabase mimeDatabase;
+
+        auto albumIds = QList<qulonglong>{};
+        auto coverCacheKeys = QList<QString>{};
+
+        for (const auto &oneSource : albumArtSources) {
+            auto sourceImageData = QByteArray{};
+
+            if (oneSource.mCoverFileName.isLocalFile()) {
+                QFile coverFile(oneSource.mCoverFileName.toLocalFile());
+                if (coverFile.open(QIODevice::ReadOnly)) {
+                    sourceImageData = coverFile.readAll();
+                }
+            } else if (oneSource.mEmbeddedCoverFileName.isLocalFile()) {
+                const auto &localFileName = oneSource.mEmbeddedCoverFileName.toLocalFile();
+                sourceImageData = albumArtScanner->readFrontCover(localFileName, mimeDatabase.mimeTypeForFile(localFileName).name());
+            }
+
+            albumIds.push_back(oneSource.mAlbumId);
+            coverCacheKeys.push_back(albumArtStore->insert(sourceImageData));
+        }
+
+        QMetaObject::invokeMethod(this, [this, generation, albumIds, coverCacheKeys]() {
+            storeAlbumArt(generation, albumIds, coverCacheKeys);
+        }, Qt::QueuedConnection);
+    });
+}
+
+void DatabaseInterface::storeAlbumArt(int generation, const QList<qulonglong> &albumIds, const QList<QString> &coverCacheKeys)
+{
+    d->mAlbumArtInProgress = false;
+
+    // the database has been cleared while the covers were rendered
+    if (generation != d->mAlbumArtGeneration) {
+        if (!d->mPendingAlbumArt.isEmpty()) {
+            d->mAlbumArtTimer.start();
+        }
+
+        return;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto storedAlbumIds = QList<qulonglong>{};
+
+    for (int i = 0; i < albumIds.size(); ++i) {
+        const auto albumId = albumIds.at(i);
+        const auto &coverCacheKey = coverCacheKeys.at(i);
+
+        // reset by an import while it was rendered, the next batch renders it again
+        if (d->mPendingAlbumArt.contains(albumId)) {
+            continue;
+        }
+
+        // an empty key records that the album has been processed without usable artwork
+        d->mUpdateAlbumCoverCacheKeyQuery.bindValue(QStringLiteral(":albumId"), albumId);
+        d->mUpdateAlbumCoverCacheKeyQuery.bindValue(QStringLiteral(":coverCacheKey"), coverCacheKey.isEmpty() ? QStringLiteral("") : coverCacheKey);
+
+        auto queryResult = execQuery(d->mUpdateAlbumCoverCacheKeyQuery);
+
+        if (!queryResult || !d->mUpdateAlbumCoverCacheKeyQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::storeAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::storeAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::storeAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.lastError();
+        }
+
+        d->mUpdateAlbumCoverCacheKeyQuery.finish();
+
+        if (!coverCacheKey.isEmpty()) {
+            storedAlbumIds.push_back(albumId);
+        }
+    }
+
+    auto modifiedAlbums = ListAlbumDataType{};
+    for (auto albumId : qAsConst(storedAlbumIds)) {
+        modifiedAlbums.push_back(internalOneAlbumPartialData(albumId));
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    for (const auto &oneAlbum : qAsConst(modifiedAlbums)) {
+        Q_EMIT albumModified(oneAlbum, oneAlbum.databaseId());
+    }
+
+    if (!d->mPendingAlbumArt.isEmpty()) {
+        d->mAlbumArtTimer.start();
+    } else {
+        compactAlbumArt();
+    }
+}
+
+void DatabaseInterface::compactAlbumArt()
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto queryResult = execQuery(d->mSelectAlbumCoverCacheKeysQuery);
+
+    if (!queryResult || !d->mSelectAlbumCoverCacheKeysQuery.isSelect() || !d->mSelectAlbumCoverCacheKeysQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::compactAlbumArt" << d->mSelectAlbumCoverCacheKeysQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::compactAlbumArt" << d->mSelectAlbumCoverCacheKeysQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::compactAlbumArt" << d->mSelectAlbumCoverCacheKeysQuery.lastError();
+
+        d->mSelectAlbumCoverCacheKeysQuery.finish();
+
+        finishTransaction();
+
+        return;
+    }
+
+    auto liveKeys = QSet<QString>{};
+    while (d->mSelectAlbumCoverCacheKeysQuery.next()) {
+        liveKeys.insert(d->mSelectAlbumCoverCacheKeysQuery.record().value(0).toString());
+    }
+
+    d->mSelectAlbumCoverCacheKeysQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto albumArtStore = d->mAlbumArtStore.get();
+
+    d->mAlbumArtInProgress = true;
+
+    QtConcurrent::run(&d->mAlbumArtThreadPool, [this, albumArtStore, liveKeys]() {
+        QThread::currentThread()->setPriority(QThread::LowestPriority);
+
+        albumArtStore->compact(liveKeys);
+
+        QMetaObject::invokeMethod(this, [this]() {
+            d->mAlbumArtInProgress = false;
+
+            if (!d->mPendingAlbumArt.isEmpty()) {
+                d->mAlbumArtTimer.start();
+            }
+        }, Qt::QueuedConnection);
+    });
+}
+
+void DatabaseInterface::resetAlbumArt(const QSet<qulonglong> &albumIds)
+{
+    for (auto albumId : albumIds) {
+        d->mUpdateAlbumCoverCacheKeyQuery.bindValue(QStringLiteral(":albumId"), albumId);
+        d->mUpdateAlbumCoverCacheKeyQuery.bindValue(QStringLiteral(":coverCacheKey"), QVariant{});
+
+        auto queryResult = execQuery(d->mUpdateAlbumCoverCacheKeyQuery);
+
+        if (!queryResult || !d->mUpdateAlbumCoverCacheKeyQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::resetAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::resetAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::resetAlbumArt" << d->mUpdateAlbumCoverCacheKeyQuery.lastError();
+        }
+
+        d->mUpdateAlbumCoverCacheKeyQuery.finish();
+    }
+}
+
+void DatabaseInterface::clearData()
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto queryResult = execQuery(d->mClearAlbumSummaryTable);
+
+    if (!queryResult || !d->mClearAlbumSummaryTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumSummaryTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumSummaryTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumSummaryTable.lastError();
+    }
+
+    d->mClearAlbumSummaryTable.finish();
+
+    d->mStaleAlbumSummaries.clear();
+
+    d->mFlushPlayStatisticsTimer.stop();
+    {
+        QMutexLocker locker(&mPlayStatisticsJournal->mMutex);
+        mPlayStatisticsJournal->mPendingStatistics.clear();
+    }
+
+    d->mAlbumArtTimer.stop();
+    d->mPendingAlbumArt.clear();
+    ++d->mAlbumArtGeneration;
+
+    d->mArtistIdCache.clear();
+    d->mComposerIdCache.clear();
+    d->mLyricistIdCache.clear();
+    d->mGenreIdCache.clear();
+
+    if (d->mHasSearchIndex) {
+        queryResult = execQuery(d->mClearSearchTable);
+
+        if (!queryResult || !d->mClearSearchTable.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearSearchTable.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearSearchTable.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearSearchTable.lastError();
+        }
+
+        d->mClearSearchTable.finish();
+    }
+
+    d->mStaleSearchEntries.clear();
+
+    queryResult = execQuery(d->mClearTracksTable);
+
+    if (!queryResult || !d->mClearTracksTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearTracksTable.lastError();
+    }
+
+    d->mClearTracksTable.finish();
+
+    queryResult = execQuery(d->mClearAlbumsTable);
+
+    if (!queryResult || !d->mClearAlbumsTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.lastError();
+    }
+
+    d->mClearAlbumsTable.finish();
+
+    queryResult = execQuery(d->mClearComposerTable);
+
+    if (!queryResult || !d->mClearComposerTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.lastError();
+    }
+
+    d->mClearComposerTable.finish();
+
+    queryResult = execQuery(d->mClearLyricistTable);
+
+    if (!queryResult || !d->mClearLyricistTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.lastError();
+    }
+
+    d->mClearLyricistTable.finish();
+
+    queryResult = execQuery(d->mClearGenreTable);
+
+    if (!queryResult || !d->mClearGenreTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.lastError();
+    }
+
+    d->mClearGenreTable.finish();
+
+    queryResult = execQuery(d->mClearArtistsTable);
+
+    if (!queryResult || !d->mClearArtistsTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.lastError();
+    }
+
+    d->mClearArtistsTable.finish();
+
+    queryResult = execQuery(d->mClearDirectoriesTable);
+
+    if (!queryResult || !d->mClearDirectoriesTable.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearDirectoriesTable.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearDirectoriesTable.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearDirectoriesTable.lastError();
+    }
+
+    d->mClearDirectoriesTable.finish();
+
+    increaseCollectionGeneration();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    Q_EMIT cleanedDatabase();
+}
+
+void DatabaseInterface::initChangesTrackers()
+{
+    d->mModifiedTrackIds.clear();
+    d->mModifiedAlbumIds.clear();
+    d->mModifiedArtistIds.clear();
+    d->mInsertedTracks.clear();
+    d->mInsertedAlbums.clear();
+    d->mInsertedArtists.clear();
+    d->mInsertedGenres.clear();
+    d->mInsertedComposers.clear();
+    d->mInsertedLyricists.clear();
+    d->mStaleAlbumSummaries.clear();
+    d->mStaleSearchEntries.clear();
+}
+
+void DatabaseInterface::startBulkInsert(const QList<MusicAudioTrack> &tracks)
+{
+    d->mIsBulkInsert = true;
+
+    auto artistNames = QSet<QString>{};
+    auto genreNames = QSet<QString>{};
+    auto composerNames = QSet<QString>{};
+    auto lyricistNames = QSet<QString>{};
+
+    for (const auto &oneTrack : tracks) {
+        if (oneTrack.title().isEmpty()) {
+            continue;
+        }
+
+        artistNames.insert(oneTrack.artist());
+        if (oneTrack.isValidAlbumArtist()) {
+            artistNames.insert(oneTrack.albumArtist());
+        }
+        genreNames.insert(oneTrack.genre());
+        composerNames.insert(oneTrack.composer());
+        lyricistNames.insert(oneTrack.lyricist());
+    }
+
+    if (!d->mHasNameDictionaries) {
+        prefetchNamesIds(QStringLiteral("Artists"), artistNames, d->mArtistIdCache);
+        prefetchNamesIds(QStringLiteral("Genre"), genreNames, d->mGenreIdCache);
+        prefetchNamesIds(QStringLiteral("Composer"), composerNames, d->mComposerIdCache);
+        prefetchNamesIds(QStringLiteral("Lyricist"), lyricistNames, d->mLyricistIdCache);
+    }
+
+    insertMissingNames(QStringLiteral("Artists"), artistNames, d->mArtistIdCache, d->mArtistId, d->mInsertedArtists);
+    insertMissingNames(QStringLiteral("Genre"), genreNames, d->mGenreIdCache, d->mGenreId, d->mInsertedGenres);
+    insertMissingNames(QStringLiteral("Composer"), composerNames, d->mComposerIdCache, d->mComposerId, d->mInsertedComposers);
+    insertMissingNames(QStringLiteral("Lyricist"), lyricistNames, d->mLyricistIdCache, d->mLyricistId, d->mInsertedLyricists);
+}
+
+void DatabaseInterface::finishBulkInsert(bool notifyInsertedNames)
+{
+    d->mIsBulkInsert = false;
+
+    if (!d->mHasNameDictionaries) {
+        d->mArtistIdCache.clear();
+        d->mComposerIdCache.clear();
+        d->mLyricistIdCache.clear();
+        d->mGenreIdCache.clear();
+    }
+
+    d->mAlbumIdCache.clear();
+    d->mAlbumTitleArtistCache.clear();
+
+    if (notifyInsertedNames && !d->mInsertedGenres.isEmpty()) {
+        ListGenreDataType newGenres;
+
+        for (auto genreId : qAsConst(d->mInsertedGenres)) {
+            newGenres.push_back({{DatabaseIdRole, genreId}});
+        }
+
+        Q_EMIT genresAdded(newGenres);
+    }
+
+    if (notifyInsertedNames && !d->mInsertedComposers.isEmpty()) {
+        Q_EMIT composersAdded(internalAllComposersPartialData());
+    }
+
+    if (notifyInsertedNames && !d->mInsertedLyricists.isEmpty()) {
+        Q_EMIT lyricistsAdded(internalAllLyricistsPartialData());
+    }
+
+    d->mInsertedGenres.clear();
+    d->mInsertedComposers.clear();
+    d->mInsertedLyricists.clear();
+}
+
+void DatabaseInterface::prefetchNamesIds(const QString &tableName, const QSet<QString> &names,
+                                         QHash<QString, qulonglong> &namesIds)
+{
+    const auto maximumBoundValues = 500;
+
+    auto pendingNames = QStringList{};
+    auto itName = names.begin();
+
+    while (itName != names.end()) {
+        pendingNames.clear();
+
+        for (; itName != names.end() && pendingNames.size() < maximumBoundValues; ++itName) {
+            if (itName->isEmpty() || namesIds.contains(*itName)) {
+                continue;
+            }
+
+            pendingNames.push_back(*itName);
+        }
+
+        if (pendingNames.isEmpty()) {
+            continue;
+        }
+
+        auto placeholders = QStringList{};
+        for (int i = 0; i < pendingNames.size(); ++i) {
+            placeholders.push_back(QStringLiteral("?"));
+        }
+
+        QSqlQuery selectQuery(d->mTracksDatabase);
+
+        prepareQuery(selectQuery, QStringLiteral("SELECT `ID`, `Name` FROM `%1` WHERE `Name` IN (%2)").arg(tableName, placeholders.join(QStringLiteral(", "))));
+
+        for (const auto &oneName : qAsConst(pendingNames)) {
+            selectQuery.addBindValue(oneName);
+        }
+
+        auto queryResult = execQuery(selectQuery);
 
-    if (!queryResult || !d->mClearAlbumsTable.isActive()) {
-        Q_EMIT databaseError();
+        if (!queryResult || !selectQuery.isSelect() || !selectQuery.isActive()) {
+            Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearAlbumsTable.lastError();
-    }
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::prefetchNamesIds" << selectQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::prefetchNamesIds" << selectQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::prefetchNamesIds" << selectQuery.lastError();
 
-    d->mClearAlbumsTable.finish();
+            selectQuery.finish();
 
-    queryResult = execQuery(d->mClearComposerTable);
+            return;
+        }
 
-    if (!queryResult || !d->mClearComposerTable.isActive()) {
-        Q_EMIT databaseError();
+        for (const auto &oneName : qAsConst(pendingNames)) {
+            namesIds[oneName] = 0;
+        }
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearComposerTable.lastError();
-    }
+        while (selectQuery.next()) {
+            const auto &currentRecord = selectQuery.record();
 
-    d->mClearComposerTable.finish();
+            namesIds[currentRecord.value(1).toString()] = currentRecord.value(0).toULongLong();
+        }
 
-    queryResult = execQuery(d->mClearLyricistTable);
+        selectQuery.finish();
+    }
+}
 
-    if (!queryResult || !d->mClearLyricistTable.isActive()) {
-        Q_EMIT databaseError();
+void DatabaseInterface::insertMissingNames(const QString &tableName, const QSet<QString> &names,
+                                           QHash<QString, qulonglong> &namesIds, qulonglong &nextId,
+                                           QSet<qulonglong> &insertedIds)
+{
+    const auto maximumInsertedRows = 250;
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearLyricistTable.lastError();
+    auto missingNames = QStringList{};
+    for (const auto &oneName : names) {
+        if (!oneName.isEmpty() && namesIds.value(oneName) == 0) {
+            missingNames.push_back(oneName);
+        }
     }
 
-    d->mClearLyricistTable.finish();
+    for (int firstIndex = 0; firstIndex < missingNames.size(); firstIndex += maximumInsertedRows) {
+        const auto pendingNames = missingNames.mid(firstIndex, maximumInsertedRows);
 
-    queryResult = execQuery(d->mClearGenreTable);
+        auto placeholders = QStringList{};
+        for (int i = 0; i < pendingNames.size(); ++i) {
+            placeholders.push_back(QStringLiteral("(?, ?)"));
+        }
 
-    if (!queryResult || !d->mClearGenreTable.isActive()) {
-        Q_EMIT databaseError();
+        QSqlQuery insertQuery(d->mTracksDatabase);
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearGenreTable.lastError();
-    }
+        prepareQuery(insertQuery, QStringLiteral("INSERT INTO `%1` (`ID`, `Name`) VALUES %2").arg(tableName, placeholders.join(QStringLiteral(", "))));
 
-    d->mClearGenreTable.finish();
+        auto currentId = nextId;
+        for (const auto &oneName : pendingNames) {
+            insertQuery.addBindValue(currentId);
+            insertQuery.addBindValue(oneName);
+            ++currentId;
+        }
 
-    queryResult = execQuery(d->mClearArtistsTable);
+        auto queryResult = execQuery(insertQuery);
 
-    if (!queryResult || !d->mClearArtistsTable.isActive()) {
-        Q_EMIT databaseError();
+        if (!queryResult || !insertQuery.isActive()) {
+            Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::clearData" << d->mClearArtistsTable.lastError();
-    }
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertMissingNames" << insertQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertMissingNames" << insertQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertMissingNames" << insertQuery.lastError();
 
-    d->mClearArtistsTable.finish();
+            insertQuery.finish();
 
-    transactionResult = finishTransaction();
-    if (!transactionResult) {
-        return;
-    }
+            return;
+        }
 
-    Q_EMIT cleanedDatabase();
-}
+        insertQuery.finish();
 
-void DatabaseInterface::initChangesTrackers()
-{
-    d->mModifiedTrackIds.clear();
-    d->mModifiedAlbumIds.clear();
-    d->mModifiedArtistIds.clear();
-    d->mInsertedTracks.clear();
-    d->mInsertedAlbums.clear();
-    d->mInsertedArtists.clear();
+        for (const auto &oneName : pendingNames) {
+            namesIds[oneName] = nextId;
+            insertedIds.insert(nextId);
+            ++nextId;
+        }
+    }
 }
 
 void DatabaseInterface::recordModifiedTrack(qulonglong trackId)
 {
     d->mModifiedTrackIds.insert(trackId);
+    d->mStaleSearchEntries.insert(trackId);
 }
 
 void DatabaseInterface::recordModifiedAlbum(qulonglong albumId)
 {
     d->mModifiedAlbumIds.insert(albumId);
+    d->mStaleAlbumSummaries.insert(albumId);
+}
+
+void DatabaseInterface::refreshAlbumSummaries()
+{
+    for (auto albumId : qAsConst(d->mStaleAlbumSummaries)) {
+        d->mRefreshAlbumSummaryQuery.bindValue(QStringLiteral(":albumId"), albumId);
+
+        auto result = execQuery(d->mRefreshAlbumSummaryQuery);
+
+        if (!result || !d->mRefreshAlbumSummaryQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshAlbumSummaries" << d->mRefreshAlbumSummaryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshAlbumSummaries" << d->mRefreshAlbumSummaryQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshAlbumSummaries" << d->mRefreshAlbumSummaryQuery.lastError();
+        }
+
+        d->mRefreshAlbumSummaryQuery.finish();
+    }
+
+    d->mStaleAlbumSummaries.clear();
+}
+
+void DatabaseInterface::refreshSearchIndex()
+{
+    if (!d->mHasSearchIndex) {
+        d->mStaleSearchEntries.clear();
+        return;
+    }
+
+    for (auto trackId : qAsConst(d->mStaleSearchEntries)) {
+        d->mRemoveTrackSearchQuery.bindValue(QStringLiteral(":trackId"), trackId);
+
+        auto result = execQuery(d->mRemoveTrackSearchQuery);
+
+        if (!result || !d->mRemoveTrackSearchQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mRemoveTrackSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mRemoveTrackSearchQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mRemoveTrackSearchQuery.lastError();
+        }
+
+        d->mRemoveTrackSearchQuery.finish();
+
+        d->mInsertTrackSearchQuery.bindValue(QStringLiteral(":trackId"), trackId);
+
+        result = execQuery(d->mInsertTrackSearchQuery);
+
+        if (!result || !d->mInsertTrackSearchQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mInsertTrackSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mInsertTrackSearchQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::refreshSearchIndex" << d->mInsertTrackSearchQuery.lastError();
+        }
+
+        d->mInsertTrackSearchQuery.finish();
+    }
+
+    d->mStaleSearchEntries.clear();
 }
 
 void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers)
@@ -913,6 +2400,10 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
 
     initChangesTrackers();
 
+    internalFlushPlayStatistics();
+
+    startBulkInsert(tracks);
+
     for(const auto &oneTrack : tracks) {
         d->mSelectTracksMapping.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
 
@@ -928,6 +2419,8 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
             d->mSelectTracksMapping.finish();
 
             rollBackTransaction();
+            finishBulkInsert(false);
+            loadNameDictionaries();
             Q_EMIT finishInsertingTracksList();
             return;
         }
@@ -949,10 +2442,19 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
 
         if (isInserted && insertedTrackId != 0) {
             d->mInsertedTracks.insert(insertedTrackId);
+            d->mStaleSearchEntries.insert(insertedTrackId);
+        }
+
+        if (insertedTrackId != 0) {
+            updateTrackLyrics(oneTrack);
         }
 
         if (d->mStopRequest == 1) {
+            refreshAlbumSummaries();
+            refreshSearchIndex();
+            increaseCollectionGeneration();
             transactionResult = finishTransaction();
+            finishBulkInsert(transactionResult);
             if (!transactionResult) {
                 Q_EMIT finishInsertingTracksList();
                 return;
@@ -962,6 +2464,15 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
         }
     }
 
+    finishBulkInsert(true);
+
+    refreshAlbumSummaries();
+    refreshSearchIndex();
+
+    if (!d->mInsertedTracks.isEmpty() || !d->mModifiedTrackIds.isEmpty() || !d->mModifiedAlbumIds.isEmpty()) {
+        increaseCollectionGeneration();
+    }
+
     if (!d->mInsertedArtists.isEmpty()) {
         ListArtistDataType newArtists;
 
@@ -988,11 +2499,22 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
         Q_EMIT albumModified({{DatabaseIdRole, albumId}}, albumId);
     }
 
+    if (d->mAlbumArtStore) {
+        // the tracks or the cover file of a modified album may now provide different artwork
+        resetAlbumArt(d->mModifiedAlbumIds);
+
+        d->mPendingAlbumArt.unite(d->mInsertedAlbums);
+        d->mPendingAlbumArt.unite(d->mModifiedAlbumIds);
+
+        if (!d->mPendingAlbumArt.isEmpty() && !d->mAlbumArtTimer.isActive()) {
+            d->mAlbumArtTimer.start();
+        }
+    }
+
     if (!d->mInsertedTracks.isEmpty()) {
-        ListTrackDataType newTracks;
+        const auto &newTracks = internalTracksPartialData(d->mInsertedTracks.values());
 
         for (auto trackId : qAsConst(d->mInsertedTracks)) {
-            newTracks.push_back(internalOneTrackPartialData(trackId));
             d->mModifiedTrackIds.remove(trackId);
         }
 
@@ -1000,8 +2522,14 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
         Q_EMIT tracksAdded(newTracks);
     }
 
-    for (auto trackId : qAsConst(d->mModifiedTrackIds)) {
-        Q_EMIT trackModified(internalOneTrackPartialData(trackId));
+    if (!d->mModifiedTrackIds.isEmpty()) {
+        const auto &modifiedTracks = internalTracksPartialData(d->mModifiedTrackIds.values());
+
+        for (const auto &oneModifiedTrack : modifiedTracks) {
+            Q_EMIT trackModified(oneModifiedTrack);
+        }
+
+        Q_EMIT tracksModified(modifiedTracks);
     }
 
     transactionResult = finishTransaction();
@@ -1022,8 +2550,15 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
 
     initChangesTrackers();
 
+    internalFlushPlayStatistics();
+
     internalRemoveTracksList(removedTracks);
 
+    refreshAlbumSummaries();
+    refreshSearchIndex();
+
+    increaseCollectionGeneration();
+
     if (!d->mInsertedArtists.isEmpty()) {
         ListArtistDataType newArtists;
         for (auto artistId : qAsConst(d->mInsertedArtists)) {
@@ -1041,6 +2576,222 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
     Q_EMIT finishRemovingTracksList();
 }
 
+void DatabaseInterface::setTracksOffline(const QList<QUrl> &offlineTracks)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    QList<qulonglong> hiddenTracks;
+    QSet<qulonglong> touchedAlbums;
+    QSet<qulonglong> touchedArtists;
+
+    for (const auto &oneOfflineTrack : offlineTracks) {
+        d->mUpdateTrackOfflineQuery.bindValue(QStringLiteral(":fileName"), oneOfflineTrack.toString());
+
+        auto queryResult = execQuery(d->mUpdateTrackOfflineQuery);
+
+        if (!queryResult || !d->mUpdateTrackOfflineQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setTracksOffline" << d->mUpdateTrackOfflineQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setTracksOffline" << d->mUpdateTrackOfflineQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setTracksOffline" << d->mUpdateTrackOfflineQuery.lastError();
+
+            d->mUpdateTrackOfflineQuery.finish();
+
+            continue;
+        }
+
+        const auto wasOnline = d->mUpdateTrackOfflineQuery.numRowsAffected() > 0;
+
+        d->mUpdateTrackOfflineQuery.finish();
+
+        if (!wasOnline) {
+            continue;
+        }
+
+        const auto albumId = internalAlbumIdFromTrackFileName(oneOfflineTrack);
+        if (albumId != 0) {
+            d->mStaleAlbumSummaries.insert(albumId);
+            touchedAlbums.insert(albumId);
+        }
+
+        auto trackId = internalTrackIdFromFileName(oneOfflineTrack);
+        if (trackId != 0) {
+            hiddenTracks.push_back(trackId);
+
+            for (auto artistId : internalArtistIdsFromTrackId(trackId)) {
+                touchedArtists.insert(artistId);
+            }
+        }
+    }
+
+    refreshAlbumSummaries();
+
+    QList<qulonglong> hiddenAlbums;
+    for (auto albumId : qAsConst(touchedAlbums)) {
+        if (!internalAlbumHasOnlineTracks(albumId)) {
+            hiddenAlbums.push_back(albumId);
+        }
+    }
+
+    QList<qulonglong> hiddenArtists;
+    for (auto artistId : qAsConst(touchedArtists)) {
+        if (!internalArtistHasOnlineTracks(artistId)) {
+            hiddenArtists.push_back(artistId);
+        }
+    }
+
+    if (!hiddenTracks.isEmpty()) {
+        increaseCollectionGeneration();
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::setTracksOffline" << hiddenTracks.size() << "tracks are offline";
+
+    if (!hiddenTracks.isEmpty()) {
+        Q_EMIT tracksRemoved(hiddenTracks);
+    }
+
+    if (!hiddenAlbums.isEmpty()) {
+        Q_EMIT albumsRemoved(hiddenAlbums);
+    }
+
+    if (!hiddenArtists.isEmpty()) {
+        Q_EMIT artistsRemoved(hiddenArtists);
+    }
+}
+
+void DatabaseInterface::setDirectoryOnline(const QUrl &rootPath)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto childPathPrefix = rootPath.toString();
+    if (!childPathPrefix.endsWith(QLatin1Char('/'))) {
+        childPathPrefix += QLatin1Char('/');
+    }
+
+    QList<qulonglong> restoredTracksIds;
+    QSet<qulonglong> touchedAlbums;
+
+    d->mSelectOfflineTracksInDirectoryQuery.bindValue(QStringLiteral(":pathPrefix"), childPathPrefix);
+    d->mSelectOfflineTracksInDirectoryQuery.bindValue(QStringLiteral(":childPathPrefix"), childPathPrefix);
+
+    auto queryResult = execQuery(d->mSelectOfflineTracksInDirectoryQuery);
+
+    if (!queryResult || !d->mSelectOfflineTracksInDirectoryQuery.isSelect() || !d->mSelectOfflineTracksInDirectoryQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mSelectOfflineTracksInDirectoryQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mSelectOfflineTracksInDirectoryQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mSelectOfflineTracksInDirectoryQuery.lastError();
+
+        d->mSelectOfflineTracksInDirectoryQuery.finish();
+
+        finishTransaction();
+
+        return;
+    }
+
+    while (d->mSelectOfflineTracksInDirectoryQuery.next()) {
+        const auto &currentRecord = d->mSelectOfflineTracksInDirectoryQuery.record();
+
+        restoredTracksIds.push_back(currentRecord.value(0).toULongLong());
+
+        if (!currentRecord.value(1).isNull()) {
+            touchedAlbums.insert(currentRecord.value(1).toULongLong());
+        }
+    }
+
+    d->mSelectOfflineTracksInDirectoryQuery.finish();
+
+    if (restoredTracksIds.isEmpty()) {
+        finishTransaction();
+        return;
+    }
+
+    QList<qulonglong> shownAlbumsIds;
+    for (auto albumId : qAsConst(touchedAlbums)) {
+        d->mStaleAlbumSummaries.insert(albumId);
+
+        if (!internalAlbumHasOnlineTracks(albumId)) {
+            shownAlbumsIds.push_back(albumId);
+        }
+    }
+
+    QSet<qulonglong> touchedArtists;
+    for (auto trackId : qAsConst(restoredTracksIds)) {
+        for (auto artistId : internalArtistIdsFromTrackId(trackId)) {
+            touchedArtists.insert(artistId);
+        }
+    }
+
+    ListArtistDataType shownArtists;
+    for (auto artistId : qAsConst(touchedArtists)) {
+        if (!internalArtistHasOnlineTracks(artistId)) {
+            shownArtists.push_back({{DatabaseIdRole, artistId}});
+        }
+    }
+
+    d->mUpdateDirectoryOnlineQuery.bindValue(QStringLiteral(":pathPrefix"), childPathPrefix);
+    d->mUpdateDirectoryOnlineQuery.bindValue(QStringLiteral(":childPathPrefix"), childPathPrefix);
+
+    queryResult = execQuery(d->mUpdateDirectoryOnlineQuery);
+
+    if (!queryResult || !d->mUpdateDirectoryOnlineQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mUpdateDirectoryOnlineQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mUpdateDirectoryOnlineQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << d->mUpdateDirectoryOnlineQuery.lastError();
+
+        d->mUpdateDirectoryOnlineQuery.finish();
+
+        finishTransaction();
+
+        return;
+    }
+
+    d->mUpdateDirectoryOnlineQuery.finish();
+
+    refreshAlbumSummaries();
+
+    increaseCollectionGeneration();
+
+    const auto &restoredTracksData = internalTracksPartialData(restoredTracksIds);
+
+    ListAlbumDataType shownAlbums;
+    for (auto albumId : qAsConst(shownAlbumsIds)) {
+        shownAlbums.push_back(internalOneAlbumPartialData(albumId));
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::setDirectoryOnline" << rootPath << restoredTracksData.size() << "tracks are online again";
+
+    if (!shownArtists.isEmpty()) {
+        Q_EMIT artistsAdded(shownArtists);
+    }
+
+    if (!shownAlbums.isEmpty()) {
+        Q_EMIT albumsAdded(shownAlbums);
+    }
+
+    Q_EMIT tracksAdded(restoredTracksData);
+}
+
 bool DatabaseInterface::startTransaction() const
 {
     auto result = false;
@@ -1052,6 +2803,10 @@ bool DatabaseInterface::startTransaction() const
         return result;
     }
 
+    if (orgKdeElisaDatabaseProfiler().isDebugEnabled()) {
+        d->mTransactionTimer.start();
+    }
+
     result = true;
 
     return result;
@@ -1063,6 +2818,8 @@ bool DatabaseInterface::finishTransaction() const
 
     auto transactionResult = d->mTracksDatabase.commit();
 
+    recordTransactionDuration();
+
     if (!transactionResult) {
         qCDebug(orgKdeElisaDatabase) << "commit failed" << d->mTracksDatabase.lastError() << d->mTracksDatabase.lastError().nativeErrorCode();
 
@@ -1074,12 +2831,24 @@ bool DatabaseInterface::finishTransaction() const
     return result;
 }
 
+void DatabaseInterface::recordTransactionDuration() const
+{
+    if (!d->mTransactionTimer.isValid()) {
+        return;
+    }
+
+    d->mTransactionStatistics.record(d->mTransactionTimer.nsecsElapsed(), 0);
+    d->mTransactionTimer.invalidate();
+}
+
 bool DatabaseInterface::rollBackTransaction() const
 {
     auto result = false;
 
     auto transactionResult = d->mTracksDatabase.rollback();
 
+    recordTransactionDuration();
+
     if (!transactionResult) {
         qCDebug(orgKdeElisaDatabase) << "commit failed" << d->mTracksDatabase.lastError() << d->mTracksDatabase.lastError().nativeErrorCode();
 
@@ -1153,6 +2922,15 @@ void DatabaseInterface::initDatabase()
         upgradeDatabaseV11();
         upgradeDatabaseV12();
         upgradeDatabaseV13();
+        upgradeDatabaseV14();
+        upgradeDatabaseV15();
+        upgradeDatabaseV16();
+        upgradeDatabaseV17();
+        upgradeDatabaseV18();
+        upgradeDatabaseV19();
+        upgradeDatabaseV20();
+        upgradeDatabaseV21();
+        upgradeDatabaseV22();
 
         checkDatabaseSchema();
     } else if (listTables.contains(QStringLiteral("DatabaseVersionV9"))) {
@@ -1162,8 +2940,35 @@ void DatabaseInterface::initDatabase()
         if (!listTables.contains(QStringLiteral("DatabaseVersionV12"))) {
             upgradeDatabaseV12();
         }
-        if (!listTables.contains(QStringLiteral("DatabaseVersionV13"))) {
-            upgradeDatabaseV13();
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV13"))) {
+            upgradeDatabaseV13();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV14"))) {
+            upgradeDatabaseV14();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV15"))) {
+            upgradeDatabaseV15();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV16"))) {
+            upgradeDatabaseV16();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV17"))) {
+            upgradeDatabaseV17();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV18"))) {
+            upgradeDatabaseV18();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV19"))) {
+            upgradeDatabaseV19();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV20"))) {
+            upgradeDatabaseV20();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV21"))) {
+            upgradeDatabaseV21();
+        }
+        if (!listTables.contains(QStringLiteral("DatabaseVersionV22"))) {
+            upgradeDatabaseV22();
         }
 
         checkDatabaseSchema();
@@ -1172,6 +2977,15 @@ void DatabaseInterface::initDatabase()
         upgradeDatabaseV11();
         upgradeDatabaseV12();
         upgradeDatabaseV13();
+        upgradeDatabaseV14();
+        upgradeDatabaseV15();
+        upgradeDatabaseV16();
+        upgradeDatabaseV17();
+        upgradeDatabaseV18();
+        upgradeDatabaseV19();
+        upgradeDatabaseV20();
+        upgradeDatabaseV21();
+        upgradeDatabaseV22();
     }
 }
 
@@ -2261,10 +4075,296 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                         "`TracksData` td"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastError();
-
-            Q_EMIT databaseError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery copyDataQuery(d->mTracksDatabase);
+
+        auto result = copyDataQuery.exec(QStringLiteral("INSERT INTO `NewTracks` "
+                                                        "SELECT "
+                                                        "t.`ID`, "
+                                                        "t.`FileName`, "
+                                                        "t.`Priority`, "
+                                                        "t.`Title`, "
+                                                        "t.`ArtistName`, "
+                                                        "t.`AlbumTitle`, "
+                                                        "t.`AlbumArtistName`, "
+                                                        "t.`AlbumPath`, "
+                                                        "t.`TrackNumber`, "
+                                                        "t.`DiscNumber`, "
+                                                        "t.`Duration`, "
+                                                        "t.`Rating`, "
+                                                        "t.`Genre`, "
+                                                        "t.`Composer`, "
+                                                        "t.`Lyricist`, "
+                                                        "t.`Comment`, "
+                                                        "t.`Year`, "
+                                                        "t.`Channels`, "
+                                                        "t.`BitRate`, "
+                                                        "t.`SampleRate`, "
+                                                        "t.`HasEmbeddedCover` "
+                                                        "FROM "
+                                                        "`Tracks` t"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        auto result = createSchemaQuery.exec(QStringLiteral("DROP TABLE `TracksData`"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        auto result = createSchemaQuery.exec(QStringLiteral("DROP TABLE `Tracks`"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        auto result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `NewTracksData` RENAME TO `TracksData`"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        auto result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `NewTracks` RENAME TO `Tracks`"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    d->mTracksDatabase.commit();
+
+    {
+        QSqlQuery enableForeignKeys(d->mTracksDatabase);
+
+        auto result = enableForeignKeys.exec(QStringLiteral(" PRAGMA foreign_keys=ON"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << enableForeignKeys.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << enableForeignKeys.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksAlbumIndex` ON `Tracks` "
+                                                                  "(`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`ArtistNameIndex` ON `Tracks` "
+                                                                  "(`ArtistName`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`AlbumArtistNameIndex` ON `Tracks` "
+                                                                  "(`AlbumArtistName`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksUniqueData` ON `Tracks` "
+                                                                  "(`Title`, `ArtistName`, "
+                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksUniqueDataPriority` ON `Tracks` "
+                                                                  "(`Priority`, `Title`, `ArtistName`, "
+                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TracksFileNameIndex` ON `Tracks` "
+                                                                  "(`FileName`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v12 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV13()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v13 of database schema";
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV13` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery disableForeignKeys(d->mTracksDatabase);
+
+        auto result = disableForeignKeys.exec(QStringLiteral(" PRAGMA foreign_keys=OFF"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << disableForeignKeys.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << disableForeignKeys.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    d->mTracksDatabase.transaction();
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `NewTracks` ("
+                                                                   "`ID` INTEGER PRIMARY KEY AUTOINCREMENT, "
+                                                                   "`FileName` VARCHAR(255) NOT NULL, "
+                                                                   "`Priority` INTEGER NOT NULL, "
+                                                                   "`Title` VARCHAR(85) NOT NULL, "
+                                                                   "`ArtistName` VARCHAR(55), "
+                                                                   "`AlbumTitle` VARCHAR(55), "
+                                                                   "`AlbumArtistName` VARCHAR(55), "
+                                                                   "`AlbumPath` VARCHAR(255), "
+                                                                   "`TrackNumber` INTEGER, "
+                                                                   "`DiscNumber` INTEGER, "
+                                                                   "`Duration` INTEGER NOT NULL, "
+                                                                   "`Rating` INTEGER NOT NULL DEFAULT 0, "
+                                                                   "`Genre` VARCHAR(55), "
+                                                                   "`Composer` VARCHAR(55), "
+                                                                   "`Lyricist` VARCHAR(55), "
+                                                                   "`Comment` VARCHAR(255), "
+                                                                   "`Year` INTEGER, "
+                                                                   "`Channels` INTEGER, "
+                                                                   "`BitRate` INTEGER, "
+                                                                   "`SampleRate` INTEGER, "
+                                                                   "`HasEmbeddedCover` BOOLEAN NOT NULL, "
+                                                                   "UNIQUE ("
+                                                                   "`FileName`"
+                                                                   "), "
+                                                                   "UNIQUE ("
+                                                                   "`Priority`, `Title`, `ArtistName`, "
+                                                                   "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
+                                                                   "`TrackNumber`, `DiscNumber`"
+                                                                   "), "
+                                                                   "CONSTRAINT fk_fileName FOREIGN KEY (`FileName`) "
+                                                                   "REFERENCES `TracksData`(`FileName`) ON DELETE CASCADE, "
+                                                                   "CONSTRAINT fk_artist FOREIGN KEY (`ArtistName`) REFERENCES `Artists`(`Name`), "
+                                                                   "CONSTRAINT fk_tracks_composer FOREIGN KEY (`Composer`) REFERENCES `Composer`(`Name`), "
+                                                                   "CONSTRAINT fk_tracks_lyricist FOREIGN KEY (`Lyricist`) REFERENCES `Lyricist`(`Name`), "
+                                                                   "CONSTRAINT fk_tracks_genre FOREIGN KEY (`Genre`) REFERENCES `Genre`(`Name`), "
+                                                                   "CONSTRAINT fk_tracks_album FOREIGN KEY ("
+                                                                   "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"
+                                                                   "REFERENCES `Albums`(`Title`, `ArtistName`, `AlbumPath`))"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
         }
     }
 
@@ -2298,21 +4398,8 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                         "`Tracks` t"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << copyDataQuery.lastError();
-
-            Q_EMIT databaseError();
-        }
-    }
-
-    {
-        QSqlQuery createSchemaQuery(d->mTracksDatabase);
-
-        auto result = createSchemaQuery.exec(QStringLiteral("DROP TABLE `TracksData`"));
-
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << copyDataQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << copyDataQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2324,21 +4411,8 @@ void DatabaseInterface::upgradeDatabaseV12()
         auto result = createSchemaQuery.exec(QStringLiteral("DROP TABLE `Tracks`"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
-
-            Q_EMIT databaseError();
-        }
-    }
-
-    {
-        QSqlQuery createSchemaQuery(d->mTracksDatabase);
-
-        auto result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `NewTracksData` RENAME TO `TracksData`"));
-
-        if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2350,8 +4424,8 @@ void DatabaseInterface::upgradeDatabaseV12()
         auto result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `NewTracks` RENAME TO `Tracks`"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2365,8 +4439,8 @@ void DatabaseInterface::upgradeDatabaseV12()
         auto result = enableForeignKeys.exec(QStringLiteral(" PRAGMA foreign_keys=ON"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << enableForeignKeys.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << enableForeignKeys.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << enableForeignKeys.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << enableForeignKeys.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2381,8 +4455,8 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "(`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2397,8 +4471,8 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "(`ArtistName`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2413,8 +4487,8 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "(`AlbumArtistName`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2427,11 +4501,12 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "IF NOT EXISTS "
                                                                   "`TracksUniqueData` ON `Tracks` "
                                                                   "(`Title`, `ArtistName`, "
-                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
+                                                                  "`TrackNumber`, `DiscNumber`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2444,11 +4519,12 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "IF NOT EXISTS "
                                                                   "`TracksUniqueDataPriority` ON `Tracks` "
                                                                   "(`Priority`, `Title`, `ArtistName`, "
-                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
+                                                                  "`TrackNumber`, `DiscNumber`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2463,142 +4539,259 @@ void DatabaseInterface::upgradeDatabaseV12()
                                                                   "(`FileName`)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV12" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
-    qCInfo(orgKdeElisaDatabase) << "finished update to v12 of database schema";
+    qCInfo(orgKdeElisaDatabase) << "finished update to v13 of database schema";
 }
 
-void DatabaseInterface::upgradeDatabaseV13()
+void DatabaseInterface::upgradeDatabaseV14()
 {
-    qCInfo(orgKdeElisaDatabase) << "begin update to v13 of database schema";
+    qCInfo(orgKdeElisaDatabase) << "begin update to v14 of database schema";
 
     {
         QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV13` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV14` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV14" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV14" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        QSqlQuery disableForeignKeys(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        auto result = disableForeignKeys.exec(QStringLiteral(" PRAGMA foreign_keys=OFF"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DirectoriesData` ("
+                                                                   "`Path` VARCHAR(255) PRIMARY KEY NOT NULL, "
+                                                                   "`ModifiedTime` DATETIME NOT NULL, "
+                                                                   "`EntriesCount` INTEGER NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << disableForeignKeys.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << disableForeignKeys.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV14" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV14" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
-    d->mTracksDatabase.transaction();
+    qCInfo(orgKdeElisaDatabase) << "finished update to v14 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV15()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v15 of database schema";
 
     {
         QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `NewTracks` ("
-                                                                   "`ID` INTEGER PRIMARY KEY AUTOINCREMENT, "
-                                                                   "`FileName` VARCHAR(255) NOT NULL, "
-                                                                   "`Priority` INTEGER NOT NULL, "
-                                                                   "`Title` VARCHAR(85) NOT NULL, "
-                                                                   "`ArtistName` VARCHAR(55), "
-                                                                   "`AlbumTitle` VARCHAR(55), "
-                                                                   "`AlbumArtistName` VARCHAR(55), "
-                                                                   "`AlbumPath` VARCHAR(255), "
-                                                                   "`TrackNumber` INTEGER, "
-                                                                   "`DiscNumber` INTEGER, "
-                                                                   "`Duration` INTEGER NOT NULL, "
-                                                                   "`Rating` INTEGER NOT NULL DEFAULT 0, "
-                                                                   "`Genre` VARCHAR(55), "
-                                                                   "`Composer` VARCHAR(55), "
-                                                                   "`Lyricist` VARCHAR(55), "
-                                                                   "`Comment` VARCHAR(255), "
-                                                                   "`Year` INTEGER, "
-                                                                   "`Channels` INTEGER, "
-                                                                   "`BitRate` INTEGER, "
-                                                                   "`SampleRate` INTEGER, "
-                                                                   "`HasEmbeddedCover` BOOLEAN NOT NULL, "
-                                                                   "UNIQUE ("
-                                                                   "`FileName`"
-                                                                   "), "
-                                                                   "UNIQUE ("
-                                                                   "`Priority`, `Title`, `ArtistName`, "
-                                                                   "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
-                                                                   "`TrackNumber`, `DiscNumber`"
-                                                                   "), "
-                                                                   "CONSTRAINT fk_fileName FOREIGN KEY (`FileName`) "
-                                                                   "REFERENCES `TracksData`(`FileName`) ON DELETE CASCADE, "
-                                                                   "CONSTRAINT fk_artist FOREIGN KEY (`ArtistName`) REFERENCES `Artists`(`Name`), "
-                                                                   "CONSTRAINT fk_tracks_composer FOREIGN KEY (`Composer`) REFERENCES `Composer`(`Name`), "
-                                                                   "CONSTRAINT fk_tracks_lyricist FOREIGN KEY (`Lyricist`) REFERENCES `Lyricist`(`Name`), "
-                                                                   "CONSTRAINT fk_tracks_genre FOREIGN KEY (`Genre`) REFERENCES `Genre`(`Name`), "
-                                                                   "CONSTRAINT fk_tracks_album FOREIGN KEY ("
-                                                                   "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"
-                                                                   "REFERENCES `Albums`(`Title`, `ArtistName`, `AlbumPath`))"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV15` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `AlbumSummary` ("
+                                                                   "`AlbumID` INTEGER PRIMARY KEY NOT NULL, "
+                                                                   "`AllArtists` TEXT, "
+                                                                   "`AllGenres` TEXT, "
+                                                                   "`HighestRating` INTEGER, "
+                                                                   "`DiscsCount` INTEGER NOT NULL DEFAULT 0, "
+                                                                   "`TracksCount` INTEGER NOT NULL DEFAULT 0, "
+                                                                   "`EmbeddedCover` VARCHAR(255) DEFAULT NULL, "
+                                                                   "CONSTRAINT fk_albumsummary_album FOREIGN KEY (`AlbumID`) REFERENCES `Albums`(`ID`))"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TitleNoCaseAlbumsIndex` ON `Albums` "
+                                                                  "(`Title` COLLATE NOCASE)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery fillSummaryQuery(d->mTracksDatabase);
+
+        const auto &result = fillSummaryQuery.exec(refreshAlbumSummaryQueryText({}, false));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << fillSummaryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV15" << fillSummaryQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v15 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV16()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v16 of database schema";
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV16` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`TitleNoCaseTracksIndex` ON `Tracks` "
+                                                                  "(`Title` COLLATE NOCASE, `ID`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createTrackIndex(d->mTracksDatabase);
+
+        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
+                                                                  "IF NOT EXISTS "
+                                                                  "`NameNoCaseArtistsIndex` ON `Artists` "
+                                                                  "(`Name` COLLATE NOCASE, `ID`)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createTrackIndex.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV16" << createTrackIndex.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v16 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV17()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v17 of database schema";
+
+    // the version marker is only written once the search index is complete so that a
+    // failed or interrupted update is tried again at the next start
+    {
+        QSqlQuery dropSearchQuery(d->mTracksDatabase);
+
+        const auto &result = dropSearchQuery.exec(QStringLiteral("DROP TABLE IF EXISTS `TracksSearch`"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << dropSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << dropSearchQuery.lastError();
+
+            return;
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE VIRTUAL TABLE `TracksSearch` USING fts5("
+                                                                   "`Title`, "
+                                                                   "`ArtistName`, "
+                                                                   "`AlbumTitle`, "
+                                                                   "`AlbumArtistName`, "
+                                                                   "prefix = '1 2 3')"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
+            // the search index is optional, views fall back to filtering in memory without it
+            qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << "full-text search is not available" << createSchemaQuery.lastError();
+
+            return;
         }
     }
 
     {
-        QSqlQuery copyDataQuery(d->mTracksDatabase);
+        QSqlQuery fillSearchQuery(d->mTracksDatabase);
 
-        auto result = copyDataQuery.exec(QStringLiteral("INSERT INTO `NewTracks` "
-                                                        "SELECT "
-                                                        "t.`ID`, "
-                                                        "t.`FileName`, "
-                                                        "t.`Priority`, "
-                                                        "t.`Title`, "
-                                                        "t.`ArtistName`, "
-                                                        "t.`AlbumTitle`, "
-                                                        "t.`AlbumArtistName`, "
-                                                        "t.`AlbumPath`, "
-                                                        "t.`TrackNumber`, "
-                                                        "t.`DiscNumber`, "
-                                                        "t.`Duration`, "
-                                                        "t.`Rating`, "
-                                                        "t.`Genre`, "
-                                                        "t.`Composer`, "
-                                                        "t.`Lyricist`, "
-                                                        "t.`Comment`, "
-                                                        "t.`Year`, "
-                                                        "t.`Channels`, "
-                                                        "t.`BitRate`, "
-                                                        "t.`SampleRate`, "
-                                                        "t.`HasEmbeddedCover` "
-                                                        "FROM "
-                                                        "`Tracks` t"));
+        const auto &result = fillSearchQuery.exec(QStringLiteral("INSERT INTO `TracksSearch` "
+                                                                 "(`rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`) "
+                                                                 "SELECT `ID`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName` "
+                                                                 "FROM `Tracks`"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << copyDataQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << copyDataQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << fillSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << fillSearchQuery.lastError();
+
+            // a partial index would silently miss tracks in the search results
+            QSqlQuery dropSearchQuery(d->mTracksDatabase);
+            dropSearchQuery.exec(QStringLiteral("DROP TABLE IF EXISTS `TracksSearch`"));
+
+            return;
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV17` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV17" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
+    qCInfo(orgKdeElisaDatabase) << "finished update to v17 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV18()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v18 of database schema";
+
     {
         QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        auto result = createSchemaQuery.exec(QStringLiteral("DROP TABLE `Tracks`"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV18` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
@@ -2607,132 +4800,176 @@ void DatabaseInterface::upgradeDatabaseV13()
     {
         QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        auto result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `NewTracks` RENAME TO `Tracks`"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `TracksData` "
+                                                                   "ADD COLUMN `IsOffline` BOOLEAN NOT NULL DEFAULT 0"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createSchemaQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV18" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
-    d->mTracksDatabase.commit();
+    qCInfo(orgKdeElisaDatabase) << "finished update to v18 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV19()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v19 of database schema";
 
     {
-        QSqlQuery enableForeignKeys(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        auto result = enableForeignKeys.exec(QStringLiteral(" PRAGMA foreign_keys=ON"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV19` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << enableForeignKeys.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << enableForeignKeys.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksAlbumIndex` ON `Tracks` "
-                                                                  "(`AlbumTitle`, `AlbumArtistName`, `AlbumPath`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `Albums` "
+                                                                   "ADD COLUMN `CoverCacheKey` VARCHAR(40) DEFAULT NULL"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV19" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
+    qCInfo(orgKdeElisaDatabase) << "finished update to v19 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV20()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v20 of database schema";
+
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`ArtistNameIndex` ON `Tracks` "
-                                                                  "(`ArtistName`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV20` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`AlbumArtistNameIndex` ON `Tracks` "
-                                                                  "(`AlbumArtistName`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `TracksLyrics` ("
+                                                                   "`FileName` VARCHAR(255) NOT NULL, "
+                                                                   "`FileModifiedTime` DATETIME NOT NULL, "
+                                                                   "`IsCompressed` BOOLEAN NOT NULL, "
+                                                                   "`Lyrics` BLOB NOT NULL, "
+                                                                   "PRIMARY KEY (`FileName`), "
+                                                                   "CONSTRAINT fk_lyrics_fileName FOREIGN KEY (`FileName`) "
+                                                                   "REFERENCES `TracksData`(`FileName`) ON DELETE CASCADE)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV20" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
+    qCInfo(orgKdeElisaDatabase) << "finished update to v20 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV21()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v21 of database schema";
+
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksUniqueData` ON `Tracks` "
-                                                                  "(`Title`, `ArtistName`, "
-                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
-                                                                  "`TrackNumber`, `DiscNumber`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV21` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV21" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV21" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksUniqueDataPriority` ON `Tracks` "
-                                                                  "(`Priority`, `Title`, `ArtistName`, "
-                                                                  "`AlbumTitle`, `AlbumArtistName`, `AlbumPath`, "
-                                                                  "`TrackNumber`, `DiscNumber`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("ALTER TABLE `DirectoriesData` "
+                                                                   "ADD COLUMN `MountPoint` VARCHAR(255) DEFAULT NULL"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV21" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV21" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
+    qCInfo(orgKdeElisaDatabase) << "finished update to v21 of database schema";
+}
+
+void DatabaseInterface::upgradeDatabaseV22()
+{
+    qCInfo(orgKdeElisaDatabase) << "begin update to v22 of database schema";
+
     {
-        QSqlQuery createTrackIndex(d->mTracksDatabase);
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
 
-        const auto &result = createTrackIndex.exec(QStringLiteral("CREATE INDEX "
-                                                                  "IF NOT EXISTS "
-                                                                  "`TracksFileNameIndex` ON `Tracks` "
-                                                                  "(`FileName`)"));
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `DatabaseVersionV22` (`Version` INTEGER PRIMARY KEY NOT NULL)"));
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV13" << createTrackIndex.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
-    qCInfo(orgKdeElisaDatabase) << "finished update to v13 of database schema";
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `CollectionIdentity` ("
+                                                                   "`Identity` VARCHAR(40) NOT NULL)"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        createSchemaQuery.prepare(QStringLiteral("INSERT INTO `CollectionIdentity` (`Identity`) VALUES (:identity)"));
+        createSchemaQuery.bindValue(QStringLiteral(":identity"), QUuid::createUuid().toString());
+
+        const auto &result = createSchemaQuery.exec();
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::upgradeDatabaseV22" << createSchemaQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    qCInfo(orgKdeElisaDatabase) << "finished update to v22 of database schema";
 }
 
 void DatabaseInterface::checkDatabaseSchema()
@@ -2785,13 +5022,34 @@ void DatabaseInterface::checkDatabaseSchema()
         resetDatabase();
         return;
     }
+
+    checkDirectoriesDataTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkAlbumSummaryTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
+
+    checkTracksLyricsTableSchema();
+    if (d->mIsInBadState)
+    {
+        resetDatabase();
+        return;
+    }
 }
 
 void DatabaseInterface::checkAlbumsTableSchema()
 {
     auto fieldsList = QStringList{QStringLiteral("ID"), QStringLiteral("Title"),
                                   QStringLiteral("ArtistName"), QStringLiteral("AlbumPath"),
-                                  QStringLiteral("CoverFileName")};
+                                  QStringLiteral("CoverFileName"), QStringLiteral("CoverCacheKey")};
 
     genericCheckTable(QStringLiteral("Albums"), fieldsList);
 }
@@ -2845,26 +5103,188 @@ void DatabaseInterface::checkTracksDataTableSchema()
 {
     auto fieldsList = QStringList{QStringLiteral("FileName"), QStringLiteral("FileModifiedTime"),
                                   QStringLiteral("ImportDate"), QStringLiteral("FirstPlayDate"),
-                                  QStringLiteral("LastPlayDate"), QStringLiteral("PlayCounter")};
+                                  QStringLiteral("LastPlayDate"), QStringLiteral("PlayCounter"),
+                                  QStringLiteral("IsOffline")};
 
     genericCheckTable(QStringLiteral("TracksData"), fieldsList);
 }
 
-void DatabaseInterface::genericCheckTable(const QString &tableName, const QStringList &expectedColumns)
-{
-    auto columnsList = d->mTracksDatabase.record(tableName);
+void DatabaseInterface::checkDirectoriesDataTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("Path"), QStringLiteral("ModifiedTime"),
+                                  QStringLiteral("EntriesCount"), QStringLiteral("MountPoint")};
+
+    genericCheckTable(QStringLiteral("DirectoriesData"), fieldsList);
+}
+
+void DatabaseInterface::checkAlbumSummaryTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("AlbumID"), QStringLiteral("AllArtists"),
+                                  QStringLiteral("AllGenres"), QStringLiteral("HighestRating"),
+                                  QStringLiteral("DiscsCount"), QStringLiteral("TracksCount"),
+                                  QStringLiteral("EmbeddedCover")};
+
+    genericCheckTable(QStringLiteral("AlbumSummary"), fieldsList);
+}
+
+void DatabaseInterface::checkTracksLyricsTableSchema()
+{
+    auto fieldsList = QStringList{QStringLiteral("FileName"), QStringLiteral("FileModifiedTime"),
+                                  QStringLiteral("IsCompressed"), QStringLiteral("Lyrics")};
+
+    genericCheckTable(QStringLiteral("TracksLyrics"), fieldsList);
+}
+
+void DatabaseInterface::genericCheckTable(const QString &tableName, const QStringList &expectedColumns)
+{
+    auto columnsList = d->mTracksDatabase.record(tableName);
+
+    if (columnsList.count() != expectedColumns.count()) {
+        qCInfo(orgKdeElisaDatabase()) << tableName << "table has wrong number of columns" << columnsList.count() << "expected" << expectedColumns.count();
+        d->mIsInBadState = true;
+        return;
+    }
+
+    for (const auto &oneField : expectedColumns) {
+        if (!columnsList.contains(oneField)) {
+            qCInfo(orgKdeElisaDatabase()) << tableName << "table has missing column" << oneField;
+            d->mIsInBadState = true;
+            return;
+        }
+    }
+}
+
+void DatabaseInterface::initSearchRequest()
+{
+    d->mHasSearchIndex = d->mTracksDatabase.tables().contains(QStringLiteral("TracksSearch"));
+
+    if (!d->mHasSearchIndex) {
+        qCInfo(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << "no full-text search index";
+        return;
+    }
+
+    {
+        auto removeTrackSearchQueryText = QStringLiteral("DELETE FROM `TracksSearch` "
+                                                         "WHERE "
+                                                         "`rowid` = :trackId");
+
+        auto result = prepareQuery(d->mRemoveTrackSearchQuery, removeTrackSearchQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mRemoveTrackSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mRemoveTrackSearchQuery.lastError();
+
+            d->mHasSearchIndex = false;
+        }
+    }
+
+    {
+        auto insertTrackSearchQueryText = QStringLiteral("INSERT INTO `TracksSearch` "
+                                                         "(`rowid`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName`) "
+                                                         "SELECT `ID`, `Title`, `ArtistName`, `AlbumTitle`, `AlbumArtistName` "
+                                                         "FROM `Tracks` "
+                                                         "WHERE "
+                                                         "`ID` = :trackId");
+
+        auto result = prepareQuery(d->mInsertTrackSearchQuery, insertTrackSearchQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mInsertTrackSearchQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mInsertTrackSearchQuery.lastError();
+
+            d->mHasSearchIndex = false;
+        }
+    }
+
+    {
+        auto clearSearchTableText = QStringLiteral("DELETE FROM `TracksSearch`");
+
+        auto result = prepareQuery(d->mClearSearchTable, clearSearchTableText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mClearSearchTable.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mClearSearchTable.lastError();
+
+            d->mHasSearchIndex = false;
+        }
+    }
+
+    {
+        auto searchTracksQueryText = QStringLiteral("SELECT "
+                                                    "`rowid` "
+                                                    "FROM "
+                                                    "`TracksSearch` "
+                                                    "WHERE "
+                                                    "`TracksSearch` MATCH :matchExpression "
+                                                    "ORDER BY `rank`");
+
+        auto result = prepareQuery(d->mSearchTracksQuery, searchTracksQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchTracksQuery.lastError();
+
+            d->mHasSearchIndex = false;
+        }
+    }
+
+    {
+        auto searchAlbumsQueryText = QStringLiteral("SELECT "
+                                                    "album.`ID` "
+                                                    "FROM "
+                                                    "("
+                                                    "SELECT `rowid`, `rank` "
+                                                    "FROM `TracksSearch` "
+                                                    "WHERE `TracksSearch` MATCH :matchExpression"
+                                                    ") search, "
+                                                    "`Tracks` tracks, "
+                                                    "`Albums` album "
+                                                    "WHERE "
+                                                    "tracks.`ID` = search.`rowid` AND "
+                                                    "tracks.`AlbumTitle` = album.`Title` AND "
+                                                    "(tracks.`AlbumArtistName` = album.`ArtistName` OR "
+                                                    "(tracks.`AlbumArtistName` IS NULL AND "
+                                                    "album.`ArtistName` IS NULL"
+                                                    ")"
+                                                    ") AND "
+                                                    "tracks.`AlbumPath` = album.`AlbumPath` "
+                                                    "GROUP BY album.`ID` "
+                                                    "ORDER BY MIN(search.`rank`)");
+
+        auto result = prepareQuery(d->mSearchAlbumsQuery, searchAlbumsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchAlbumsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchAlbumsQuery.lastError();
+
+            d->mHasSearchIndex = false;
+        }
+    }
+
+    {
+        auto searchArtistsQueryText = QStringLiteral("SELECT "
+                                                     "artists.`ID` "
+                                                     "FROM "
+                                                     "("
+                                                     "SELECT `rowid`, `rank` "
+                                                     "FROM `TracksSearch` "
+                                                     "WHERE `TracksSearch` MATCH :matchExpression"
+                                                     ") search, "
+                                                     "`Tracks` tracks, "
+                                                     "`Artists` artists "
+                                                     "WHERE "
+                                                     "tracks.`ID` = search.`rowid` AND "
+                                                     "artists.`Name` = tracks.`ArtistName` "
+                                                     "GROUP BY artists.`ID` "
+                                                     "ORDER BY MIN(search.`rank`)");
+
+        auto result = prepareQuery(d->mSearchArtistsQuery, searchArtistsQueryText);
 
-    if (columnsList.count() != expectedColumns.count()) {
-        qCInfo(orgKdeElisaDatabase()) << tableName << "table has wrong number of columns" << columnsList.count() << "expected" << expectedColumns.count();
-        d->mIsInBadState = true;
-        return;
-    }
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchArtistsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initSearchRequest" << d->mSearchArtistsQuery.lastError();
 
-    for (const auto &oneField : expectedColumns) {
-        if (!columnsList.contains(oneField)) {
-            qCInfo(orgKdeElisaDatabase()) << tableName << "table has missing column" << oneField;
-            d->mIsInBadState = true;
-            return;
+            d->mHasSearchIndex = false;
         }
     }
 }
@@ -2951,7 +5371,8 @@ void DatabaseInterface::initRequest()
                                                    ") "
                                                    ") AND "
                                                    "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                   ") as EmbeddedCover "
+                                                   ") as EmbeddedCover, "
+                                                   "album.`CoverCacheKey` "
                                                    "FROM "
                                                    "`Albums` album LEFT JOIN "
                                                    "`Tracks` tracks ON "
@@ -3004,53 +5425,21 @@ void DatabaseInterface::initRequest()
                                                   "album.`ArtistName` as SecondaryText, "
                                                   "album.`CoverFileName`, "
                                                   "album.`ArtistName`, "
-                                                  "GROUP_CONCAT(tracks.`ArtistName`, ', ') as AllArtists, "
-                                                  "MAX(tracks.`Rating`) as HighestRating, "
-                                                  "GROUP_CONCAT(genres.`Name`, ', ') as AllGenres, "
-                                                  "("
-                                                  "SELECT "
-                                                  "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
-                                                  "FROM "
-                                                  "`Tracks` tracks2 "
-                                                  "WHERE "
-                                                  "tracks2.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracks2.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL"
-                                                  ")"
-                                                  ") AND "
-                                                  "tracks2.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as `IsSingleDiscAlbum`, "
-                                                  "( "
-                                                  "SELECT tracksCover.`FileName` "
-                                                  "FROM "
-                                                  "`Tracks` tracksCover "
-                                                  "WHERE "
-                                                  "tracksCover.`HasEmbeddedCover` = 1 AND "
-                                                  "tracksCover.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracksCover.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL "
-                                                  ") "
-                                                  ") AND "
-                                                  "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as EmbeddedCover "
+                                                  "summary.`AllArtists`, "
+                                                  "summary.`HighestRating`, "
+                                                  "summary.`AllGenres`, "
+                                                  "summary.`DiscsCount` <= 1 as `IsSingleDiscAlbum`, "
+                                                  "summary.`EmbeddedCover`, "
+                                                  "album.`CoverCacheKey` "
                                                   "FROM "
                                                   "`Albums` album, "
-                                                  "`Tracks` tracks LEFT JOIN "
-                                                  "`Genre` genres ON tracks.`Genre` = genres.`Name` "
+                                                  "`AlbumSummary` summary "
                                                   "WHERE "
-                                                  "tracks.`AlbumTitle` = album.`Title` AND "
-                                                  "(tracks.`AlbumArtistName` = album.`ArtistName` OR "
-                                                  "(tracks.`AlbumArtistName` IS NULL AND "
-                                                  "album.`ArtistName` IS NULL"
-                                                  ") "
-                                                  ") AND "
-                                                  "tracks.`AlbumPath` = album.`AlbumPath` "
-                                                  "GROUP BY album.`ID`, album.`Title`, album.`AlbumPath` "
-                                                  "ORDER BY album.`Title` COLLATE NOCASE");
+                                                  "summary.`AlbumID` = album.`ID` AND "
+                                                  "summary.`TracksCount` > 0 ");
 
-        auto result = prepareQuery(d->mSelectAllAlbumsShortQuery, selectAllAlbumsText);
+        auto result = prepareQuery(d->mSelectAllAlbumsShortQuery, selectAllAlbumsText +
+                                   QStringLiteral("ORDER BY album.`Title` COLLATE NOCASE"));
 
         if (!result) {
             qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllAlbumsShortQuery.lastQuery();
@@ -3058,6 +5447,20 @@ void DatabaseInterface::initRequest()
 
             Q_EMIT databaseError();
         }
+
+        result = prepareQuery(d->mSelectAlbumsShortPageQuery, selectAllAlbumsText +
+                              QStringLiteral("AND "
+                                             "(album.`Title` > :afterTitle COLLATE NOCASE OR "
+                                             "(album.`Title` = :afterTitle COLLATE NOCASE AND album.`ID` > :afterDatabaseId)) "
+                                             "ORDER BY album.`Title` COLLATE NOCASE, album.`ID` "
+                                             "LIMIT :maximumResults"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumsShortPageQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumsShortPageQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
     }
 
     {
@@ -3083,7 +5486,8 @@ void DatabaseInterface::initRequest()
                                                   ") "
                                                   ") AND "
                                                   "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as EmbeddedCover "
+                                                  ") as EmbeddedCover, "
+                                                  "album.`CoverCacheKey` "
                                                   "FROM "
                                                   "`Albums` album, "
                                                   "`Tracks` tracks LEFT JOIN "
@@ -3096,6 +5500,14 @@ void DatabaseInterface::initRequest()
                                                   ")"
                                                   ") AND "
                                                   "tracks.`AlbumPath` = album.`AlbumPath` AND "
+                                                  "NOT EXISTS ("
+                                                  "  SELECT 1 "
+                                                  "  FROM "
+                                                  "  `TracksData` offlineTracks "
+                                                  "  WHERE "
+                                                  "  offlineTracks.`FileName` = tracks.`FileName` AND "
+                                                  "  offlineTracks.`IsOffline` = 1"
+                                                  ") AND "
                                                   "EXISTS ("
                                                   "  SELECT tracks2.`Genre` "
                                                   "  FROM "
@@ -3144,7 +5556,8 @@ void DatabaseInterface::initRequest()
                                                   ") "
                                                   ") AND "
                                                   "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                  ") as EmbeddedCover "
+                                                  ") as EmbeddedCover, "
+                                                  "album.`CoverCacheKey` "
                                                   "FROM "
                                                   "`Albums` album, "
                                                   "`Tracks` tracks LEFT JOIN "
@@ -3157,6 +5570,14 @@ void DatabaseInterface::initRequest()
                                                   ")"
                                                   ") AND "
                                                   "tracks.`AlbumPath` = album.`AlbumPath` AND "
+                                                  "NOT EXISTS ("
+                                                  "  SELECT 1 "
+                                                  "  FROM "
+                                                  "  `TracksData` offlineTracks "
+                                                  "  WHERE "
+                                                  "  offlineTracks.`FileName` = tracks.`FileName` AND "
+                                                  "  offlineTracks.`IsOffline` = 1"
+                                                  ") AND "
                                                   "EXISTS ("
                                                   "  SELECT tracks2.`Genre` "
                                                   "  FROM "
@@ -3186,10 +5607,21 @@ void DatabaseInterface::initRequest()
                                                              "FROM `Artists` artists  LEFT JOIN "
                                                              "`Tracks` tracks ON artists.`Name` = tracks.`ArtistName` LEFT JOIN "
                                                              "`Genre` genres ON tracks.`Genre` = genres.`Name` "
-                                                             "GROUP BY artists.`ID` "
-                                                             "ORDER BY artists.`Name` COLLATE NOCASE");
-
-        auto result = prepareQuery(d->mSelectAllArtistsQuery, selectAllArtistsWithFilterText);
+                                                             "WHERE "
+                                                             "EXISTS ("
+                                                             "  SELECT 1 "
+                                                             "  FROM "
+                                                             "  `Tracks` tracks2, "
+                                                             "  `TracksData` tracksMapping "
+                                                             "  WHERE "
+                                                             "  (tracks2.`ArtistName` = artists.`Name` OR tracks2.`AlbumArtistName` = artists.`Name`) AND "
+                                                             "  tracksMapping.`FileName` = tracks2.`FileName` AND "
+                                                             "  tracksMapping.`IsOffline` = 0"
+                                                             ") "
+                                                             "GROUP BY artists.`ID` ");
+
+        auto result = prepareQuery(d->mSelectAllArtistsQuery, selectAllArtistsWithFilterText +
+                                   QStringLiteral("ORDER BY artists.`Name` COLLATE NOCASE"));
 
         if (!result) {
             qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllArtistsQuery.lastQuery();
@@ -3197,6 +5629,43 @@ void DatabaseInterface::initRequest()
 
             Q_EMIT databaseError();
         }
+
+        // the page of artist ids is chosen before joining the tracks so that only those artists are aggregated
+        auto selectArtistsPageText = QStringLiteral("SELECT artists.`ID`, "
+                                                    "artists.`Name`, "
+                                                    "GROUP_CONCAT(genres.`Name`, ', ') as AllGenres "
+                                                    "FROM ("
+                                                    "  SELECT pageArtists.`ID`, pageArtists.`Name` "
+                                                    "  FROM `Artists` pageArtists "
+                                                    "  WHERE "
+                                                    "  (pageArtists.`Name` > :afterName COLLATE NOCASE OR "
+                                                    "  (pageArtists.`Name` = :afterName COLLATE NOCASE AND pageArtists.`ID` > :afterDatabaseId)) AND "
+                                                    "  EXISTS ("
+                                                    "    SELECT 1 "
+                                                    "    FROM "
+                                                    "    `Tracks` tracks2, "
+                                                    "    `TracksData` tracksMapping "
+                                                    "    WHERE "
+                                                    "    (tracks2.`ArtistName` = pageArtists.`Name` OR tracks2.`AlbumArtistName` = pageArtists.`Name`) AND "
+                                                    "    tracksMapping.`FileName` = tracks2.`FileName` AND "
+                                                    "    tracksMapping.`IsOffline` = 0"
+                                                    "  ) "
+                                                    "  ORDER BY pageArtists.`Name` COLLATE NOCASE, pageArtists.`ID` "
+                                                    "  LIMIT :maximumResults"
+                                                    ") artists LEFT JOIN "
+                                                    "`Tracks` tracks ON artists.`Name` = tracks.`ArtistName` LEFT JOIN "
+                                                    "`Genre` genres ON tracks.`Genre` = genres.`Name` "
+                                                    "GROUP BY artists.`ID` "
+                                                    "ORDER BY artists.`Name` COLLATE NOCASE, artists.`ID`");
+
+        result = prepareQuery(d->mSelectArtistsPageQuery, selectArtistsPageText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistsPageQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistsPageQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
     }
 
     {
@@ -3216,6 +5685,16 @@ void DatabaseInterface::initRequest()
                                                                   "  (tracks2.`ArtistName` = artists.`Name` OR tracks2.`AlbumArtistName` = artists.`Name`) AND "
                                                                   "  tracks2.`Genre` = genre2.`Name` AND "
                                                                   "  genre2.`Name` = :genreFilter "
+                                                                  ") AND "
+                                                                  "EXISTS ("
+                                                                  "  SELECT 1 "
+                                                                  "  FROM "
+                                                                  "  `Tracks` tracks3, "
+                                                                  "  `TracksData` tracksMapping "
+                                                                  "  WHERE "
+                                                                  "  (tracks3.`ArtistName` = artists.`Name` OR tracks3.`AlbumArtistName` = artists.`Name`) AND "
+                                                                  "  tracksMapping.`FileName` = tracks3.`FileName` AND "
+                                                                  "  tracksMapping.`IsOffline` = 0"
                                                                   ") "
                                                                   "GROUP BY artists.`ID` "
                                                                   "ORDER BY artists.`Name` COLLATE NOCASE");
@@ -3361,6 +5840,7 @@ void DatabaseInterface::initRequest()
                                                   "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
                                                   "WHERE "
                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                  "tracksMapping.`IsOffline` = 0 AND "
                                                   "tracks.`Priority` = ("
                                                   "     SELECT "
                                                   "     MIN(`Priority`) "
@@ -3383,6 +5863,20 @@ void DatabaseInterface::initRequest()
 
             Q_EMIT databaseError();
         }
+
+        result = prepareQuery(d->mSelectTracksPageQuery, selectAllTracksText +
+                              QStringLiteral(" AND "
+                                             "(tracks.`Title` > :afterTitle COLLATE NOCASE OR "
+                                             "(tracks.`Title` = :afterTitle COLLATE NOCASE AND tracks.`ID` > :afterDatabaseId)) "
+                                             "ORDER BY tracks.`Title` COLLATE NOCASE, tracks.`ID` "
+                                             "LIMIT :maximumResults"));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksPageQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksPageQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
     }
 
     {
@@ -3456,6 +5950,7 @@ void DatabaseInterface::initRequest()
                                                   "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
                                                   "WHERE "
                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                  "tracksMapping.`IsOffline` = 0 AND "
                                                   "tracksMapping.`PlayCounter` > 0 AND "
                                                   "tracks.`Priority` = ("
                                                   "     SELECT "
@@ -3553,6 +6048,7 @@ void DatabaseInterface::initRequest()
                                                   "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
                                                   "WHERE "
                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                  "tracksMapping.`IsOffline` = 0 AND "
                                                   "tracksMapping.`PlayCounter` > 0 AND "
                                                   "tracks.`Priority` = ("
                                                   "     SELECT "
@@ -3877,6 +6373,7 @@ void DatabaseInterface::initRequest()
                                                    "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
                                                    "WHERE "
                                                    "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                   "tracksMapping.`IsOffline` = 0 AND "
                                                    "album.`ID` = :albumId AND "
                                                    "tracks.`Priority` = ("
                                                    "     SELECT "
@@ -3945,90 +6442,92 @@ void DatabaseInterface::initRequest()
     }
 
     {
-        auto selectTrackFromIdQueryText = QStringLiteral("SELECT "
-                                                         "tracks.`Id`, "
-                                                         "tracks.`Title`, "
-                                                         "album.`ID`, "
-                                                         "tracks.`ArtistName`, "
-                                                         "tracks.`AlbumArtistName`, "
-                                                         "tracksMapping.`FileName`, "
-                                                         "tracksMapping.`FileModifiedTime`, "
-                                                         "tracks.`TrackNumber`, "
-                                                         "tracks.`DiscNumber`, "
-                                                         "tracks.`Duration`, "
-                                                         "tracks.`AlbumTitle`, "
-                                                         "tracks.`Rating`, "
-                                                         "album.`CoverFileName`, "
-                                                         "("
-                                                         "SELECT "
-                                                         "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
-                                                         "FROM "
-                                                         "`Tracks` tracks2 "
-                                                         "WHERE "
-                                                         "tracks2.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracks2.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL"
-                                                         ")"
-                                                         ") AND "
-                                                         "tracks2.`AlbumPath` = album.`AlbumPath` "
-                                                         ") as `IsSingleDiscAlbum`, "
-                                                         "trackGenre.`Name`, "
-                                                         "trackComposer.`Name`, "
-                                                         "trackLyricist.`Name`, "
-                                                         "tracks.`Comment`, "
-                                                         "tracks.`Year`, "
-                                                         "tracks.`Channels`, "
-                                                         "tracks.`BitRate`, "
-                                                         "tracks.`SampleRate`, "
-                                                         "tracks.`HasEmbeddedCover`, "
-                                                         "tracksMapping.`ImportDate`, "
-                                                         "tracksMapping.`FirstPlayDate`, "
-                                                         "tracksMapping.`LastPlayDate`, "
-                                                         "tracksMapping.`PlayCounter`, "
-                                                         "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
-                                                         "( "
-                                                         "SELECT tracksCover.`FileName` "
-                                                         "FROM "
-                                                         "`Tracks` tracksCover "
-                                                         "WHERE "
-                                                         "tracksCover.`HasEmbeddedCover` = 1 AND "
-                                                         "tracksCover.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
-                                                         "(tracksCover.`AlbumArtistName` IS NULL AND "
-                                                         "album.`ArtistName` IS NULL "
-                                                         ") "
-                                                         ") AND "
-                                                         "tracksCover.`AlbumPath` = album.`AlbumPath` "
-                                                         ") as EmbeddedCover "
-                                                         "FROM "
-                                                         "`Tracks` tracks, "
-                                                         "`TracksData` tracksMapping "
-                                                         "LEFT JOIN "
-                                                         "`Albums` album "
-                                                         "ON "
-                                                         "tracks.`AlbumTitle` = album.`Title` AND "
-                                                         "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
-                                                         "tracks.`AlbumPath` = album.`AlbumPath` "
-                                                         "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
-                                                         "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
-                                                         "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
-                                                         "WHERE "
-                                                         "tracks.`ID` = :trackId AND "
-                                                         "tracksMapping.`FileName` = tracks.`FileName` AND "
-                                                         "tracks.`Priority` = ("
-                                                         "     SELECT "
-                                                         "     MIN(`Priority`) "
-                                                         "     FROM "
-                                                         "     `Tracks` tracks2 "
-                                                         "     WHERE "
-                                                         "     tracks.`Title` = tracks2.`Title` AND "
-                                                         "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
-                                                         "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
-                                                         "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
-                                                         "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
-                                                         ")"
-                                                         "");
+        d->mSelectTracksFromIdsQueryText = QStringLiteral("SELECT "
+                                                          "tracks.`Id`, "
+                                                          "tracks.`Title`, "
+                                                          "album.`ID`, "
+                                                          "tracks.`ArtistName`, "
+                                                          "tracks.`AlbumArtistName`, "
+                                                          "tracksMapping.`FileName`, "
+                                                          "tracksMapping.`FileModifiedTime`, "
+                                                          "tracks.`TrackNumber`, "
+                                                          "tracks.`DiscNumber`, "
+                                                          "tracks.`Duration`, "
+                                                          "tracks.`AlbumTitle`, "
+                                                          "tracks.`Rating`, "
+                                                          "album.`CoverFileName`, "
+                                                          "("
+                                                          "SELECT "
+                                                          "COUNT(DISTINCT tracks2.DiscNumber) <= 1 "
+                                                          "FROM "
+                                                          "`Tracks` tracks2 "
+                                                          "WHERE "
+                                                          "tracks2.`AlbumTitle` = album.`Title` AND "
+                                                          "(tracks2.`AlbumArtistName` = album.`ArtistName` OR "
+                                                          "(tracks2.`AlbumArtistName` IS NULL AND "
+                                                          "album.`ArtistName` IS NULL"
+                                                          ")"
+                                                          ") AND "
+                                                          "tracks2.`AlbumPath` = album.`AlbumPath` "
+                                                          ") as `IsSingleDiscAlbum`, "
+                                                          "trackGenre.`Name`, "
+                                                          "trackComposer.`Name`, "
+                                                          "trackLyricist.`Name`, "
+                                                          "tracks.`Comment`, "
+                                                          "tracks.`Year`, "
+                                                          "tracks.`Channels`, "
+                                                          "tracks.`BitRate`, "
+                                                          "tracks.`SampleRate`, "
+                                                          "tracks.`HasEmbeddedCover`, "
+                                                          "tracksMapping.`ImportDate`, "
+                                                          "tracksMapping.`FirstPlayDate`, "
+                                                          "tracksMapping.`LastPlayDate`, "
+                                                          "tracksMapping.`PlayCounter`, "
+                                                          "tracksMapping.`PlayCounter` / (strftime('%s', 'now') - tracksMapping.`FirstPlayDate`) as PlayFrequency, "
+                                                          "( "
+                                                          "SELECT tracksCover.`FileName` "
+                                                          "FROM "
+                                                          "`Tracks` tracksCover "
+                                                          "WHERE "
+                                                          "tracksCover.`HasEmbeddedCover` = 1 AND "
+                                                          "tracksCover.`AlbumTitle` = album.`Title` AND "
+                                                          "(tracksCover.`AlbumArtistName` = album.`ArtistName` OR "
+                                                          "(tracksCover.`AlbumArtistName` IS NULL AND "
+                                                          "album.`ArtistName` IS NULL "
+                                                          ") "
+                                                          ") AND "
+                                                          "tracksCover.`AlbumPath` = album.`AlbumPath` "
+                                                          ") as EmbeddedCover "
+                                                          "FROM "
+                                                          "`Tracks` tracks, "
+                                                          "`TracksData` tracksMapping "
+                                                          "LEFT JOIN "
+                                                          "`Albums` album "
+                                                          "ON "
+                                                          "tracks.`AlbumTitle` = album.`Title` AND "
+                                                          "(tracks.`AlbumArtistName` = album.`ArtistName` OR tracks.`AlbumArtistName` IS NULL ) AND "
+                                                          "tracks.`AlbumPath` = album.`AlbumPath` "
+                                                          "LEFT JOIN `Composer` trackComposer ON trackComposer.`Name` = tracks.`Composer` "
+                                                          "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
+                                                          "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
+                                                          "WHERE "
+                                                          "tracks.`ID` %1 AND "
+                                                          "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                          "tracks.`Priority` = ("
+                                                          "     SELECT "
+                                                          "     MIN(`Priority`) "
+                                                          "     FROM "
+                                                          "     `Tracks` tracks2 "
+                                                          "     WHERE "
+                                                          "     tracks.`Title` = tracks2.`Title` AND "
+                                                          "     (tracks.`ArtistName` IS NULL OR tracks.`ArtistName` = tracks2.`ArtistName`) AND "
+                                                          "     (tracks.`AlbumTitle` IS NULL OR tracks.`AlbumTitle` = tracks2.`AlbumTitle`) AND "
+                                                          "     (tracks.`AlbumArtistName` IS NULL OR tracks.`AlbumArtistName` = tracks2.`AlbumArtistName`) AND "
+                                                          "     (tracks.`AlbumPath` IS NULL OR tracks.`AlbumPath` = tracks2.`AlbumPath`)"
+                                                          ")"
+                                                          "");
+
+        auto selectTrackFromIdQueryText = d->mSelectTracksFromIdsQueryText.arg(QStringLiteral("= :trackId"));
 
         auto result = prepareQuery(d->mSelectTrackFromIdQuery, selectTrackFromIdQueryText);
 
@@ -4378,102 +6877,351 @@ void DatabaseInterface::initRequest()
                                                                   "LEFT JOIN `Lyricist` trackLyricist ON trackLyricist.`Name` = tracks.`Lyricist` "
                                                                   "LEFT JOIN `Genre` trackGenre ON trackGenre.`Name` = tracks.`Genre` "
                                                                   "WHERE "
-                                                                  "tracks.`FileName` = tracksMapping.`FileName` AND "
-                                                                  "tracks.`FileName` NOT IN (SELECT tracksMapping2.`FileName` FROM `TracksData` tracksMapping2)");
+                                                                  "tracks.`FileName` = tracksMapping.`FileName` AND "
+                                                                  "tracks.`FileName` NOT IN (SELECT tracksMapping2.`FileName` FROM `TracksData` tracksMapping2)");
+
+        auto result = prepareQuery(d->mSelectTracksWithoutMappingQuery, selectTracksWithoutMappingQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksWithoutMappingQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksWithoutMappingQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectTracksMappingQueryText = QStringLiteral("SELECT "
+                                                           "track.`ID`, "
+                                                           "trackData.`FileName`, "
+                                                           "track.`Priority`, "
+                                                           "trackData.`FileModifiedTime` "
+                                                           "FROM "
+                                                           "`TracksData` trackData "
+                                                           "LEFT JOIN "
+                                                           "`Tracks` track "
+                                                           "ON "
+                                                           "track.`FileName` = trackData.`FileName` "
+                                                           "WHERE "
+                                                           "trackData.`FileName` = :fileName");
+
+        auto result = prepareQuery(d->mSelectTracksMapping, selectTracksMappingQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMapping.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMapping.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectTracksMappingPriorityQueryText = QStringLiteral("SELECT "
+                                                                   "max(tracks.`Priority`) AS Priority "
+                                                                   "FROM "
+                                                                   "`Tracks` tracks, "
+                                                                   "`Albums` albums "
+                                                                   "WHERE "
+                                                                   "tracks.`Title` = :title AND "
+                                                                   "(tracks.`ArtistName` = :trackArtist OR tracks.`ArtistName` IS NULL) AND "
+                                                                   "(tracks.`AlbumTitle` = :album OR tracks.`AlbumTitle` IS NULL) AND "
+                                                                   "(tracks.`AlbumArtistName` = :albumArtist OR tracks.`AlbumArtistName` IS NULL) AND "
+                                                                   "(tracks.`AlbumPath` = :albumPath OR tracks.`AlbumPath` IS NULL)");
+
+        auto result = prepareQuery(d->mSelectTracksMappingPriority, selectTracksMappingPriorityQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriority.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriority.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectTracksMappingPriorityQueryByTrackIdText = QStringLiteral("SELECT "
+                                                                            "MAX(track.`Priority`) "
+                                                                            "FROM "
+                                                                            "`TracksData` trackData, "
+                                                                            "`Tracks` track "
+                                                                            "WHERE "
+                                                                            "track.`ID` = :trackId AND "
+                                                                            "trackData.`FileName` = track.`FileName`");
+
+        auto result = prepareQuery(d->mSelectTracksMappingPriorityByTrackId, selectTracksMappingPriorityQueryByTrackIdText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriorityByTrackId.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriorityByTrackId.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAllTrackFilesFromSourceQueryText = QStringLiteral("SELECT "
+                                                                     "tracksMapping.`FileName`, "
+                                                                     "tracksMapping.`FileModifiedTime` "
+                                                                     "FROM "
+                                                                     "`TracksData` tracksMapping, "
+                                                                     "`Tracks` tracks "
+                                                                     "WHERE "
+                                                                     "tracks.`FileName` = tracksMapping.`FileName`");
+
+        auto result = prepareQuery(d->mSelectAllTrackFilesQuery, selectAllTrackFilesFromSourceQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTrackFilesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTrackFilesQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAllDirectoriesQueryText = QStringLiteral("SELECT "
+                                                            "`Path`, "
+                                                            "`ModifiedTime`, "
+                                                            "`EntriesCount`, "
+                                                            "`MountPoint` "
+                                                            "FROM "
+                                                            "`DirectoriesData`");
+
+        auto result = prepareQuery(d->mSelectAllDirectoriesQuery, selectAllDirectoriesQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllDirectoriesQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllDirectoriesQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto insertDirectoryQueryText = QStringLiteral("INSERT OR REPLACE INTO `DirectoriesData` "
+                                                       "(`Path`, `ModifiedTime`, `EntriesCount`, `MountPoint`) "
+                                                       "VALUES (:path, :modifiedTime, :entriesCount, :mountPoint)");
+
+        auto result = prepareQuery(d->mInsertDirectoryQuery, insertDirectoryQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mInsertDirectoryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mInsertDirectoryQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto removeDirectoryQueryText = QStringLiteral("DELETE FROM `DirectoriesData` "
+                                                       "WHERE "
+                                                       "`Path` = :path OR "
+                                                       "substr(`Path`, 1, length(:pathPrefix)) = :childPathPrefix");
+
+        auto result = prepareQuery(d->mRemoveDirectoryQuery, removeDirectoryQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveDirectoryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveDirectoryQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto updateTrackOfflineQueryText = QStringLiteral("UPDATE `TracksData` "
+                                                          "SET `IsOffline` = 1 "
+                                                          "WHERE "
+                                                          "`FileName` = :fileName AND "
+                                                          "`IsOffline` = 0");
+
+        auto result = prepareQuery(d->mUpdateTrackOfflineQuery, updateTrackOfflineQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateTrackOfflineQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateTrackOfflineQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAlbumIdFromTrackFileNameQueryText = QStringLiteral("SELECT "
+                                                                      "album.`ID` "
+                                                                      "FROM "
+                                                                      "`Tracks` tracks, "
+                                                                      "`Albums` album "
+                                                                      "WHERE "
+                                                                      "tracks.`FileName` = :fileName AND "
+                                                                      "tracks.`AlbumTitle` = album.`Title` AND "
+                                                                      "(tracks.`AlbumArtistName` = album.`ArtistName` OR "
+                                                                      "(tracks.`AlbumArtistName` IS NULL AND album.`ArtistName` IS NULL)) AND "
+                                                                      "tracks.`AlbumPath` = album.`AlbumPath`");
+
+        auto result = prepareQuery(d->mSelectAlbumIdFromTrackFileNameQuery, selectAlbumIdFromTrackFileNameQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumIdFromTrackFileNameQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumIdFromTrackFileNameQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectArtistIdsFromTrackIdQueryText = QStringLiteral("SELECT "
+                                                                  "artists.`ID` "
+                                                                  "FROM "
+                                                                  "`Tracks` tracks, "
+                                                                  "`Artists` artists "
+                                                                  "WHERE "
+                                                                  "tracks.`ID` = :trackId AND "
+                                                                  "(artists.`Name` = tracks.`ArtistName` OR artists.`Name` = tracks.`AlbumArtistName`)");
 
-        auto result = prepareQuery(d->mSelectTracksWithoutMappingQuery, selectTracksWithoutMappingQueryText);
+        auto result = prepareQuery(d->mSelectArtistIdsFromTrackIdQuery, selectArtistIdsFromTrackIdQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksWithoutMappingQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksWithoutMappingQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistIdsFromTrackIdQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistIdsFromTrackIdQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        auto selectTracksMappingQueryText = QStringLiteral("SELECT "
-                                                           "track.`ID`, "
-                                                           "trackData.`FileName`, "
-                                                           "track.`Priority`, "
-                                                           "trackData.`FileModifiedTime` "
-                                                           "FROM "
-                                                           "`TracksData` trackData "
-                                                           "LEFT JOIN "
-                                                           "`Tracks` track "
-                                                           "ON "
-                                                           "track.`FileName` = trackData.`FileName` "
-                                                           "WHERE "
-                                                           "trackData.`FileName` = :fileName");
+        auto selectAlbumOnlineTracksCountQueryText = QStringLiteral("SELECT "
+                                                                    "summary.`TracksCount` "
+                                                                    "FROM "
+                                                                    "`AlbumSummary` summary "
+                                                                    "WHERE "
+                                                                    "summary.`AlbumID` = :albumId");
 
-        auto result = prepareQuery(d->mSelectTracksMapping, selectTracksMappingQueryText);
+        auto result = prepareQuery(d->mSelectAlbumOnlineTracksCountQuery, selectAlbumOnlineTracksCountQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMapping.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMapping.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumOnlineTracksCountQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumOnlineTracksCountQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        auto selectTracksMappingPriorityQueryText = QStringLiteral("SELECT "
-                                                                   "max(tracks.`Priority`) AS Priority "
+        auto selectArtistHasOnlineTracksQueryText = QStringLiteral("SELECT 1 "
                                                                    "FROM "
+                                                                   "`Artists` artists, "
                                                                    "`Tracks` tracks, "
-                                                                   "`Albums` albums "
+                                                                   "`TracksData` tracksMapping "
                                                                    "WHERE "
-                                                                   "tracks.`Title` = :title AND "
-                                                                   "(tracks.`ArtistName` = :trackArtist OR tracks.`ArtistName` IS NULL) AND "
-                                                                   "(tracks.`AlbumTitle` = :album OR tracks.`AlbumTitle` IS NULL) AND "
-                                                                   "(tracks.`AlbumArtistName` = :albumArtist OR tracks.`AlbumArtistName` IS NULL) AND "
-                                                                   "(tracks.`AlbumPath` = :albumPath OR tracks.`AlbumPath` IS NULL)");
+                                                                   "artists.`ID` = :artistId AND "
+                                                                   "(tracks.`ArtistName` = artists.`Name` OR tracks.`AlbumArtistName` = artists.`Name`) AND "
+                                                                   "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                                   "tracksMapping.`IsOffline` = 0 "
+                                                                   "LIMIT 1");
 
-        auto result = prepareQuery(d->mSelectTracksMappingPriority, selectTracksMappingPriorityQueryText);
+        auto result = prepareQuery(d->mSelectArtistHasOnlineTracksQuery, selectArtistHasOnlineTracksQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriority.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriority.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistHasOnlineTracksQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectArtistHasOnlineTracksQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        auto selectTracksMappingPriorityQueryByTrackIdText = QStringLiteral("SELECT "
-                                                                            "MAX(track.`Priority`) "
-                                                                            "FROM "
-                                                                            "`TracksData` trackData, "
-                                                                            "`Tracks` track "
-                                                                            "WHERE "
-                                                                            "track.`ID` = :trackId AND "
-                                                                            "trackData.`FileName` = track.`FileName`");
+        auto selectOfflineTracksInDirectoryQueryText = QStringLiteral("SELECT "
+                                                                      "tracks.`ID`, "
+                                                                      "album.`ID` "
+                                                                      "FROM "
+                                                                      "`Tracks` tracks, "
+                                                                      "`TracksData` tracksMapping "
+                                                                      "LEFT JOIN "
+                                                                      "`Albums` album "
+                                                                      "ON "
+                                                                      "tracks.`AlbumTitle` = album.`Title` AND "
+                                                                      "(tracks.`AlbumArtistName` = album.`ArtistName` OR "
+                                                                      "(tracks.`AlbumArtistName` IS NULL AND album.`ArtistName` IS NULL)) AND "
+                                                                      "tracks.`AlbumPath` = album.`AlbumPath` "
+                                                                      "WHERE "
+                                                                      "tracksMapping.`FileName` = tracks.`FileName` AND "
+                                                                      "tracksMapping.`IsOffline` = 1 AND "
+                                                                      "substr(tracksMapping.`FileName`, 1, length(:pathPrefix)) = :childPathPrefix");
 
-        auto result = prepareQuery(d->mSelectTracksMappingPriorityByTrackId, selectTracksMappingPriorityQueryByTrackIdText);
+        auto result = prepareQuery(d->mSelectOfflineTracksInDirectoryQuery, selectOfflineTracksInDirectoryQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriorityByTrackId.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTracksMappingPriorityByTrackId.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectOfflineTracksInDirectoryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectOfflineTracksInDirectoryQuery.lastError();
 
             Q_EMIT databaseError();
         }
     }
 
     {
-        auto selectAllTrackFilesFromSourceQueryText = QStringLiteral("SELECT "
-                                                                     "tracksMapping.`FileName`, "
-                                                                     "tracksMapping.`FileModifiedTime` "
-                                                                     "FROM "
-                                                                     "`TracksData` tracksMapping, "
-                                                                     "`Tracks` tracks "
-                                                                     "WHERE "
-                                                                     "tracks.`FileName` = tracksMapping.`FileName`");
+        auto updateDirectoryOnlineQueryText = QStringLiteral("UPDATE `TracksData` "
+                                                             "SET `IsOffline` = 0 "
+                                                             "WHERE "
+                                                             "`IsOffline` = 1 AND "
+                                                             "substr(`FileName`, 1, length(:pathPrefix)) = :childPathPrefix");
 
-        auto result = prepareQuery(d->mSelectAllTrackFilesQuery, selectAllTrackFilesFromSourceQueryText);
+        auto result = prepareQuery(d->mUpdateDirectoryOnlineQuery, updateDirectoryOnlineQueryText);
 
         if (!result) {
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTrackFilesQuery.lastQuery();
-            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAllTrackFilesQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateDirectoryOnlineQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateDirectoryOnlineQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto clearDirectoriesTableText = QStringLiteral("DELETE FROM `DirectoriesData`");
+
+        auto result = prepareQuery(d->mClearDirectoriesTable, clearDirectoriesTableText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearDirectoriesTable.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearDirectoriesTable.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto result = prepareQuery(d->mRefreshAlbumSummaryQuery, refreshAlbumSummaryQueryText(QStringLiteral("WHERE album.`ID` = :albumId ")));
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRefreshAlbumSummaryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRefreshAlbumSummaryQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto removeAlbumSummaryQueryText = QStringLiteral("DELETE FROM `AlbumSummary` "
+                                                          "WHERE "
+                                                          "`AlbumID` = :albumId");
+
+        auto result = prepareQuery(d->mRemoveAlbumSummaryQuery, removeAlbumSummaryQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveAlbumSummaryQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mRemoveAlbumSummaryQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto clearAlbumSummaryTableText = QStringLiteral("DELETE FROM `AlbumSummary`");
+
+        auto result = prepareQuery(d->mClearAlbumSummaryTable, clearAlbumSummaryTableText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearAlbumSummaryTable.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mClearAlbumSummaryTable.lastError();
 
             Q_EMIT databaseError();
         }
@@ -4831,7 +7579,8 @@ void DatabaseInterface::initRequest()
 
     {
         auto updateAlbumArtUriFromAlbumIdQueryText = QStringLiteral("UPDATE `Albums` "
-                                                                    "SET `CoverFileName` = :coverFileName "
+                                                                    "SET `CoverFileName` = :coverFileName, "
+                                                                    "`CoverCacheKey` = NULL "
                                                                     "WHERE "
                                                                     "`ID` = :albumId");
 
@@ -4845,6 +7594,119 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto selectAlbumArtSourceQueryText = QStringLiteral("SELECT "
+                                                            "album.`CoverFileName`, "
+                                                            "summary.`EmbeddedCover`, "
+                                                            "album.`CoverCacheKey` "
+                                                            "FROM "
+                                                            "`Albums` album LEFT JOIN "
+                                                            "`AlbumSummary` summary ON summary.`AlbumID` = album.`ID` "
+                                                            "WHERE "
+                                                            "album.`ID` = :albumId");
+
+        auto result = prepareQuery(d->mSelectAlbumArtSourceQuery, selectAlbumArtSourceQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumArtSourceQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumArtSourceQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto updateAlbumCoverCacheKeyQueryText = QStringLiteral("UPDATE `Albums` "
+                                                                "SET `CoverCacheKey` = :coverCacheKey "
+                                                                "WHERE "
+                                                                "`ID` = :albumId");
+
+        auto result = prepareQuery(d->mUpdateAlbumCoverCacheKeyQuery, updateAlbumCoverCacheKeyQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateAlbumCoverCacheKeyQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateAlbumCoverCacheKeyQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAlbumsWithoutCoverCacheKeyQueryText = QStringLiteral("SELECT "
+                                                                        "album.`ID` "
+                                                                        "FROM "
+                                                                        "`Albums` album "
+                                                                        "WHERE "
+                                                                        "album.`CoverCacheKey` IS NULL");
+
+        auto result = prepareQuery(d->mSelectAlbumsWithoutCoverCacheKeyQuery, selectAlbumsWithoutCoverCacheKeyQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumsWithoutCoverCacheKeyQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumsWithoutCoverCacheKeyQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectAlbumCoverCacheKeysQueryText = QStringLiteral("SELECT DISTINCT "
+                                                                 "album.`CoverCacheKey` "
+                                                                 "FROM "
+                                                                 "`Albums` album "
+                                                                 "WHERE "
+                                                                 "album.`CoverCacheKey` IS NOT NULL AND "
+                                                                 "album.`CoverCacheKey` != ''");
+
+        auto result = prepareQuery(d->mSelectAlbumCoverCacheKeysQuery, selectAlbumCoverCacheKeysQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumCoverCacheKeysQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectAlbumCoverCacheKeysQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto updateTrackLyricsQueryText = QStringLiteral("INSERT OR REPLACE INTO `TracksLyrics` "
+                                                         "(`FileName`, `FileModifiedTime`, `IsCompressed`, `Lyrics`) "
+                                                         "VALUES (:fileName, :mtime, :isCompressed, :lyrics)");
+
+        auto result = prepareQuery(d->mUpdateTrackLyricsQuery, updateTrackLyricsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateTrackLyricsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mUpdateTrackLyricsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
+    {
+        auto selectTrackLyricsQueryText = QStringLiteral("SELECT "
+                                                         "lyrics.`Lyrics`, "
+                                                         "lyrics.`IsCompressed`, "
+                                                         "lyrics.`FileModifiedTime` = trackData.`FileModifiedTime` "
+                                                         "FROM "
+                                                         "`Tracks` tracks, "
+                                                         "`TracksData` trackData, "
+                                                         "`TracksLyrics` lyrics "
+                                                         "WHERE "
+                                                         "tracks.`ID` = :trackId AND "
+                                                         "trackData.`FileName` = tracks.`FileName` AND "
+                                                         "lyrics.`FileName` = tracks.`FileName`");
+
+        auto result = prepareQuery(d->mSelectTrackLyricsQuery, selectTrackLyricsQueryText);
+
+        if (!result) {
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTrackLyricsQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::initRequest" << d->mSelectTrackLyricsQuery.lastError();
+
+            Q_EMIT databaseError();
+        }
+    }
+
     {
         auto selectTracksFromArtistQueryText = QStringLiteral("SELECT "
                                                               "tracks.`ID`, "
@@ -4981,7 +7843,7 @@ void DatabaseInterface::initRequest()
         auto updateTrackStatisticsQueryText = QStringLiteral("UPDATE `TracksData` "
                                                              "SET "
                                                              "`LastPlayDate` = :playDate, "
-                                                             "`PlayCounter` = `PlayCounter` + 1 "
+                                                             "`PlayCounter` = `PlayCounter` + :playCount "
                                                              "WHERE "
                                                              "`FileName` = :fileName");
 
@@ -5105,6 +7967,10 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    initSearchRequest();
+
+    readCollectionGeneration();
+
     finishTransaction();
 
     d->mInitFinished = true;
@@ -5218,6 +8084,7 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
     ++d->mAlbumId;
 
     d->mInsertedAlbums.insert(result);
+    d->mStaleAlbumSummaries.insert(result);
 
     return result;
 }
@@ -5274,36 +8141,57 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
         return result;
     }
 
-    d->mSelectArtistByNameQuery.bindValue(QStringLiteral(":name"), name);
+    auto isKnownMissingName = false;
 
-    auto queryResult = execQuery(d->mSelectArtistByNameQuery);
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        const auto itCache = d->mArtistIdCache.constFind(name);
+        if (itCache != d->mArtistIdCache.constEnd()) {
+            if (*itCache != 0) {
+                return *itCache;
+            }
 
-    if (!queryResult || !d->mSelectArtistByNameQuery.isSelect() || !d->mSelectArtistByNameQuery.isActive()) {
-        Q_EMIT databaseError();
+            isKnownMissingName = true;
+        } else if (d->mHasNameDictionaries) {
+            isKnownMissingName = true;
+        }
+    }
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.lastError();
+    if (!isKnownMissingName) {
+        d->mSelectArtistByNameQuery.bindValue(QStringLiteral(":name"), name);
 
-        d->mSelectArtistByNameQuery.finish();
+        auto queryResult = execQuery(d->mSelectArtistByNameQuery);
 
-        return result;
-    }
+        if (!queryResult || !d->mSelectArtistByNameQuery.isSelect() || !d->mSelectArtistByNameQuery.isActive()) {
+            Q_EMIT databaseError();
 
-    if (d->mSelectArtistByNameQuery.next()) {
-        result = d->mSelectArtistByNameQuery.record().value(0).toULongLong();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertArtist" << d->mSelectArtistByNameQuery.lastError();
 
-        d->mSelectArtistByNameQuery.finish();
+            d->mSelectArtistByNameQuery.finish();
 
-        return result;
-    }
+            return result;
+        }
 
-    d->mSelectArtistByNameQuery.finish();
+        if (d->mSelectArtistByNameQuery.next()) {
+            result = d->mSelectArtistByNameQuery.record().value(0).toULongLong();
+
+            d->mSelectArtistByNameQuery.finish();
+
+            if (d->mIsBulkInsert) {
+                d->mArtistIdCache[name] = result;
+            }
+
+            return result;
+        }
+
+        d->mSelectArtistByNameQuery.finish();
+    }
 
     d->mInsertArtistsQuery.bindValue(QStringLiteral(":artistId"), d->mArtistId);
     d->mInsertArtistsQuery.bindValue(QStringLiteral(":name"), name);
 
-    queryResult = execQuery(d->mInsertArtistsQuery);
+    auto queryResult = execQuery(d->mInsertArtistsQuery);
 
     if (!queryResult || !d->mInsertArtistsQuery.isActive()) {
         Q_EMIT databaseError();
@@ -5325,6 +8213,10 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
 
     d->mInsertArtistsQuery.finish();
 
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        d->mArtistIdCache[name] = result;
+    }
+
     return result;
 }
 
@@ -5336,37 +8228,58 @@ qulonglong DatabaseInterface::insertComposer(const QString &name)
         return result;
     }
 
-    d->mSelectComposerByNameQuery.bindValue(QStringLiteral(":name"), name);
+    auto isKnownMissingName = false;
+
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        const auto itCache = d->mComposerIdCache.constFind(name);
+        if (itCache != d->mComposerIdCache.constEnd()) {
+            if (*itCache != 0) {
+                return *itCache;
+            }
+
+            isKnownMissingName = true;
+        } else if (d->mHasNameDictionaries) {
+            isKnownMissingName = true;
+        }
+    }
+
+    if (!isKnownMissingName) {
+        d->mSelectComposerByNameQuery.bindValue(QStringLiteral(":name"), name);
 
-    auto queryResult = execQuery(d->mSelectComposerByNameQuery);
+        auto queryResult = execQuery(d->mSelectComposerByNameQuery);
 
-    if (!queryResult || !d->mSelectComposerByNameQuery.isSelect() || !d->mSelectComposerByNameQuery.isActive()) {
-        Q_EMIT databaseError();
+        if (!queryResult || !d->mSelectComposerByNameQuery.isSelect() || !d->mSelectComposerByNameQuery.isActive()) {
+            Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.lastError();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertComposer" << d->mSelectComposerByNameQuery.lastError();
 
-        d->mSelectComposerByNameQuery.finish();
+            d->mSelectComposerByNameQuery.finish();
 
-        return result;
-    }
+            return result;
+        }
 
 
-    if (d->mSelectComposerByNameQuery.next()) {
-        result = d->mSelectComposerByNameQuery.record().value(0).toULongLong();
+        if (d->mSelectComposerByNameQuery.next()) {
+            result = d->mSelectComposerByNameQuery.record().value(0).toULongLong();
 
-        d->mSelectComposerByNameQuery.finish();
+            d->mSelectComposerByNameQuery.finish();
 
-        return result;
-    }
+            if (d->mIsBulkInsert) {
+                d->mComposerIdCache[name] = result;
+            }
 
-    d->mSelectComposerByNameQuery.finish();
+            return result;
+        }
+
+        d->mSelectComposerByNameQuery.finish();
+    }
 
     d->mInsertComposerQuery.bindValue(QStringLiteral(":composerId"), d->mComposerId);
     d->mInsertComposerQuery.bindValue(QStringLiteral(":name"), name);
 
-    queryResult = execQuery(d->mInsertComposerQuery);
+    auto queryResult = execQuery(d->mInsertComposerQuery);
 
     if (!queryResult || !d->mInsertComposerQuery.isActive()) {
         Q_EMIT databaseError();
@@ -5386,7 +8299,15 @@ qulonglong DatabaseInterface::insertComposer(const QString &name)
 
     d->mInsertComposerQuery.finish();
 
-    Q_EMIT composersAdded(internalAllComposersPartialData());
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        d->mComposerIdCache[name] = result;
+    }
+
+    if (d->mIsBulkInsert) {
+        d->mInsertedComposers.insert(result);
+    } else {
+        Q_EMIT composersAdded(internalAllComposersPartialData());
+    }
 
     return result;
 }
@@ -5399,36 +8320,57 @@ qulonglong DatabaseInterface::insertGenre(const QString &name)
         return result;
     }
 
-    d->mSelectGenreByNameQuery.bindValue(QStringLiteral(":name"), name);
+    auto isKnownMissingName = false;
 
-    auto queryResult = execQuery(d->mSelectGenreByNameQuery);
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        const auto itCache = d->mGenreIdCache.constFind(name);
+        if (itCache != d->mGenreIdCache.constEnd()) {
+            if (*itCache != 0) {
+                return *itCache;
+            }
 
-    if (!queryResult || !d->mSelectGenreByNameQuery.isSelect() || !d->mSelectGenreByNameQuery.isActive()) {
-        Q_EMIT databaseError();
+            isKnownMissingName = true;
+        } else if (d->mHasNameDictionaries) {
+            isKnownMissingName = true;
+        }
+    }
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.lastError();
+    if (!isKnownMissingName) {
+        d->mSelectGenreByNameQuery.bindValue(QStringLiteral(":name"), name);
 
-        d->mSelectGenreByNameQuery.finish();
+        auto queryResult = execQuery(d->mSelectGenreByNameQuery);
 
-        return result;
-    }
+        if (!queryResult || !d->mSelectGenreByNameQuery.isSelect() || !d->mSelectGenreByNameQuery.isActive()) {
+            Q_EMIT databaseError();
 
-    if (d->mSelectGenreByNameQuery.next()) {
-        result = d->mSelectGenreByNameQuery.record().value(0).toULongLong();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertGenre" << d->mSelectGenreByNameQuery.lastError();
 
-        d->mSelectGenreByNameQuery.finish();
+            d->mSelectGenreByNameQuery.finish();
 
-        return result;
-    }
+            return result;
+        }
+
+        if (d->mSelectGenreByNameQuery.next()) {
+            result = d->mSelectGenreByNameQuery.record().value(0).toULongLong();
+
+            d->mSelectGenreByNameQuery.finish();
 
-    d->mSelectGenreByNameQuery.finish();
+            if (d->mIsBulkInsert) {
+                d->mGenreIdCache[name] = result;
+            }
+
+            return result;
+        }
+
+        d->mSelectGenreByNameQuery.finish();
+    }
 
     d->mInsertGenreQuery.bindValue(QStringLiteral(":genreId"), d->mGenreId);
     d->mInsertGenreQuery.bindValue(QStringLiteral(":name"), name);
 
-    queryResult = execQuery(d->mInsertGenreQuery);
+    auto queryResult = execQuery(d->mInsertGenreQuery);
 
     if (!queryResult || !d->mInsertGenreQuery.isActive()) {
         Q_EMIT databaseError();
@@ -5448,7 +8390,15 @@ qulonglong DatabaseInterface::insertGenre(const QString &name)
 
     d->mInsertGenreQuery.finish();
 
-    Q_EMIT genresAdded({{{DatabaseIdRole, result}}});
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        d->mGenreIdCache[name] = result;
+    }
+
+    if (d->mIsBulkInsert) {
+        d->mInsertedGenres.insert(result);
+    } else {
+        Q_EMIT genresAdded({{{DatabaseIdRole, result}}});
+    }
 
     return result;
 }
@@ -5497,7 +8447,37 @@ void DatabaseInterface::updateTrackOrigin(const QUrl &fileName, const QDateTime
         return;
     }
 
-    d->mUpdateTrackFileModifiedTime.finish();
+    d->mUpdateTrackFileModifiedTime.finish();
+}
+
+void DatabaseInterface::updateTrackLyrics(const MusicAudioTrack &oneTrack)
+{
+    // lyrics are rarely read, long ones are stored compressed
+    static const auto compressedLyricsMinimumSize = 1024;
+
+    auto storedLyrics = oneTrack.lyrics().toUtf8();
+    const auto isCompressed = storedLyrics.size() >= compressedLyricsMinimumSize;
+    if (isCompressed) {
+        storedLyrics = qCompress(storedLyrics);
+    }
+
+    d->mUpdateTrackLyricsQuery.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
+    d->mUpdateTrackLyricsQuery.bindValue(QStringLiteral(":mtime"), oneTrack.fileModificationTime());
+    d->mUpdateTrackLyricsQuery.bindValue(QStringLiteral(":isCompressed"), isCompressed);
+    // a null QByteArray would be bound as NULL, tracks without lyrics get an empty row
+    d->mUpdateTrackLyricsQuery.bindValue(QStringLiteral(":lyrics"), storedLyrics.isNull() ? QByteArray("") : storedLyrics);
+
+    auto queryResult = execQuery(d->mUpdateTrackLyricsQuery);
+
+    if (!queryResult || !d->mUpdateTrackLyricsQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackLyrics" << d->mUpdateTrackLyricsQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackLyrics" << d->mUpdateTrackLyricsQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::updateTrackLyrics" << d->mUpdateTrackLyricsQuery.lastError();
+    }
+
+    d->mUpdateTrackLyricsQuery.finish();
 }
 
 qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrack,
@@ -5521,8 +8501,18 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
         albumCover = oneTrack.albumCover();
     }
 
-    auto albumId = insertAlbum(oneTrack.albumName(), (oneTrack.isValidAlbumArtist() ? oneTrack.albumArtist() : QString()),
-                               oneTrack.artist(), trackPath, albumCover);
+    const auto albumKey = QStringList{oneTrack.albumName(), (oneTrack.isValidAlbumArtist() ? oneTrack.albumArtist() : QString()),
+                                      oneTrack.artist(), trackPath};
+
+    auto albumId = d->mIsBulkInsert ? d->mAlbumIdCache.value(albumKey) : qulonglong(0);
+
+    if (albumId == 0) {
+        albumId = insertAlbum(albumKey[0], albumKey[1], albumKey[2], trackPath, albumCover);
+
+        if (d->mIsBulkInsert && albumId != 0) {
+            d->mAlbumIdCache[albumKey] = albumId;
+        }
+    }
 
     auto oldAlbumId = albumId;
 
@@ -5590,7 +8580,7 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
                 recordModifiedAlbum(oldAlbumId);
             } else {
                 removeAlbumInDatabase(oldAlbumId);
-                Q_EMIT albumRemoved(oldAlbumId);
+                Q_EMIT albumsRemoved({oldAlbumId});
             }
         }
 
@@ -5619,7 +8609,17 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
 
     resultId = existingTrackId;
 
-    const auto &albumData = internalOneAlbumPartialData(albumId);
+    auto albumTitleArtist = d->mAlbumTitleArtistCache.value(albumId);
+
+    if (!d->mIsBulkInsert || !d->mAlbumTitleArtistCache.contains(albumId)) {
+        const auto &albumData = internalOneAlbumPartialData(albumId);
+
+        albumTitleArtist = {albumData[AlbumDataType::key_type::TitleRole], albumData[AlbumDataType::key_type::ArtistRole]};
+
+        if (d->mIsBulkInsert) {
+            d->mAlbumTitleArtistCache[albumId] = albumTitleArtist;
+        }
+    }
 
     d->mInsertTrackQuery.bindValue(QStringLiteral(":trackId"), existingTrackId);
     d->mInsertTrackQuery.bindValue(QStringLiteral(":fileName"), oneTrack.resourceURI());
@@ -5627,8 +8627,8 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
     d->mInsertTrackQuery.bindValue(QStringLiteral(":title"), oneTrack.title());
     insertArtist(oneTrack.artist());
     d->mInsertTrackQuery.bindValue(QStringLiteral(":artistName"), oneTrack.artist());
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":albumTitle"), albumData[AlbumDataType::key_type::TitleRole]);
-    d->mInsertTrackQuery.bindValue(QStringLiteral(":albumArtistName"), albumData[AlbumDataType::key_type::ArtistRole]);
+    d->mInsertTrackQuery.bindValue(QStringLiteral(":albumTitle"), albumTitleArtist.first);
+    d->mInsertTrackQuery.bindValue(QStringLiteral(":albumArtistName"), albumTitleArtist.second);
     d->mInsertTrackQuery.bindValue(QStringLiteral(":albumPath"), trackPath);
     if (oneTrack.trackNumberIsValid()) {
         d->mInsertTrackQuery.bindValue(QStringLiteral(":trackNumber"), oneTrack.trackNumber());
@@ -5782,61 +8782,70 @@ DatabaseInterface::TrackDataType DatabaseInterface::buildTrackDataFromDatabaseRe
 {
     TrackDataType result;
 
-    result[TrackDataType::key_type::DatabaseIdRole] = trackRecord.value(0);
-    result[TrackDataType::key_type::TitleRole] = trackRecord.value(1);
+    result.setDatabaseId(trackRecord.value(0).toULongLong());
+    result.setTitle(trackRecord.value(1).toString());
     if (!trackRecord.value(10).isNull()) {
-        result[TrackDataType::key_type::AlbumRole] = trackRecord.value(10);
-        result[TrackDataType::key_type::AlbumIdRole] = trackRecord.value(2);
+        result.setAlbum(trackRecord.value(10).toString());
+        result.setAlbumId(trackRecord.value(2).toULongLong());
     }
     if (!trackRecord.value(3).isNull()) {
-        result[TrackDataType::key_type::ArtistRole] = trackRecord.value(3);
+        result.setArtist(trackRecord.value(3).toString());
     }
     if (!trackRecord.value(4).isNull()) {
-        result[TrackDataType::key_type::AlbumArtistRole] = trackRecord.value(4);
+        result.setAlbumArtist(trackRecord.value(4).toString());
     }
-    result[TrackDataType::key_type::ResourceRole] = trackRecord.value(5);
+    result.setResourceURI(trackRecord.value(5).toUrl());
     if (!trackRecord.value(7).isNull()) {
-        result[TrackDataType::key_type::TrackNumberRole] = trackRecord.value(7);
+        result.setTrackNumber(trackRecord.value(7).toInt());
     }
     if (!trackRecord.value(8).isNull()) {
-        result[TrackDataType::key_type::DiscNumberRole] = trackRecord.value(8);
+        result.setDiscNumber(trackRecord.value(8).toInt());
     }
-    result[TrackDataType::key_type::DurationRole] = QTime::fromMSecsSinceStartOfDay(trackRecord.value(9).toInt());
-    result[TrackDataType::key_type::MilliSecondsDurationRole] = trackRecord.value(9).toInt();
-    result[TrackDataType::key_type::RatingRole] = trackRecord.value(11);
+    result.setDuration(QTime::fromMSecsSinceStartOfDay(trackRecord.value(9).toInt()));
+    result.setRating(trackRecord.value(11).toInt());
     if (!trackRecord.value(12).toString().isEmpty()) {
-        result[TrackDataType::key_type::ImageUrlRole] = QUrl(trackRecord.value(12).toString());
+        result.setAlbumCover(QUrl(trackRecord.value(12).toString()));
     } else if (!trackRecord.value(28).toString().isEmpty()) {
-        result[TrackDataType::key_type::ImageUrlRole] = QVariant{QStringLiteral("image://cover/") + trackRecord.value(28).toUrl().toLocalFile()};
+        result.setAlbumCover(QUrl(QStringLiteral("image://cover/") + trackRecord.value(28).toUrl().toLocalFile()));
     }
-    result[TrackDataType::key_type::IsSingleDiscAlbumRole] = trackRecord.value(13);
+    result.setIsSingleDiscAlbum(trackRecord.value(13).toBool());
     if (!trackRecord.value(14).isNull()) {
-        result[TrackDataType::key_type::GenreRole] = trackRecord.value(14);
+        result.setGenre(trackRecord.value(14).toString());
     }
     if (!trackRecord.value(15).isNull()) {
-        result[TrackDataType::key_type::ComposerRole] = trackRecord.value(15);
+        result.setComposer(trackRecord.value(15).toString());
     }
     if (!trackRecord.value(16).isNull()) {
-        result[TrackDataType::key_type::LyricistRole] = trackRecord.value(16);
+        result.setLyricist(trackRecord.value(16).toString());
     }
-    result[TrackDataType::key_type::HasEmbeddedCover] = trackRecord.value(22);
-    result[TrackDataType::key_type::FileModificationTime] = trackRecord.value(6);
+    result.setHasEmbeddedCover(trackRecord.value(22).toBool());
+    result.setFileModificationTime(trackRecord.value(6).toDateTime());
     if (!trackRecord.value(24).isNull()) {
-        result[TrackDataType::key_type::FirstPlayDate] = trackRecord.value(24);
+        result.setFirstPlayDate(QDateTime::fromMSecsSinceEpoch(trackRecord.value(24).toLongLong()));
     }
     if (!trackRecord.value(25).isNull()) {
-        result[TrackDataType::key_type::LastPlayDate] = trackRecord.value(25);
+        result.setLastPlayDate(QDateTime::fromMSecsSinceEpoch(trackRecord.value(25).toLongLong()));
     }
-    result[TrackDataType::key_type::PlayCounter] = trackRecord.value(26);
-    result[TrackDataType::key_type::PlayFrequency] = trackRecord.value(27);
-    result[DataType::key_type::ElementTypeRole] = ElisaUtils::Track;
+    result.setPlayCounter(trackRecord.value(26).toInt());
+    result.setPlayFrequency(trackRecord.value(27).toDouble());
+    result.setElementType(ElisaUtils::Track);
 
     return result;
 }
 
 void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTracks)
 {
+    const auto bulkRemovalThreshold = 100;
+
+    if (removedTracks.size() >= bulkRemovalThreshold) {
+        internalBulkRemoveTracksList(removedTracks);
+        return;
+    }
+
     QSet<qulonglong> modifiedAlbums;
+    QList<qulonglong> removedTracksIds;
+    QList<qulonglong> removedAlbumsIds;
+    QList<qulonglong> removedArtistsIds;
 
     QUrl::FormattingOptions currentOptions = QUrl::PreferLocalFile |
             QUrl::RemoveAuthority | QUrl::RemoveFilename | QUrl::RemoveFragment |
@@ -5846,12 +8855,14 @@ void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTrack
     for (const auto &removedTrackFileName : removedTracks) {
         auto removedTrackId = internalTrackIdFromFileName(removedTrackFileName);
 
-        Q_EMIT trackRemoved(removedTrackId);
+        removedTracksIds.push_back(removedTrackId);
 
         auto oneRemovedTrack = internalTrackFromDatabaseId(removedTrackId);
 
         removeTrackInDatabase(removedTrackId);
 
+        internalRemoveDirectory(removedTrackFileName.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash));
+
         const auto &modifiedAlbumId = internalAlbumIdFromTitleAndArtist(oneRemovedTrack.albumName(), oneRemovedTrack.albumArtist());
         const auto &allTracksFromArtist = internalTracksFromAuthor(oneRemovedTrack.artist());
         const auto &allAlbumsFromArtist = internalAlbumIdsFromAuthor(oneRemovedTrack.artist());
@@ -5865,8 +8876,8 @@ void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTrack
         }
 
         if (removedArtistId != 0 && allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
-            removeArtistInDatabase(removedArtistId);
-            Q_EMIT artistRemoved(removedArtistId);
+            removeArtistInDatabase(removedArtistId, oneRemovedTrack.artist());
+            removedArtistsIds.push_back(removedArtistId);
         }
 
         d->mRemoveTracksMapping.bindValue(QStringLiteral(":fileName"), removedTrackFileName.toString());
@@ -5886,6 +8897,10 @@ void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTrack
         d->mRemoveTracksMapping.finish();
     }
 
+    if (!removedTracksIds.isEmpty()) {
+        Q_EMIT tracksRemoved(removedTracksIds);
+    }
+
     for (auto modifiedAlbumId : modifiedAlbums) {
         const auto &modifiedAlbumData = internalOneAlbumPartialData(modifiedAlbumId);
 
@@ -5895,18 +8910,253 @@ void DatabaseInterface::internalRemoveTracksList(const QList<QUrl> &removedTrack
             Q_EMIT albumModified({{DatabaseIdRole, modifiedAlbumId}}, modifiedAlbumId);
         } else {
             removeAlbumInDatabase(modifiedAlbumId);
-            Q_EMIT albumRemoved(modifiedAlbumId);
+            removedAlbumsIds.push_back(modifiedAlbumId);
 
             const auto &allTracksFromArtist = internalTracksFromAuthor(modifiedAlbumData[AlbumDataType::key_type::ArtistRole].toString());
             const auto &allAlbumsFromArtist = internalAlbumIdsFromAuthor(modifiedAlbumData[AlbumDataType::key_type::ArtistRole].toString());
             const auto &removedArtistId = internalArtistIdFromName(modifiedAlbumData[AlbumDataType::key_type::ArtistRole].toString());
 
             if (removedArtistId != 0 && allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
-                removeArtistInDatabase(removedArtistId);
-                Q_EMIT artistRemoved(removedArtistId);
+                removeArtistInDatabase(removedArtistId, modifiedAlbumData[AlbumDataType::key_type::ArtistRole].toString());
+                removedArtistsIds.push_back(removedArtistId);
+            }
+        }
+    }
+
+    if (!removedAlbumsIds.isEmpty()) {
+        Q_EMIT albumsRemoved(removedAlbumsIds);
+    }
+
+    if (!removedArtistsIds.isEmpty()) {
+        Q_EMIT artistsRemoved(removedArtistsIds);
+    }
+}
+
+bool DatabaseInterface::execBulkRemovalQuery(QSqlQuery &query, const QString &queryText)
+{
+    auto queryResult = prepareQuery(query, queryText) && execQuery(query);
+
+    if (!queryResult || !query.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << query.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << query.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << query.lastError();
+
+        query.finish();
+
+        return false;
+    }
+
+    return true;
+}
+
+void DatabaseInterface::internalBulkRemoveTracksList(const QList<QUrl> &removedTracks)
+{
+    QSqlQuery bulkQuery(d->mTracksDatabase);
+
+    if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("CREATE TEMPORARY TABLE IF NOT EXISTS `RemovedFiles` ("
+                                                        "`FileName` VARCHAR(255) PRIMARY KEY NOT NULL)")) ||
+            !execBulkRemovalQuery(bulkQuery, QStringLiteral("CREATE TEMPORARY TABLE IF NOT EXISTS `RemovedTracks` ("
+                                                            "`ID` INTEGER PRIMARY KEY NOT NULL, "
+                                                            "`ArtistName` VARCHAR(55), "
+                                                            "`AlbumTitle` VARCHAR(55), "
+                                                            "`AlbumArtistName` VARCHAR(55), "
+                                                            "`AlbumPath` VARCHAR(255))")) ||
+            !execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM temp.`RemovedFiles`")) ||
+            !execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM temp.`RemovedTracks`"))) {
+        return;
+    }
+
+    QSet<QUrl> removedDirectories;
+
+    if (!prepareQuery(bulkQuery, QStringLiteral("INSERT OR IGNORE INTO temp.`RemovedFiles` (`FileName`) VALUES (:fileName)"))) {
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << bulkQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << bulkQuery.lastError();
+
+        Q_EMIT databaseError();
+
+        return;
+    }
+
+    for (const auto &removedTrackFileName : removedTracks) {
+        bulkQuery.bindValue(QStringLiteral(":fileName"), removedTrackFileName.toString());
+
+        auto queryResult = execQuery(bulkQuery);
+
+        if (!queryResult || !bulkQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << bulkQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << bulkQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalBulkRemoveTracksList" << bulkQuery.lastError();
+
+            bulkQuery.finish();
+
+            return;
+        }
+
+        bulkQuery.finish();
+
+        removedDirectories.insert(removedTrackFileName.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash));
+    }
+
+    if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("INSERT INTO temp.`RemovedTracks` "
+                                                        "SELECT "
+                                                        "tracks.`ID`, "
+                                                        "tracks.`ArtistName`, "
+                                                        "tracks.`AlbumTitle`, "
+                                                        "tracks.`AlbumArtistName`, "
+                                                        "tracks.`AlbumPath` "
+                                                        "FROM "
+                                                        "`Tracks` tracks "
+                                                        "WHERE "
+                                                        "tracks.`FileName` IN (SELECT `FileName` FROM temp.`RemovedFiles`)")) ||
+            !execBulkRemovalQuery(bulkQuery, QStringLiteral("SELECT "
+                                                            "`ID` "
+                                                            "FROM "
+                                                            "temp.`RemovedTracks`"))) {
+        return;
+    }
+
+    QList<qulonglong> removedTracksIds;
+
+    while (bulkQuery.next()) {
+        const auto trackId = bulkQuery.record().value(0).toULongLong();
+
+        removedTracksIds.push_back(trackId);
+        d->mStaleSearchEntries.insert(trackId);
+    }
+
+    bulkQuery.finish();
+
+    if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM `Tracks` "
+                                                        "WHERE "
+                                                        "`ID` IN (SELECT `ID` FROM temp.`RemovedTracks`)")) ||
+            !execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM `TracksData` "
+                                                            "WHERE "
+                                                            "`FileName` IN (SELECT `FileName` FROM temp.`RemovedFiles`)"))) {
+        return;
+    }
+
+    bulkQuery.finish();
+
+    for (const auto &oneDirectory : qAsConst(removedDirectories)) {
+        internalRemoveDirectory(oneDirectory);
+    }
+
+    if (!removedTracksIds.isEmpty()) {
+        Q_EMIT tracksRemoved(removedTracksIds);
+    }
+
+    // the same conditions select the ids to notify and the rows to delete
+    const auto albumTracksCondition = QStringLiteral("%1.`AlbumTitle` = album.`Title` AND "
+                                                     "(%1.`AlbumArtistName` = album.`ArtistName` OR %1.`AlbumArtistName` IS NULL) AND "
+                                                     "%1.`AlbumPath` = album.`AlbumPath`");
+    const auto modifiedAlbumsCondition = QStringLiteral("EXISTS (SELECT 1 FROM temp.`RemovedTracks` removed WHERE %1)")
+            .arg(albumTracksCondition.arg(QStringLiteral("removed")));
+    const auto orphanedAlbumsCondition = QStringLiteral("%1 AND NOT EXISTS (SELECT 1 FROM `Tracks` tracks WHERE %2)")
+            .arg(modifiedAlbumsCondition, albumTracksCondition.arg(QStringLiteral("tracks")));
+
+    if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("SELECT "
+                                                        "album.`ID`, "
+                                                        "NOT EXISTS (SELECT 1 FROM `Tracks` tracks WHERE %1) "
+                                                        "FROM "
+                                                        "`Albums` album "
+                                                        "WHERE "
+                                                        "%2").arg(albumTracksCondition.arg(QStringLiteral("tracks")), modifiedAlbumsCondition))) {
+        return;
+    }
+
+    QList<qulonglong> modifiedAlbumsIds;
+    QList<qulonglong> removedAlbumsIds;
+
+    while (bulkQuery.next()) {
+        const auto &currentRecord = bulkQuery.record();
+
+        if (currentRecord.value(1).toBool()) {
+            removedAlbumsIds.push_back(currentRecord.value(0).toULongLong());
+        } else {
+            modifiedAlbumsIds.push_back(currentRecord.value(0).toULongLong());
+        }
+    }
+
+    bulkQuery.finish();
+
+    if (!removedAlbumsIds.isEmpty()) {
+        if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM `AlbumSummary` "
+                                                            "WHERE "
+                                                            "`AlbumID` IN (SELECT album.`ID` FROM `Albums` album WHERE %1)").arg(orphanedAlbumsCondition)) ||
+                !execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM `Albums` "
+                                                                "WHERE "
+                                                                "`ID` IN (SELECT album.`ID` FROM `Albums` album WHERE %1)").arg(orphanedAlbumsCondition))) {
+            return;
+        }
+
+        d->mAlbumIdCache.clear();
+        for (auto removedAlbumId : qAsConst(removedAlbumsIds)) {
+            d->mAlbumTitleArtistCache.remove(removedAlbumId);
+            d->mStaleAlbumSummaries.remove(removedAlbumId);
+        }
+    }
+
+    for (auto modifiedAlbumId : qAsConst(modifiedAlbumsIds)) {
+        recordModifiedAlbum(modifiedAlbumId);
+
+        Q_EMIT albumModified({{DatabaseIdRole, modifiedAlbumId}}, modifiedAlbumId);
+    }
+
+    if (!removedAlbumsIds.isEmpty()) {
+        Q_EMIT albumsRemoved(removedAlbumsIds);
+    }
+
+    const auto orphanedArtistsCondition = QStringLiteral("(artist.`Name` IN (SELECT `ArtistName` FROM temp.`RemovedTracks`) OR "
+                                                         "artist.`Name` IN (SELECT `AlbumArtistName` FROM temp.`RemovedTracks`)) AND "
+                                                         "NOT EXISTS (SELECT 1 FROM `Tracks` tracks WHERE tracks.`ArtistName` = artist.`Name`) AND "
+                                                         "NOT EXISTS (SELECT 1 FROM `Albums` album WHERE album.`ArtistName` = artist.`Name`)");
+
+    if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("SELECT "
+                                                        "artist.`ID`, "
+                                                        "artist.`Name` "
+                                                        "FROM "
+                                                        "`Artists` artist "
+                                                        "WHERE "
+                                                        "%1").arg(orphanedArtistsCondition))) {
+        return;
+    }
+
+    QList<qulonglong> removedArtistsIds;
+    QStringList removedArtistsNames;
+
+    while (bulkQuery.next()) {
+        const auto &currentRecord = bulkQuery.record();
+
+        removedArtistsIds.push_back(currentRecord.value(0).toULongLong());
+        removedArtistsNames.push_back(currentRecord.value(1).toString());
+    }
+
+    bulkQuery.finish();
+
+    if (!removedArtistsIds.isEmpty()) {
+        if (!execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM `Artists` "
+                                                            "WHERE "
+                                                            "`ID` IN (SELECT artist.`ID` FROM `Artists` artist WHERE %1)").arg(orphanedArtistsCondition))) {
+            return;
+        }
+
+        if (d->mHasNameDictionaries) {
+            for (const auto &removedArtistName : qAsConst(removedArtistsNames)) {
+                d->mArtistIdCache.remove(removedArtistName);
             }
+        } else {
+            d->mArtistIdCache.clear();
         }
+
+        Q_EMIT artistsRemoved(removedArtistsIds);
     }
+
+    execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM temp.`RemovedFiles`"));
+    execBulkRemovalQuery(bulkQuery, QStringLiteral("DELETE FROM temp.`RemovedTracks`"));
 }
 
 QUrl DatabaseInterface::internalAlbumArtUriFromAlbumId(qulonglong albumId)
@@ -6011,36 +9261,57 @@ qulonglong DatabaseInterface::insertLyricist(const QString &name)
         return result;
     }
 
-    d->mSelectLyricistByNameQuery.bindValue(QStringLiteral(":name"), name);
+    auto isKnownMissingName = false;
 
-    auto queryResult = execQuery(d->mSelectLyricistByNameQuery);
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        const auto itCache = d->mLyricistIdCache.constFind(name);
+        if (itCache != d->mLyricistIdCache.constEnd()) {
+            if (*itCache != 0) {
+                return *itCache;
+            }
 
-    if (!queryResult || !d->mSelectLyricistByNameQuery.isSelect() || !d->mSelectLyricistByNameQuery.isActive()) {
-        Q_EMIT databaseError();
+            isKnownMissingName = true;
+        } else if (d->mHasNameDictionaries) {
+            isKnownMissingName = true;
+        }
+    }
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.lastError();
+    if (!isKnownMissingName) {
+        d->mSelectLyricistByNameQuery.bindValue(QStringLiteral(":name"), name);
 
-        d->mSelectLyricistByNameQuery.finish();
+        auto queryResult = execQuery(d->mSelectLyricistByNameQuery);
 
-        return result;
-    }
+        if (!queryResult || !d->mSelectLyricistByNameQuery.isSelect() || !d->mSelectLyricistByNameQuery.isActive()) {
+            Q_EMIT databaseError();
 
-    if (d->mSelectLyricistByNameQuery.next()) {
-        result = d->mSelectLyricistByNameQuery.record().value(0).toULongLong();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::insertLyricist" << d->mSelectLyricistByNameQuery.lastError();
 
-        d->mSelectLyricistByNameQuery.finish();
+            d->mSelectLyricistByNameQuery.finish();
 
-        return result;
-    }
+            return result;
+        }
+
+        if (d->mSelectLyricistByNameQuery.next()) {
+            result = d->mSelectLyricistByNameQuery.record().value(0).toULongLong();
+
+            d->mSelectLyricistByNameQuery.finish();
 
-    d->mSelectLyricistByNameQuery.finish();
+            if (d->mIsBulkInsert) {
+                d->mLyricistIdCache[name] = result;
+            }
+
+            return result;
+        }
+
+        d->mSelectLyricistByNameQuery.finish();
+    }
 
     d->mInsertLyricistQuery.bindValue(QStringLiteral(":lyricistId"), d->mLyricistId);
     d->mInsertLyricistQuery.bindValue(QStringLiteral(":name"), name);
 
-    queryResult = execQuery(d->mInsertLyricistQuery);
+    auto queryResult = execQuery(d->mInsertLyricistQuery);
 
     if (!queryResult || !d->mInsertLyricistQuery.isActive()) {
         Q_EMIT databaseError();
@@ -6060,7 +9331,15 @@ qulonglong DatabaseInterface::insertLyricist(const QString &name)
 
     d->mInsertLyricistQuery.finish();
 
-    Q_EMIT lyricistsAdded(internalAllLyricistsPartialData());
+    if (d->mIsBulkInsert || d->mHasNameDictionaries) {
+        d->mLyricistIdCache[name] = result;
+    }
+
+    if (d->mIsBulkInsert) {
+        d->mInsertedLyricists.insert(result);
+    } else {
+        Q_EMIT lyricistsAdded(internalAllLyricistsPartialData());
+    }
 
     return result;
 }
@@ -6095,6 +9374,59 @@ QHash<QUrl, QDateTime> DatabaseInterface::internalAllFileName()
     return allFileNames;
 }
 
+DatabaseInterface::DirectoriesDataType DatabaseInterface::internalAllDirectories()
+{
+    auto allDirectories = DirectoriesDataType{};
+
+    auto queryResult = execQuery(d->mSelectAllDirectoriesQuery);
+
+    if (!queryResult || !d->mSelectAllDirectoriesQuery.isSelect() || !d->mSelectAllDirectoriesQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectories" << d->mSelectAllDirectoriesQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectories" << d->mSelectAllDirectoriesQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAllDirectories" << d->mSelectAllDirectoriesQuery.lastError();
+
+        d->mSelectAllDirectoriesQuery.finish();
+
+        return allDirectories;
+    }
+
+    while(d->mSelectAllDirectoriesQuery.next()) {
+        const auto &currentRecord = d->mSelectAllDirectoriesQuery.record();
+
+        auto &oneDirectory = allDirectories[currentRecord.value(0).toUrl()];
+        oneDirectory.mModifiedTime = currentRecord.value(1).toDateTime();
+        oneDirectory.mEntriesCount = currentRecord.value(2).toInt();
+        oneDirectory.mMountPoint = currentRecord.value(3).toString();
+    }
+
+    d->mSelectAllDirectoriesQuery.finish();
+
+    return allDirectories;
+}
+
+void DatabaseInterface::internalRemoveDirectory(const QUrl &directory)
+{
+    const auto &childPathPrefix = QString(directory.toString() + QLatin1Char('/'));
+
+    d->mRemoveDirectoryQuery.bindValue(QStringLiteral(":path"), directory);
+    d->mRemoveDirectoryQuery.bindValue(QStringLiteral(":pathPrefix"), childPathPrefix);
+    d->mRemoveDirectoryQuery.bindValue(QStringLiteral(":childPathPrefix"), childPathPrefix);
+
+    auto queryResult = execQuery(d->mRemoveDirectoryQuery);
+
+    if (!queryResult || !d->mRemoveDirectoryQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveDirectory" << d->mRemoveDirectoryQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveDirectory" << d->mRemoveDirectoryQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalRemoveDirectory" << d->mRemoveDirectoryQuery.lastError();
+    }
+
+    d->mRemoveDirectoryQuery.finish();
+}
+
 qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
 {
     auto result = qulonglong(0);
@@ -6103,6 +9435,10 @@ qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
         return result;
     }
 
+    if (d->mHasNameDictionaries) {
+        return d->mArtistIdCache.value(name);
+    }
+
     d->mSelectArtistByNameQuery.bindValue(QStringLiteral(":name"), name);
 
     auto queryResult = execQuery(d->mSelectArtistByNameQuery);
@@ -6134,6 +9470,8 @@ qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
 
 void DatabaseInterface::removeTrackInDatabase(qulonglong trackId)
 {
+    d->mStaleSearchEntries.insert(trackId);
+
     d->mRemoveTrackQuery.bindValue(QStringLiteral(":trackId"), trackId);
 
     auto result = execQuery(d->mRemoveTrackQuery);
@@ -6223,6 +9561,24 @@ void DatabaseInterface::updateTrackInDatabase(const MusicAudioTrack &oneTrack, c
 
 void DatabaseInterface::removeAlbumInDatabase(qulonglong albumId)
 {
+    d->mAlbumIdCache.clear();
+    d->mAlbumTitleArtistCache.remove(albumId);
+    d->mStaleAlbumSummaries.remove(albumId);
+
+    d->mRemoveAlbumSummaryQuery.bindValue(QStringLiteral(":albumId"), albumId);
+
+    auto summaryResult = execQuery(d->mRemoveAlbumSummaryQuery);
+
+    if (!summaryResult || !d->mRemoveAlbumSummaryQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAlbumInDatabase" << d->mRemoveAlbumSummaryQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAlbumInDatabase" << d->mRemoveAlbumSummaryQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAlbumInDatabase" << d->mRemoveAlbumSummaryQuery.lastError();
+    }
+
+    d->mRemoveAlbumSummaryQuery.finish();
+
     d->mRemoveAlbumQuery.bindValue(QStringLiteral(":albumId"), albumId);
 
     auto result = execQuery(d->mRemoveAlbumQuery);
@@ -6235,36 +9591,110 @@ void DatabaseInterface::removeAlbumInDatabase(qulonglong albumId)
         qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeAlbumInDatabase" << d->mRemoveAlbumQuery.lastError();
     }
 
-    d->mRemoveAlbumQuery.finish();
+    d->mRemoveAlbumQuery.finish();
+}
+
+void DatabaseInterface::removeArtistInDatabase(qulonglong artistId, const QString &artistName)
+{
+    if (d->mHasNameDictionaries) {
+        d->mArtistIdCache.remove(artistName);
+    } else {
+        d->mArtistIdCache.clear();
+    }
+
+    d->mRemoveArtistQuery.bindValue(QStringLiteral(":artistId"), artistId);
+
+    auto result = execQuery(d->mRemoveArtistQuery);
+
+    if (!result || !d->mRemoveArtistQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.lastError();
+    }
+
+    d->mRemoveArtistQuery.finish();
+}
+
+void DatabaseInterface::reloadExistingDatabase()
+{
+    qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::reloadExistingDatabase";
+
+    d->mArtistId = initialId(DataUtils::DataType::AllArtists);
+    d->mComposerId = initialId(DataUtils::DataType::AllComposers);
+    d->mLyricistId = initialId(DataUtils::DataType::AllLyricists);
+    d->mAlbumId = initialId(DataUtils::DataType::AllAlbums);
+    d->mTrackId = initialId(DataUtils::DataType::AllTracks);
+    d->mGenreId = initialId(DataUtils::DataType::AllGenres);;
+
+    loadNameDictionaries();
+}
+
+void DatabaseInterface::loadNameDictionaries()
+{
+    d->mHasNameDictionaries = false;
+
+    d->mArtistIdCache.clear();
+    d->mComposerIdCache.clear();
+    d->mLyricistIdCache.clear();
+    d->mGenreIdCache.clear();
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto result = loadNameDictionary(QStringLiteral("Artists"), d->mArtistIdCache) &&
+            loadNameDictionary(QStringLiteral("Composer"), d->mComposerIdCache) &&
+            loadNameDictionary(QStringLiteral("Lyricist"), d->mLyricistIdCache) &&
+            loadNameDictionary(QStringLiteral("Genre"), d->mGenreIdCache);
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        result = false;
+    }
+
+    if (!result) {
+        d->mArtistIdCache.clear();
+        d->mComposerIdCache.clear();
+        d->mLyricistIdCache.clear();
+        d->mGenreIdCache.clear();
+
+        return;
+    }
+
+    d->mHasNameDictionaries = true;
 }
 
-void DatabaseInterface::removeArtistInDatabase(qulonglong artistId)
+bool DatabaseInterface::loadNameDictionary(const QString &tableName, QHash<QString, qulonglong> &namesIds)
 {
-    d->mRemoveArtistQuery.bindValue(QStringLiteral(":artistId"), artistId);
+    QSqlQuery selectQuery(d->mTracksDatabase);
 
-    auto result = execQuery(d->mRemoveArtistQuery);
+    prepareQuery(selectQuery, QStringLiteral("SELECT `ID`, `Name` FROM `%1`").arg(tableName));
 
-    if (!result || !d->mRemoveArtistQuery.isActive()) {
+    auto queryResult = execQuery(selectQuery);
+
+    if (!queryResult || !selectQuery.isSelect() || !selectQuery.isActive()) {
         Q_EMIT databaseError();
 
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.lastQuery();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.boundValues();
-        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::removeArtistInDatabase" << d->mRemoveArtistQuery.lastError();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::loadNameDictionary" << selectQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::loadNameDictionary" << selectQuery.lastError();
+
+        selectQuery.finish();
+
+        return false;
     }
 
-    d->mRemoveArtistQuery.finish();
-}
+    while (selectQuery.next()) {
+        const auto &currentRecord = selectQuery.record();
 
-void DatabaseInterface::reloadExistingDatabase()
-{
-    qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::reloadExistingDatabase";
+        namesIds[currentRecord.value(1).toString()] = currentRecord.value(0).toULongLong();
+    }
 
-    d->mArtistId = initialId(DataUtils::DataType::AllArtists);
-    d->mComposerId = initialId(DataUtils::DataType::AllComposers);
-    d->mLyricistId = initialId(DataUtils::DataType::AllLyricists);
-    d->mAlbumId = initialId(DataUtils::DataType::AllAlbums);
-    d->mTrackId = initialId(DataUtils::DataType::AllTracks);
-    d->mGenreId = initialId(DataUtils::DataType::AllGenres);;
+    selectQuery.finish();
+
+    return true;
 }
 
 qulonglong DatabaseInterface::initialId(DataUtils::DataType aType)
@@ -6536,6 +9966,120 @@ qulonglong DatabaseInterface::getDuplicateTrackIdFromTitleAlbumTrackDiscNumber(c
     return result;
 }
 
+qulonglong DatabaseInterface::internalAlbumIdFromTrackFileName(const QUrl &fileName)
+{
+    auto result = qulonglong(0);
+
+    d->mSelectAlbumIdFromTrackFileNameQuery.bindValue(QStringLiteral(":fileName"), fileName.toString());
+
+    auto queryResult = execQuery(d->mSelectAlbumIdFromTrackFileNameQuery);
+
+    if (!queryResult || !d->mSelectAlbumIdFromTrackFileNameQuery.isSelect() || !d->mSelectAlbumIdFromTrackFileNameQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumIdFromTrackFileName" << d->mSelectAlbumIdFromTrackFileNameQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumIdFromTrackFileName" << d->mSelectAlbumIdFromTrackFileNameQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumIdFromTrackFileName" << d->mSelectAlbumIdFromTrackFileNameQuery.lastError();
+
+        d->mSelectAlbumIdFromTrackFileNameQuery.finish();
+
+        return result;
+    }
+
+    if (d->mSelectAlbumIdFromTrackFileNameQuery.next()) {
+        result = d->mSelectAlbumIdFromTrackFileNameQuery.record().value(0).toULongLong();
+    }
+
+    d->mSelectAlbumIdFromTrackFileNameQuery.finish();
+
+    return result;
+}
+
+QList<qulonglong> DatabaseInterface::internalArtistIdsFromTrackId(qulonglong trackId)
+{
+    auto result = QList<qulonglong>();
+
+    d->mSelectArtistIdsFromTrackIdQuery.bindValue(QStringLiteral(":trackId"), trackId);
+
+    auto queryResult = execQuery(d->mSelectArtistIdsFromTrackIdQuery);
+
+    if (!queryResult || !d->mSelectArtistIdsFromTrackIdQuery.isSelect() || !d->mSelectArtistIdsFromTrackIdQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistIdsFromTrackId" << d->mSelectArtistIdsFromTrackIdQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistIdsFromTrackId" << d->mSelectArtistIdsFromTrackIdQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistIdsFromTrackId" << d->mSelectArtistIdsFromTrackIdQuery.lastError();
+
+        d->mSelectArtistIdsFromTrackIdQuery.finish();
+
+        return result;
+    }
+
+    while (d->mSelectArtistIdsFromTrackIdQuery.next()) {
+        result.push_back(d->mSelectArtistIdsFromTrackIdQuery.record().value(0).toULongLong());
+    }
+
+    d->mSelectArtistIdsFromTrackIdQuery.finish();
+
+    return result;
+}
+
+bool DatabaseInterface::internalAlbumHasOnlineTracks(qulonglong albumId)
+{
+    auto result = false;
+
+    d->mSelectAlbumOnlineTracksCountQuery.bindValue(QStringLiteral(":albumId"), albumId);
+
+    auto queryResult = execQuery(d->mSelectAlbumOnlineTracksCountQuery);
+
+    if (!queryResult || !d->mSelectAlbumOnlineTracksCountQuery.isSelect() || !d->mSelectAlbumOnlineTracksCountQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumHasOnlineTracks" << d->mSelectAlbumOnlineTracksCountQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumHasOnlineTracks" << d->mSelectAlbumOnlineTracksCountQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalAlbumHasOnlineTracks" << d->mSelectAlbumOnlineTracksCountQuery.lastError();
+
+        d->mSelectAlbumOnlineTracksCountQuery.finish();
+
+        return result;
+    }
+
+    if (d->mSelectAlbumOnlineTracksCountQuery.next()) {
+        result = d->mSelectAlbumOnlineTracksCountQuery.record().value(0).toInt() > 0;
+    }
+
+    d->mSelectAlbumOnlineTracksCountQuery.finish();
+
+    return result;
+}
+
+bool DatabaseInterface::internalArtistHasOnlineTracks(qulonglong artistId)
+{
+    auto result = false;
+
+    d->mSelectArtistHasOnlineTracksQuery.bindValue(QStringLiteral(":artistId"), artistId);
+
+    auto queryResult = execQuery(d->mSelectArtistHasOnlineTracksQuery);
+
+    if (!queryResult || !d->mSelectArtistHasOnlineTracksQuery.isSelect() || !d->mSelectArtistHasOnlineTracksQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistHasOnlineTracks" << d->mSelectArtistHasOnlineTracksQuery.lastQuery();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistHasOnlineTracks" << d->mSelectArtistHasOnlineTracksQuery.boundValues();
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalArtistHasOnlineTracks" << d->mSelectArtistHasOnlineTracksQuery.lastError();
+
+        d->mSelectArtistHasOnlineTracksQuery.finish();
+
+        return result;
+    }
+
+    result = d->mSelectArtistHasOnlineTracksQuery.next();
+
+    d->mSelectArtistHasOnlineTracksQuery.finish();
+
+    return result;
+}
+
 qulonglong DatabaseInterface::internalTrackIdFromFileName(const QUrl &fileName)
 {
     auto result = qulonglong(0);
@@ -6672,7 +10216,9 @@ DatabaseInterface::ListAlbumDataType DatabaseInterface::internalAllAlbumsPartial
         newData[DataType::key_type::DatabaseIdRole] = currentRecord.value(0);
         newData[DataType::key_type::TitleRole] = currentRecord.value(1);
         newData[DataType::key_type::SecondaryTextRole] = currentRecord.value(2);
-        if (!currentRecord.value(3).toString().isEmpty()) {
+        if (!currentRecord.value(10).toString().isEmpty()) {
+            newData[DataType::key_type::ImageUrlRole] = QVariant{QStringLiteral("image://albumart/") + currentRecord.value(10).toString()};
+        } else if (!currentRecord.value(3).toString().isEmpty()) {
             newData[DataType::key_type::ImageUrlRole] = currentRecord.value(3);
         } else if (!currentRecord.value(9).toString().isEmpty()) {
             newData[DataType::key_type::ImageUrlRole] = QVariant{QStringLiteral("image://cover/") + currentRecord.value(9).toUrl().toLocalFile()};
@@ -6708,7 +10254,9 @@ DatabaseInterface::AlbumDataType DatabaseInterface::internalOneAlbumPartialData(
         result[DataType::key_type::DatabaseIdRole] = currentRecord.value(0);
         result[DataType::key_type::TitleRole] = currentRecord.value(1);
         result[DataType::key_type::SecondaryTextRole] = currentRecord.value(2);
-        if (!currentRecord.value(4).toString().isEmpty()) {
+        if (!currentRecord.value(11).toString().isEmpty()) {
+            result[DataType::key_type::ImageUrlRole] = QVariant{QStringLiteral("image://albumart/") + currentRecord.value(11).toString()};
+        } else if (!currentRecord.value(4).toString().isEmpty()) {
             result[DataType::key_type::ImageUrlRole] = currentRecord.value(4);
         } else if (!currentRecord.value(10).toString().isEmpty()) {
             result[DataType::key_type::ImageUrlRole] = QVariant{QStringLiteral("image://cover/") + currentRecord.value(10).toUrl().toLocalFile()};
@@ -6726,23 +10274,23 @@ DatabaseInterface::AlbumDataType DatabaseInterface::internalOneAlbumPartialData(
     return result;
 }
 
-DatabaseInterface::ListTrackDataType DatabaseInterface::internalAllTracksPartialData()
+DatabaseInterface::ListTrackDataType DatabaseInterface::internalAllTracksPartialData(QSqlQuery &query)
 {
     auto result = ListTrackDataType{};
 
-    if (!internalGenericPartialData(d->mSelectAllTracksQuery)) {
+    if (!internalGenericPartialData(query)) {
         return result;
     }
 
-    while(d->mSelectAllTracksQuery.next()) {
-        const auto &currentRecord = d->mSelectAllTracksQuery.record();
+    while(query.next()) {
+        const auto &currentRecord = query.record();
 
         auto newData = buildTrackDataFromDatabaseRecord(currentRecord);
 
         result.push_back(newData);
     }
 
-    d->mSelectAllTracksQuery.finish();
+    query.finish();
 
     return result;
 }
@@ -6814,6 +10362,61 @@ DatabaseInterface::TrackDataType DatabaseInterface::internalOneTrackPartialData(
     return result;
 }
 
+DatabaseInterface::ListTrackDataType DatabaseInterface::internalTracksPartialData(const QList<qulonglong> &databaseIds)
+{
+    const auto maximumBoundValues = 500;
+
+    auto tracksData = QHash<qulonglong, TrackDataType>{};
+
+    for (int firstIndex = 0; firstIndex < databaseIds.size(); firstIndex += maximumBoundValues) {
+        const auto &idsChunk = databaseIds.mid(firstIndex, maximumBoundValues);
+
+        auto placeholders = QStringList{};
+        for (int i = 0; i < idsChunk.size(); ++i) {
+            placeholders.push_back(QStringLiteral("?"));
+        }
+
+        QSqlQuery selectQuery(d->mTracksDatabase);
+
+        prepareQuery(selectQuery, d->mSelectTracksFromIdsQueryText.arg(QStringLiteral("IN (") + placeholders.join(QStringLiteral(", ")) + QStringLiteral(")")));
+
+        for (auto oneId : idsChunk) {
+            selectQuery.addBindValue(oneId);
+        }
+
+        auto queryResult = execQuery(selectQuery);
+
+        if (!queryResult || !selectQuery.isSelect() || !selectQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalTracksPartialData" << selectQuery.lastQuery();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalTracksPartialData" << selectQuery.boundValues();
+            qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::internalTracksPartialData" << selectQuery.lastError();
+
+            selectQuery.finish();
+
+            break;
+        }
+
+        while (selectQuery.next()) {
+            const auto &currentRecord = selectQuery.record();
+
+            tracksData[currentRecord.value(0).toULongLong()] = buildTrackDataFromDatabaseRecord(currentRecord);
+        }
+
+        selectQuery.finish();
+    }
+
+    auto result = ListTrackDataType{};
+    result.reserve(databaseIds.size());
+
+    for (auto oneId : databaseIds) {
+        result.push_back(tracksData.value(oneId));
+    }
+
+    return result;
+}
+
 DatabaseInterface::ListGenreDataType DatabaseInterface::internalAllGenresPartialData()
 {
     ListGenreDataType result;
@@ -6897,26 +10500,64 @@ bool DatabaseInterface::prepareQuery(QSqlQuery &query, const QString &queryText)
 
 bool DatabaseInterface::execQuery(QSqlQuery &query)
 {
-#if !defined NDEBUG
+    if (!orgKdeElisaDatabaseProfiler().isDebugEnabled()) {
+        return query.exec();
+    }
+
     auto timer = QElapsedTimer{};
     timer.start();
-#endif
 
     auto result = query.exec();
 
-#if !defined NDEBUG
-    if (timer.nsecsElapsed() > 10000000) {
-        qCDebug(orgKdeElisaDatabase) << "[[" << timer.nsecsElapsed() << "]]" << query.lastQuery();
+    const auto elapsed = timer.nsecsElapsed();
+
+    d->mStatementStatistics[query.lastQuery()].record(elapsed, query.isSelect() ? 0 : query.numRowsAffected());
+
+    if (elapsed > qint64{slowQueryThreshold.loadAcquire()} * 1000000) {
+        logSlowQuery(query, elapsed);
     }
-#endif
 
     return result;
 }
 
+void DatabaseInterface::logSlowQuery(const QSqlQuery &query, qint64 elapsed)
+{
+    qCDebug(orgKdeElisaDatabaseProfiler) << "slow query" << elapsed / 1000000.0 << "ms" << query.lastQuery().simplified();
+    qCDebug(orgKdeElisaDatabaseProfiler) << "slow query" << query.boundValues();
+
+    auto explainQuery = QSqlQuery{d->mTracksDatabase};
+    explainQuery.setForwardOnly(true);
+
+    if (!explainQuery.prepare(QStringLiteral("EXPLAIN QUERY PLAN ") + query.lastQuery())) {
+        qCDebug(orgKdeElisaDatabaseProfiler) << "slow query" << "no query plan" << explainQuery.lastError();
+        return;
+    }
+
+    const auto &boundValues = query.boundValues();
+    for (auto itValue = boundValues.cbegin(); itValue != boundValues.cend(); ++itValue) {
+        explainQuery.bindValue(itValue.key(), itValue.value());
+    }
+
+    if (!explainQuery.exec()) {
+        qCDebug(orgKdeElisaDatabaseProfiler) << "slow query" << "no query plan" << explainQuery.lastError();
+        return;
+    }
+
+    while (explainQuery.next()) {
+        const auto &currentRecord = explainQuery.record();
+        qCDebug(orgKdeElisaDatabaseProfiler) << "query plan" << currentRecord.value(currentRecord.count() - 1).toString();
+    }
+
+    explainQuery.finish();
+}
+
 void DatabaseInterface::updateAlbumArtist(qulonglong albumId, const QString &title,
                                           const QString &albumPath,
                                           const QString &artistName)
 {
+    d->mAlbumIdCache.clear();
+    d->mAlbumTitleArtistCache.remove(albumId);
+
     d->mUpdateAlbumArtistQuery.bindValue(QStringLiteral(":albumId"), albumId);
     insertArtist(artistName);
     d->mUpdateAlbumArtistQuery.bindValue(QStringLiteral(":artistName"), artistName);
@@ -6956,12 +10597,18 @@ void DatabaseInterface::updateAlbumArtist(qulonglong albumId, const QString &tit
     }
 
     d->mUpdateAlbumArtistInTracksQuery.finish();
+
+    const auto &albumTracks = fetchTrackIds(albumId);
+    for (auto oneTrackId : albumTracks) {
+        d->mStaleSearchEntries.insert(oneTrackId);
+    }
 }
 
-void DatabaseInterface::updateTrackStatistics(const QUrl &fileName, const QDateTime &time)
+void DatabaseInterface::updateTrackStatistics(const QUrl &fileName, const PendingPlayStatistics &statistics)
 {
     d->mUpdateTrackStatistics.bindValue(QStringLiteral(":fileName"), fileName);
-    d->mUpdateTrackStatistics.bindValue(QStringLiteral(":playDate"), time.toMSecsSinceEpoch());
+    d->mUpdateTrackStatistics.bindValue(QStringLiteral(":playDate"), statistics.mLastPlayDate.toMSecsSinceEpoch());
+    d->mUpdateTrackStatistics.bindValue(QStringLiteral(":playCount"), statistics.mPlayCount);
 
     auto queryResult = execQuery(d->mUpdateTrackStatistics);
 
@@ -6980,7 +10627,7 @@ void DatabaseInterface::updateTrackStatistics(const QUrl &fileName, const QDateT
     d->mUpdateTrackStatistics.finish();
 
     d->mUpdateTrackFirstPlayStatistics.bindValue(QStringLiteral(":fileName"), fileName);
-    d->mUpdateTrackFirstPlayStatistics.bindValue(QStringLiteral(":playDate"), time.toMSecsSinceEpoch());
+    d->mUpdateTrackFirstPlayStatistics.bindValue(QStringLiteral(":playDate"), statistics.mFirstPlayDate.toMSecsSinceEpoch());
 
     queryResult = execQuery(d->mUpdateTrackFirstPlayStatistics);
 
@@ -6999,5 +10646,415 @@ void DatabaseInterface::updateTrackStatistics(const QUrl &fileName, const QDateT
     d->mUpdateTrackFirstPlayStatistics.finish();
 }
 
+static QDateTime trackDateTimeFromVariant(const QVariant &value)
+{
+    if (value.userType() == QMetaType::QDateTime || value.userType() == QMetaType::QString) {
+        return value.toDateTime();
+    }
+
+    return QDateTime::fromMSecsSinceEpoch(value.toLongLong());
+}
+
+static bool isTrackField(DatabaseInterface::ColumnsRoles key)
+{
+    switch (key)
+    {
+    case DatabaseInterface::TitleRole:
+    case DatabaseInterface::ImageUrlRole:
+    case DatabaseInterface::DurationRole:
+    case DatabaseInterface::ArtistRole:
+    case DatabaseInterface::AlbumRole:
+    case DatabaseInterface::AlbumArtistRole:
+    case DatabaseInterface::TrackNumberRole:
+    case DatabaseInterface::DiscNumberRole:
+    case DatabaseInterface::RatingRole:
+    case DatabaseInterface::GenreRole:
+    case DatabaseInterface::LyricistRole:
+    case DatabaseInterface::ComposerRole:
+    case DatabaseInterface::CommentRole:
+    case DatabaseInterface::YearRole:
+    case DatabaseInterface::ChannelsRole:
+    case DatabaseInterface::BitRateRole:
+    case DatabaseInterface::SampleRateRole:
+    case DatabaseInterface::ResourceRole:
+    case DatabaseInterface::DatabaseIdRole:
+    case DatabaseInterface::IsSingleDiscAlbumRole:
+    case DatabaseInterface::AlbumIdRole:
+    case DatabaseInterface::HasEmbeddedCover:
+    case DatabaseInterface::FileModificationTime:
+    case DatabaseInterface::FirstPlayDate:
+    case DatabaseInterface::LastPlayDate:
+    case DatabaseInterface::PlayCounter:
+    case DatabaseInterface::PlayFrequency:
+    case DatabaseInterface::ElementTypeRole:
+    case DatabaseInterface::LyricsRole:
+        return true;
+    case DatabaseInterface::SecondaryTextRole:
+    case DatabaseInterface::ShadowForImageRole:
+    case DatabaseInterface::ChildModelRole:
+    case DatabaseInterface::StringDurationRole:
+    case DatabaseInterface::MilliSecondsDurationRole:
+    case DatabaseInterface::AllArtistsRole:
+    case DatabaseInterface::HighestTrackRating:
+    case DatabaseInterface::IdRole:
+    case DatabaseInterface::ContainerDataRole:
+    case DatabaseInterface::IsPartialDataRole:
+        break;
+    }
+
+    return false;
+}
+
+static bool sameTrackField(const DatabaseInterface::TrackDataType &first, const DatabaseInterface::TrackDataType &second,
+                           DatabaseInterface::ColumnsRoles key)
+{
+    switch (key)
+    {
+    case DatabaseInterface::TitleRole:
+        return first.title() == second.title();
+    case DatabaseInterface::ImageUrlRole:
+        return first.albumCover() == second.albumCover();
+    case DatabaseInterface::DurationRole:
+    case DatabaseInterface::MilliSecondsDurationRole:
+        return first.duration() == second.duration();
+    case DatabaseInterface::ArtistRole:
+        return first.artist() == second.artist();
+    case DatabaseInterface::AlbumRole:
+        return first.album() == second.album();
+    case DatabaseInterface::AlbumArtistRole:
+        return first.albumArtist() == second.albumArtist();
+    case DatabaseInterface::TrackNumberRole:
+        return first.trackNumber() == second.trackNumber();
+    case DatabaseInterface::DiscNumberRole:
+        return first.discNumber() == second.discNumber();
+    case DatabaseInterface::RatingRole:
+        return first.rating() == second.rating();
+    case DatabaseInterface::GenreRole:
+        return first.genre() == second.genre();
+    case DatabaseInterface::LyricistRole:
+        return first.lyricist() == second.lyricist();
+    case DatabaseInterface::ComposerRole:
+        return first.composer() == second.composer();
+    case DatabaseInterface::CommentRole:
+        return first.comment() == second.comment();
+    case DatabaseInterface::YearRole:
+        return first.year() == second.year();
+    case DatabaseInterface::ChannelsRole:
+        return first.channels() == second.channels();
+    case DatabaseInterface::BitRateRole:
+        return first.bitRate() == second.bitRate();
+    case DatabaseInterface::SampleRateRole:
+        return first.sampleRate() == second.sampleRate();
+    case DatabaseInterface::ResourceRole:
+        return first.resourceURI() == second.resourceURI();
+    case DatabaseInterface::DatabaseIdRole:
+        return first.databaseId() == second.databaseId();
+    case DatabaseInterface::IsSingleDiscAlbumRole:
+        return first.isSingleDiscAlbum() == second.isSingleDiscAlbum();
+    case DatabaseInterface::AlbumIdRole:
+        return first.albumId() == second.albumId();
+    case DatabaseInterface::HasEmbeddedCover:
+        return first.hasEmbeddedCover() == second.hasEmbeddedCover();
+    case DatabaseInterface::FileModificationTime:
+        return first.fileModificationTime() == second.fileModificationTime();
+    case DatabaseInterface::FirstPlayDate:
+        return first.firstPlayDate() == second.firstPlayDate();
+    case DatabaseInterface::LastPlayDate:
+        return first.lastPlayDate() == second.lastPlayDate();
+    case DatabaseInterface::PlayCounter:
+        return first.playCounter() == second.playCounter();
+    case DatabaseInterface::PlayFrequency:
+        return qFuzzyCompare(1. + first.playFrequency(), 1. + second.playFrequency());
+    case DatabaseInterface::ElementTypeRole:
+        return first.elementType() == second.elementType();
+    case DatabaseInterface::LyricsRole:
+        return first.lyrics() == second.lyrics();
+    case DatabaseInterface::SecondaryTextRole:
+    case DatabaseInterface::ShadowForImageRole:
+    case DatabaseInterface::ChildModelRole:
+    case DatabaseInterface::StringDurationRole:
+    case DatabaseInterface::AllArtistsRole:
+    case DatabaseInterface::HighestTrackRating:
+    case DatabaseInterface::IdRole:
+    case DatabaseInterface::ContainerDataRole:
+    case DatabaseInterface::IsPartialDataRole:
+        break;
+    }
+
+    return true;
+}
+
+bool DatabaseInterface::TrackDataType::operator==(const TrackDataType &other) const
+{
+    if (d == other.d) {
+        return true;
+    }
+
+    if (isEmpty() || other.isEmpty()) {
+        return isEmpty() && other.isEmpty();
+    }
+
+    if (d->mFields != other.d->mFields) {
+        return false;
+    }
+
+    return includes(other);
+}
+
+int DatabaseInterface::TrackDataType::count() const
+{
+    if (!d) {
+        return 0;
+    }
+
+    auto result = 0;
+    for (auto fields = d->mFields; fields; fields &= fields - 1) {
+        ++result;
+    }
+
+    return result;
+}
+
+bool DatabaseInterface::TrackDataType::contains(key_type key) const
+{
+    if (key == MilliSecondsDurationRole) {
+        return hasField(DurationRole);
+    }
+
+    return isTrackField(key) && hasField(key);
+}
+
+QVariant DatabaseInterface::TrackDataType::value(key_type key) const
+{
+    if (!contains(key)) {
+        return {};
+    }
+
+    switch (key)
+    {
+    case TitleRole:
+        return d->mTitle;
+    case ImageUrlRole:
+        return d->mAlbumCover;
+    case DurationRole:
+        return d->mDuration;
+    case MilliSecondsDurationRole:
+        return d->mDuration.msecsSinceStartOfDay();
+    case ArtistRole:
+        return d->mArtist;
+    case AlbumRole:
+        return d->mAlbum;
+    case AlbumArtistRole:
+        return d->mAlbumArtist;
+    case TrackNumberRole:
+        return d->mTrackNumber;
+    case DiscNumberRole:
+        return d->mDiscNumber;
+    case RatingRole:
+        return d->mRating;
+    case GenreRole:
+        return d->mGenre;
+    case LyricistRole:
+        return d->mLyricist;
+    case ComposerRole:
+        return d->mComposer;
+    case CommentRole:
+        return d->mComment;
+    case YearRole:
+        return d->mYear;
+    case ChannelsRole:
+        return d->mChannels;
+    case BitRateRole:
+        return d->mBitRate;
+    case SampleRateRole:
+        return d->mSampleRate;
+    case ResourceRole:
+        return d->mResourceURI;
+    case DatabaseIdRole:
+        return d->mDatabaseId;
+    case IsSingleDiscAlbumRole:
+        return d->mIsSingleDiscAlbum;
+    case AlbumIdRole:
+        return d->mAlbumId;
+    case HasEmbeddedCover:
+        return d->mHasEmbeddedCover;
+    case FileModificationTime:
+        return d->mFileModificationTime;
+    case FirstPlayDate:
+        return d->mFirstPlayDate;
+    case LastPlayDate:
+        return d->mLastPlayDate;
+    case PlayCounter:
+        return d->mPlayCounter;
+    case PlayFrequency:
+        return d->mPlayFrequency;
+    case ElementTypeRole:
+        return static_cast<int>(d->mElementType);
+    case LyricsRole:
+        return d->mLyrics;
+    case SecondaryTextRole:
+    case ShadowForImageRole:
+    case ChildModelRole:
+    case StringDurationRole:
+    case AllArtistsRole:
+    case HighestTrackRating:
+    case IdRole:
+    case ContainerDataRole:
+    case IsPartialDataRole:
+        break;
+    }
+
+    return {};
+}
+
+void DatabaseInterface::TrackDataType::insert(key_type key, const QVariant &value)
+{
+    switch (key)
+    {
+    case TitleRole:
+        setTitle(value.toString());
+        break;
+    case ImageUrlRole:
+        setAlbumCover(value.toUrl());
+        break;
+    case DurationRole:
+        setDuration(value.toTime());
+        break;
+    case MilliSecondsDurationRole:
+        setDuration(QTime::fromMSecsSinceStartOfDay(value.toInt()));
+        break;
+    case ArtistRole:
+        setArtist(value.toString());
+        break;
+    case AlbumRole:
+        setAlbum(value.toString());
+        break;
+    case AlbumArtistRole:
+        setAlbumArtist(value.toString());
+        break;
+    case TrackNumberRole:
+        setTrackNumber(value.toInt());
+        break;
+    case DiscNumberRole:
+        setDiscNumber(value.toInt());
+        break;
+    case RatingRole:
+        setRating(value.toInt());
+        break;
+    case GenreRole:
+        setGenre(value.toString());
+        break;
+    case LyricistRole:
+        setLyricist(value.toString());
+        break;
+    case ComposerRole:
+        setComposer(value.toString());
+        break;
+    case CommentRole:
+        setComment(value.toString());
+        break;
+    case YearRole:
+        setYear(value.toInt());
+        break;
+    case ChannelsRole:
+        setChannels(value.toInt());
+        break;
+    case BitRateRole:
+        setBitRate(value.toInt());
+        break;
+    case SampleRateRole:
+        setSampleRate(value.toInt());
+        break;
+    case ResourceRole:
+        setResourceURI(value.toUrl());
+        break;
+    case DatabaseIdRole:
+        setDatabaseId(value.toULongLong());
+        break;
+    case IsSingleDiscAlbumRole:
+        setIsSingleDiscAlbum(value.toBool());
+        break;
+    case AlbumIdRole:
+        setAlbumId(value.toULongLong());
+        break;
+    case HasEmbeddedCover:
+        setHasEmbeddedCover(value.toBool());
+        break;
+    case FileModificationTime:
+        setFileModificationTime(trackDateTimeFromVariant(value));
+        break;
+    case FirstPlayDate:
+        setFirstPlayDate(trackDateTimeFromVariant(value));
+        break;
+    case LastPlayDate:
+        setLastPlayDate(trackDateTimeFromVariant(value));
+        break;
+    case PlayCounter:
+        setPlayCounter(value.toInt());
+        break;
+    case PlayFrequency:
+        setPlayFrequency(value.toDouble());
+        break;
+    case ElementTypeRole:
+        setElementType(static_cast<ElisaUtils::PlayListEntryType>(value.toInt()));
+        break;
+    case LyricsRole:
+        setLyrics(value.toString());
+        break;
+    case SecondaryTextRole:
+    case ShadowForImageRole:
+    case ChildModelRole:
+    case StringDurationRole:
+    case AllArtistsRole:
+    case HighestTrackRating:
+    case IdRole:
+    case ContainerDataRole:
+    case IsPartialDataRole:
+        qCDebug(orgKdeElisaDatabase) << "DatabaseInterface::TrackDataType::insert" << "not a track field" << key;
+        break;
+    }
+}
+
+void DatabaseInterface::TrackDataType::remove(key_type key)
+{
+    if (key == MilliSecondsDurationRole) {
+        key = DurationRole;
+    }
+
+    if (!contains(key)) {
+        return;
+    }
+
+    d->mFields &= ~fieldFlag(key);
+}
+
+bool DatabaseInterface::TrackDataType::includes(const TrackDataType &other) const
+{
+    if (other.isEmpty()) {
+        return true;
+    }
+
+    if (isEmpty()) {
+        return false;
+    }
+
+    if ((d->mFields & other.d->mFields) != other.d->mFields) {
+        return false;
+    }
+
+    for (auto fields = other.d->mFields; fields; fields &= fields - 1) {
+        auto oneField = 0;
+        while (!(fields & (quint64(1) << oneField))) {
+            ++oneField;
+        }
+
+        if (!sameTrackField(*this, other, static_cast<key_type>(TitleRole + oneField))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 
 #include "moc_databaseinterface.cpp"
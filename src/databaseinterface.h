@@ -25,16 +25,25 @@
 
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <QHash>
+#include <QSet>
 #include <QList>
 #include <QVariant>
 #include <QUrl>
 #include <QDateTime>
+#include <QTime>
 #include <QPair>
+#include <QSharedData>
+#include <QSharedDataPointer>
 
 #include <memory>
+#include <initializer_list>
+#include <utility>
 
 class DatabaseInterfacePrivate;
+class PendingPlayStatistics;
+class PlayStatisticsJournal;
 class QMutex;
 class QSqlRecord;
 class QSqlQuery;
@@ -96,136 +105,478 @@ private:
 
 public:
 
-    class TrackDataType : public DataType
+    class ELISALIB_EXPORT TrackDataType
     {
     public:
 
-        using DataType::DataType;
+        using key_type = ColumnsRoles;
+
+        using mapped_type = QVariant;
+
+        TrackDataType() = default;
+
+        TrackDataType(std::initializer_list<std::pair<key_type, mapped_type>> list)
+        {
+            for (const auto &oneField : list) {
+                insert(oneField.first, oneField.second);
+            }
+        }
+
+        bool operator==(const TrackDataType &other) const;
+
+        bool operator!=(const TrackDataType &other) const
+        {
+            return !operator==(other);
+        }
 
         bool isValid() const
         {
             return !isEmpty();
         }
 
+        bool isEmpty() const
+        {
+            return !d || d->mFields == 0;
+        }
+
+        int count() const;
+
+        int size() const
+        {
+            return count();
+        }
+
+        void clear()
+        {
+            d = nullptr;
+        }
+
+        bool contains(key_type key) const;
+
+        QVariant value(key_type key) const;
+
+        QVariant operator[](key_type key) const
+        {
+            return value(key);
+        }
+
+        void insert(key_type key, const QVariant &value);
+
+        void remove(key_type key);
+
+        /**
+         * Return true if every field set in other is also set in this track with the same value.
+         */
+        bool includes(const TrackDataType &other) const;
+
         qulonglong databaseId() const
         {
-            return operator[](key_type::DatabaseIdRole).toULongLong();
+            return d ? d->mDatabaseId : 0;
+        }
+
+        void setDatabaseId(qulonglong value)
+        {
+            auto &data = writableData(DatabaseIdRole);
+            data.mDatabaseId = value;
         }
 
         QString title() const
         {
-            return operator[](key_type::TitleRole).toString();
+            return d ? d->mTitle : QString();
+        }
+
+        void setTitle(const QString &value)
+        {
+            auto &data = writableData(TitleRole);
+            data.mTitle = value;
         }
 
         QString artist() const
         {
-            return operator[](key_type::ArtistRole).toString();
+            return d ? d->mArtist : QString();
+        }
+
+        void setArtist(const QString &value)
+        {
+            auto &data = writableData(ArtistRole);
+            data.mArtist = value;
         }
 
         qulonglong albumId() const
         {
-            return operator[](key_type::AlbumIdRole).toULongLong();
+            return d ? d->mAlbumId : 0;
+        }
+
+        void setAlbumId(qulonglong value)
+        {
+            auto &data = writableData(AlbumIdRole);
+            data.mAlbumId = value;
         }
 
         QString album() const
         {
-            return operator[](key_type::AlbumRole).toString();
+            return d ? d->mAlbum : QString();
+        }
+
+        void setAlbum(const QString &value)
+        {
+            auto &data = writableData(AlbumRole);
+            data.mAlbum = value;
         }
 
         QString albumArtist() const
         {
-            return operator[](key_type::AlbumArtistRole).toString();
+            return d ? d->mAlbumArtist : QString();
+        }
+
+        void setAlbumArtist(const QString &value)
+        {
+            auto &data = writableData(AlbumArtistRole);
+            data.mAlbumArtist = value;
         }
 
         int trackNumber() const
         {
-            return operator[](key_type::TrackNumberRole).toInt();
+            return d ? d->mTrackNumber : 0;
+        }
+
+        void setTrackNumber(int value)
+        {
+            auto &data = writableData(TrackNumberRole);
+            data.mTrackNumber = value;
         }
 
         int discNumber() const
         {
-            return operator[](key_type::DiscNumberRole).toInt();
+            return d ? d->mDiscNumber : 0;
+        }
+
+        void setDiscNumber(int value)
+        {
+            auto &data = writableData(DiscNumberRole);
+            data.mDiscNumber = value;
         }
 
         QTime duration() const
         {
-            return operator[](key_type::DurationRole).toTime();
+            return d ? d->mDuration : QTime();
+        }
+
+        void setDuration(const QTime &value)
+        {
+            auto &data = writableData(DurationRole);
+            data.mDuration = value;
         }
 
         QUrl resourceURI() const
         {
-            return operator[](key_type::ResourceRole).toUrl();
+            return d ? d->mResourceURI : QUrl();
+        }
+
+        void setResourceURI(const QUrl &value)
+        {
+            auto &data = writableData(ResourceRole);
+            data.mResourceURI = value;
         }
 
         QUrl albumCover() const
         {
-            return operator[](key_type::ImageUrlRole).toUrl();
+            return d ? d->mAlbumCover : QUrl();
+        }
+
+        void setAlbumCover(const QUrl &value)
+        {
+            auto &data = writableData(ImageUrlRole);
+            data.mAlbumCover = value;
         }
 
         bool isSingleDiscAlbum() const
         {
-            return operator[](key_type::IsSingleDiscAlbumRole).toBool();
+            return d ? d->mIsSingleDiscAlbum : false;
+        }
+
+        void setIsSingleDiscAlbum(bool value)
+        {
+            auto &data = writableData(IsSingleDiscAlbumRole);
+            data.mIsSingleDiscAlbum = value;
         }
 
         int rating() const
         {
-            return operator[](key_type::RatingRole).toInt();
+            return d ? d->mRating : 0;
+        }
+
+        void setRating(int value)
+        {
+            auto &data = writableData(RatingRole);
+            data.mRating = value;
         }
 
         QString genre() const
         {
-            return operator[](key_type::GenreRole).toString();
+            return d ? d->mGenre : QString();
+        }
+
+        void setGenre(const QString &value)
+        {
+            auto &data = writableData(GenreRole);
+            data.mGenre = value;
         }
 
         QString composer() const
         {
-            return operator[](key_type::ComposerRole).toString();
+            return d ? d->mComposer : QString();
+        }
+
+        void setComposer(const QString &value)
+        {
+            auto &data = writableData(ComposerRole);
+            data.mComposer = value;
         }
 
         QString lyricist() const
         {
-            return operator[](key_type::LyricistRole).toString();
+            return d ? d->mLyricist : QString();
+        }
+
+        void setLyricist(const QString &value)
+        {
+            auto &data = writableData(LyricistRole);
+            data.mLyricist = value;
         }
 
         QString lyrics() const
         {
-            return operator[](key_type::LyricsRole).toString();
+            return d ? d->mLyrics : QString();
+        }
+
+        void setLyrics(const QString &value)
+        {
+            auto &data = writableData(LyricsRole);
+            data.mLyrics = value;
         }
 
         QString comment() const
         {
-            return operator[](key_type::CommentRole).toString();
+            return d ? d->mComment : QString();
+        }
+
+        void setComment(const QString &value)
+        {
+            auto &data = writableData(CommentRole);
+            data.mComment = value;
         }
 
         int year() const
         {
-            return operator[](key_type::YearRole).toInt();
+            return d ? d->mYear : 0;
+        }
+
+        void setYear(int value)
+        {
+            auto &data = writableData(YearRole);
+            data.mYear = value;
         }
 
         int channels() const
         {
-            return operator[](key_type::ChannelsRole).toInt();
+            return d ? d->mChannels : 0;
+        }
+
+        void setChannels(int value)
+        {
+            auto &data = writableData(ChannelsRole);
+            data.mChannels = value;
         }
 
         int bitRate() const
         {
-            return operator[](key_type::BitRateRole).toInt();
+            return d ? d->mBitRate : 0;
+        }
+
+        void setBitRate(int value)
+        {
+            auto &data = writableData(BitRateRole);
+            data.mBitRate = value;
         }
 
         int sampleRate() const
         {
-            return operator[](key_type::SampleRateRole).toInt();
+            return d ? d->mSampleRate : 0;
+        }
+
+        void setSampleRate(int value)
+        {
+            auto &data = writableData(SampleRateRole);
+            data.mSampleRate = value;
         }
 
         bool hasEmbeddedCover() const
         {
-            return operator[](key_type::HasEmbeddedCover).toBool();
+            return d ? d->mHasEmbeddedCover : false;
+        }
+
+        void setHasEmbeddedCover(bool value)
+        {
+            auto &data = writableData(HasEmbeddedCover);
+            data.mHasEmbeddedCover = value;
         }
 
         QDateTime fileModificationTime() const
         {
-            return operator[](key_type::FileModificationTime).toDateTime();
+            return d ? d->mFileModificationTime : QDateTime();
+        }
+
+        void setFileModificationTime(const QDateTime &value)
+        {
+            auto &data = writableData(FileModificationTime);
+            data.mFileModificationTime = value;
+        }
+
+        QDateTime firstPlayDate() const
+        {
+            return d ? d->mFirstPlayDate : QDateTime();
+        }
+
+        void setFirstPlayDate(const QDateTime &value)
+        {
+            auto &data = writableData(FirstPlayDate);
+            data.mFirstPlayDate = value;
+        }
+
+        QDateTime lastPlayDate() const
+        {
+            return d ? d->mLastPlayDate : QDateTime();
+        }
+
+        void setLastPlayDate(const QDateTime &value)
+        {
+            auto &data = writableData(LastPlayDate);
+            data.mLastPlayDate = value;
+        }
+
+        int playCounter() const
+        {
+            return d ? d->mPlayCounter : 0;
+        }
+
+        void setPlayCounter(int value)
+        {
+            auto &data = writableData(PlayCounter);
+            data.mPlayCounter = value;
+        }
+
+        double playFrequency() const
+        {
+            return d ? d->mPlayFrequency : 0.;
+        }
+
+        void setPlayFrequency(double value)
+        {
+            auto &data = writableData(PlayFrequency);
+            data.mPlayFrequency = value;
+        }
+
+        ElisaUtils::PlayListEntryType elementType() const
+        {
+            return d ? d->mElementType : ElisaUtils::Unknown;
+        }
+
+        void setElementType(ElisaUtils::PlayListEntryType value)
+        {
+            auto &data = writableData(ElementTypeRole);
+            data.mElementType = value;
+        }
+
+    private:
+
+        class TrackData : public QSharedData
+        {
+        public:
+
+            quint64 mFields = 0;
+
+            qulonglong mDatabaseId = 0;
+
+            qulonglong mAlbumId = 0;
+
+            QString mTitle;
+
+            QString mArtist;
+
+            QString mAlbum;
+
+            QString mAlbumArtist;
+
+            QString mGenre;
+
+            QString mComposer;
+
+            QString mLyricist;
+
+            QString mLyrics;
+
+            QString mComment;
+
+            QUrl mResourceURI;
+
+            QUrl mAlbumCover;
+
+            QTime mDuration;
+
+            QDateTime mFileModificationTime;
+
+            QDateTime mFirstPlayDate;
+
+            QDateTime mLastPlayDate;
+
+            double mPlayFrequency = 0.;
+
+            int mTrackNumber = 0;
+
+            int mDiscNumber = 0;
+
+            int mRating = 0;
+
+            int mYear = 0;
+
+            int mChannels = 0;
+
+            int mBitRate = 0;
+
+            int mSampleRate = 0;
+
+            int mPlayCounter = 0;
+
+            ElisaUtils::PlayListEntryType mElementType = ElisaUtils::Unknown;
+
+            bool mIsSingleDiscAlbum = false;
+
+            bool mHasEmbeddedCover = false;
+
+        };
+
+        static quint64 fieldFlag(key_type key)
+        {
+            return quint64(1) << (key - TitleRole);
         }
+
+        bool hasField(key_type key) const
+        {
+            return d && (d->mFields & fieldFlag(key));
+        }
+
+        TrackData& writableData(key_type key)
+        {
+            if (!d) {
+                d = new TrackData;
+            }
+            d->mFields |= fieldFlag(key);
+            return *d;
+        }
+
+        QSharedDataPointer<TrackData> d;
+
     };
 
     using ListTrackDataType = QList<TrackDataType>;
@@ -292,6 +643,11 @@ public:
             return operator[](key_type::DatabaseIdRole).toULongLong();
         }
 
+        QString title() const
+        {
+            return operator[](key_type::TitleRole).toString();
+        }
+
     };
 
     using ListArtistDataType = QList<ArtistDataType>;
@@ -316,6 +672,20 @@ public:
 
     using ListGenreDataType = QList<GenreDataType>;
 
+    class DirectoryDataType
+    {
+    public:
+
+        QDateTime mModifiedTime;
+
+        int mEntriesCount = 0;
+
+        QString mMountPoint;
+
+    };
+
+    using DirectoriesDataType = QHash<QUrl, DirectoryDataType>;
+
     enum PropertyType {
         DatabaseId,
         DisplayRole,
@@ -337,16 +707,34 @@ public:
 
     Q_INVOKABLE void init(const QString &dbName, const QString &databaseFileName = {});
 
+    /**
+     * Open a read-only connection to a database already initialized by
+     * another DatabaseInterface using init(). Only the read accessors may
+     * be used on such an instance.
+     */
+    Q_INVOKABLE void initReadOnly(const QString &dbName, const QString &databaseFileName);
+
+    /**
+     * Read the play statistics not yet written by the writer instance so
+     * that the recently and frequently played views include them. Must be
+     * called before this instance is used from another thread.
+     */
+    void sharePlayStatisticsJournal(const DatabaseInterface &writer);
+
     qulonglong albumIdFromTitleAndArtist(const QString &title, const QString &artist);
 
     ListTrackDataType allTracksData();
 
+    ListTrackDataType tracksDataPage(const QString &afterTitle, qulonglong afterDatabaseId, int count);
+
     ListTrackDataType recentlyPlayedTracksData(int count);
 
     ListTrackDataType frequentlyPlayedTracksData(int count);
 
     ListAlbumDataType allAlbumsData();
 
+    ListAlbumDataType albumsDataPage(const QString &afterTitle, qulonglong afterDatabaseId, int count);
+
     ListAlbumDataType allAlbumsDataByGenreAndArtist(const QString &genre, const QString &artist);
 
     ListAlbumDataType allAlbumsDataByArtist(const QString &artist);
@@ -357,16 +745,32 @@ public:
 
     ListArtistDataType allArtistsData();
 
+    ListArtistDataType artistsDataPage(const QString &afterName, qulonglong afterDatabaseId, int count);
+
     ListArtistDataType allArtistsDataByGenre(const QString &genre);
 
     ListGenreDataType allGenresData();
 
+    bool hasSearchIndex() const;
+
+    QList<qulonglong> searchTracks(const QString &filterText);
+
+    QList<qulonglong> searchAlbums(const QString &filterText);
+
+    QList<qulonglong> searchArtists(const QString &filterText);
+
     bool internalArtistMatchGenre(qulonglong databaseId, const QString &genre);
 
     ListTrackDataType tracksDataFromAuthor(const QString &artistName);
 
     TrackDataType trackDataFromDatabaseId(qulonglong id);
 
+    /**
+     * Read the lyrics captured when the track was imported. Returns false when
+     * nothing is stored or the file has been modified since.
+     */
+    bool trackLyricsFromDatabaseId(qulonglong id, QString &lyrics);
+
     qulonglong trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const QString &album,
                                                     int trackNumber, int discNumber);
 
@@ -374,6 +778,28 @@ public:
 
     void applicationAboutToQuit();
 
+    /**
+     * Statements slower than this threshold are logged with their bound
+     * values and query plan when org.kde.elisa.database.profiler is enabled.
+     */
+    static void setSlowQueryThreshold(int milliseconds);
+
+    QStringList statementStatistics() const;
+
+    Q_INVOKABLE void dumpStatementStatistics() const;
+
+    /**
+     * Counter increased by every change of the collection content. Play statistics do not
+     * change it. It is stored in the database and used to validate the collection snapshot.
+     */
+    qulonglong collectionGeneration() const;
+
+    /**
+     * Random identifier created with the database, so that a snapshot of a deleted database
+     * is not mistaken for one of its replacement.
+     */
+    QString collectionIdentity() const;
+
 Q_SIGNALS:
 
     void artistsAdded(const DatabaseInterface::ListArtistDataType &newArtists);
@@ -388,20 +814,24 @@ Q_SIGNALS:
 
     void genresAdded(const DatabaseInterface::ListGenreDataType &allGenres);
 
-    void artistRemoved(qulonglong removedArtistId);
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
 
-    void albumRemoved(qulonglong removedAlbumId);
+    void artistsRemoved(const QList<qulonglong> &removedArtistsIds);
 
-    void trackRemoved(qulonglong id);
+    void albumsRemoved(const QList<qulonglong> &removedAlbumsIds);
 
     void albumModified(const DatabaseInterface::AlbumDataType &modifiedAlbum, qulonglong modifiedAlbumId);
 
     void trackModified(const DatabaseInterface::TrackDataType &modifiedTrack);
 
+    void tracksModified(const DatabaseInterface::ListTrackDataType &modifiedTracks);
+
     void requestsInitDone();
 
     void databaseError();
 
+    void restoredDirectories(const DatabaseInterface::DirectoriesDataType &allDirectories);
+
     void restoredTracks(QHash<QUrl, QDateTime> allFiles);
 
     void cleanedDatabase();
@@ -416,10 +846,40 @@ public Q_SLOTS:
 
     void removeTracksList(const QList<QUrl> &removedTracks);
 
+    /**
+     * Hide tracks whose root path is temporarily unreachable (e.g. an unmounted share)
+     * without forgetting their metadata.
+     */
+    void setTracksOffline(const QList<QUrl> &offlineTracks);
+
+    /**
+     * Show again the offline tracks stored below rootPath.
+     */
+    void setDirectoryOnline(const QUrl &rootPath);
+
+    void writeCollectionSnapshot(const QString &fileName);
+
+    /**
+     * Store pre-rendered thumbnails of album covers in packFileName. Albums imported
+     * later are processed in small batches once insertTracksList has finished.
+     */
+    void initAlbumArtStore(const QString &packFileName);
+
+    void generateAlbumArt();
+
     void askRestoredTracks();
 
+    void updateDirectoriesIndex(const DatabaseInterface::DirectoriesDataType &indexedDirectories,
+                                const QList<QUrl> &removedDirectories);
+
     void trackHasStartedPlaying(const QUrl &fileName, const QDateTime &time);
 
+    /**
+     * Write the play statistics accumulated by trackHasStartedPlaying.
+     * This also happens on a timer and at the start of the next import.
+     */
+    void flushPlayStatistics();
+
     void clearData();
 
 private:
@@ -431,10 +891,35 @@ private:
 
     void initChangesTrackers();
 
+    void startBulkInsert(const QList<MusicAudioTrack> &tracks);
+
+    void finishBulkInsert(bool notifyInsertedNames);
+
+    void prefetchNamesIds(const QString &tableName, const QSet<QString> &names, QHash<QString, qulonglong> &namesIds);
+
+    void insertMissingNames(const QString &tableName, const QSet<QString> &names, QHash<QString, qulonglong> &namesIds,
+                            qulonglong &nextId, QSet<qulonglong> &insertedIds);
+
     void recordModifiedTrack(qulonglong trackId);
 
     void recordModifiedAlbum(qulonglong albumId);
 
+    void refreshAlbumSummaries();
+
+    void resetAlbumArt(const QSet<qulonglong> &albumIds);
+
+    void storeAlbumArt(int generation, const QList<qulonglong> &albumIds, const QList<QString> &coverCacheKeys);
+
+    void compactAlbumArt();
+
+    void refreshSearchIndex();
+
+    void readCollectionGeneration();
+
+    void increaseCollectionGeneration();
+
+    QList<qulonglong> internalSearch(QSqlQuery &searchQuery, const QString &matchExpression);
+
     bool startTransaction() const;
 
     bool finishTransaction() const;
@@ -454,6 +939,14 @@ private:
                                                                 const QString &albumArtist, const QString &trackPath, int trackNumber,
                                                                 int discNumber, int priority);
 
+    qulonglong internalAlbumIdFromTrackFileName(const QUrl &fileName);
+
+    QList<qulonglong> internalArtistIdsFromTrackId(qulonglong trackId);
+
+    bool internalAlbumHasOnlineTracks(qulonglong albumId);
+
+    bool internalArtistHasOnlineTracks(qulonglong artistId);
+
     qulonglong internalTrackIdFromFileName(const QUrl &fileName);
 
     ListTrackDataType internalTracksFromAuthor(const QString &artistName);
@@ -464,6 +957,8 @@ private:
 
     void initRequest();
 
+    void initSearchRequest();
+
     qulonglong insertAlbum(const QString &title, const QString &albumArtist, const QString &trackArtist,
                            const QString &trackPath, const QUrl &albumArtURI);
 
@@ -482,10 +977,14 @@ private:
 
     void removeAlbumInDatabase(qulonglong albumId);
 
-    void removeArtistInDatabase(qulonglong artistId);
+    void removeArtistInDatabase(qulonglong artistId, const QString &artistName);
 
     void reloadExistingDatabase();
 
+    void loadNameDictionaries();
+
+    bool loadNameDictionary(const QString &tableName, QHash<QString, qulonglong> &namesIds);
+
     qulonglong initialId(DataUtils::DataType aType);
 
     qulonglong genericInitialId(QSqlQuery &request);
@@ -494,6 +993,8 @@ private:
 
     void updateTrackOrigin(const QUrl &fileName, const QDateTime &fileModifiedTime);
 
+    void updateTrackLyrics(const MusicAudioTrack &oneTrack);
+
     qulonglong internalInsertTrack(const MusicAudioTrack &oneModifiedTrack,
                                    const QHash<QString, QUrl> &covers, bool &isInserted);
 
@@ -503,6 +1004,10 @@ private:
 
     void internalRemoveTracksList(const QList<QUrl> &removedTracks);
 
+    void internalBulkRemoveTracksList(const QList<QUrl> &removedTracks);
+
+    bool execBulkRemovalQuery(QSqlQuery &query, const QString &queryText);
+
     void internalRemoveTracksList(const QHash<QUrl, QDateTime> &removedTracks, qulonglong sourceId);
 
     QUrl internalAlbumArtUriFromAlbumId(qulonglong albumId);
@@ -515,6 +1020,10 @@ private:
 
     QHash<QUrl, QDateTime> internalAllFileName();
 
+    DirectoriesDataType internalAllDirectories();
+
+    void internalRemoveDirectory(const QUrl &directory);
+
     bool internalGenericPartialData(QSqlQuery &query);
 
     ListArtistDataType internalAllArtistsPartialData(QSqlQuery &artistsQuery);
@@ -523,7 +1032,7 @@ private:
 
     AlbumDataType internalOneAlbumPartialData(qulonglong databaseId);
 
-    ListTrackDataType internalAllTracksPartialData();
+    ListTrackDataType internalAllTracksPartialData(QSqlQuery &query);
 
     ListTrackDataType internalRecentlyPlayedTracksData(int count);
 
@@ -531,6 +1040,8 @@ private:
 
     TrackDataType internalOneTrackPartialData(qulonglong databaseId);
 
+    ListTrackDataType internalTracksPartialData(const QList<qulonglong> &databaseIds);
+
     ListGenreDataType internalAllGenresPartialData();
 
     ListArtistDataType internalAllComposersPartialData();
@@ -541,10 +1052,18 @@ private:
 
     bool execQuery(QSqlQuery &query);
 
+    void logSlowQuery(const QSqlQuery &query, qint64 elapsed);
+
+    void recordTransactionDuration() const;
+
     void updateAlbumArtist(qulonglong albumId, const QString &title, const QString &albumPath,
                            const QString &artistName);
 
-    void updateTrackStatistics(const QUrl &fileName, const QDateTime &time);
+    void updateTrackStatistics(const QUrl &fileName, const PendingPlayStatistics &statistics);
+
+    void internalFlushPlayStatistics();
+
+    void mergePendingPlayStatistics(ListTrackDataType &tracks, int count, bool sortByPlayCount);
 
     void createDatabaseV9();
 
@@ -556,6 +1075,24 @@ private:
 
     void upgradeDatabaseV13();
 
+    void upgradeDatabaseV14();
+
+    void upgradeDatabaseV15();
+
+    void upgradeDatabaseV16();
+
+    void upgradeDatabaseV17();
+
+    void upgradeDatabaseV18();
+
+    void upgradeDatabaseV19();
+
+    void upgradeDatabaseV20();
+
+    void upgradeDatabaseV21();
+
+    void upgradeDatabaseV22();
+
     void checkDatabaseSchema();
 
     void checkAlbumsTableSchema();
@@ -572,14 +1109,24 @@ private:
 
     void checkTracksDataTableSchema();
 
+    void checkDirectoriesDataTableSchema();
+
+    void checkAlbumSummaryTableSchema();
+
+    void checkTracksLyricsTableSchema();
+
     void genericCheckTable(const QString &tableName, const QStringList &expectedColumns);
 
     void resetDatabase();
 
     std::unique_ptr<DatabaseInterfacePrivate> d;
 
+    std::shared_ptr<PlayStatisticsJournal> mPlayStatisticsJournal;
+
 };
 
+Q_DECLARE_TYPEINFO(DatabaseInterface::TrackDataType, Q_MOVABLE_TYPE);
+
 Q_DECLARE_METATYPE(DatabaseInterface::TrackDataType)
 Q_DECLARE_METATYPE(DatabaseInterface::AlbumDataType)
 Q_DECLARE_METATYPE(DatabaseInterface::ArtistDataType)
@@ -590,4 +1137,6 @@ Q_DECLARE_METATYPE(DatabaseInterface::ListAlbumDataType)
 Q_DECLARE_METATYPE(DatabaseInterface::ListArtistDataType)
 Q_DECLARE_METATYPE(DatabaseInterface::ListGenreDataType)
 
+Q_DECLARE_METATYPE(DatabaseInterface::DirectoriesDataType)
+
 #endif // DATABASEINTERFACE_H
@@ -24,6 +24,7 @@
 
 #include <QCoreApplication>
 #include <QCommandLineParser>
+#include <QLoggingCategory>
 #include <QtGlobal>
 #include <QStandardPaths>
 
@@ -36,6 +37,7 @@ int main(int argc, char *argv[])
     qRegisterMetaType<QList<MusicAudioTrack>>("QVector<MusicAudioTrack>");
     qRegisterMetaType<QVector<qulonglong>>("QVector<qulonglong>");
     qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
+    qRegisterMetaType<DatabaseInterface::DirectoriesDataType>("DatabaseInterface::DirectoriesDataType");
     qRegisterMetaType<QMap<QString, int>>();
     qRegisterMetaType<NotificationItem>("NotificationItem");
     qRegisterMetaType<QMap<QString,int>>("QMap<QString,int>");
@@ -43,8 +45,26 @@ int main(int argc, char *argv[])
     QCommandLineParser parser;
     parser.addHelpOption();
     parser.addVersionOption();
+
+    QCommandLineOption statisticsOption(QStringLiteral("database-statistics"),
+                                        QStringLiteral("Print per statement database statistics when indexing is finished."));
+    parser.addOption(statisticsOption);
+
+    QCommandLineOption slowQueryOption(QStringLiteral("slow-query-threshold"),
+                                       QStringLiteral("Log database statements slower than <milliseconds> with their query plan."),
+                                       QStringLiteral("milliseconds"));
+    parser.addOption(slowQueryOption);
+
     parser.process(app);
 
+    if (parser.isSet(statisticsOption) || parser.isSet(slowQueryOption)) {
+        QLoggingCategory::setFilterRules(QStringLiteral("org.kde.elisa.database.profiler.debug=true"));
+    }
+
+    if (parser.isSet(slowQueryOption)) {
+        DatabaseInterface::setSlowQueryThreshold(parser.value(slowQueryOption).toInt());
+    }
+
     auto configurationFileName = QStandardPaths::writableLocation(QStandardPaths::ConfigLocation);
     configurationFileName += QStringLiteral("/elisarc");
     Elisa::ElisaConfiguration::instance(configurationFileName);
@@ -57,6 +57,8 @@
 #include "embeddedcoverageimageprovider.h"
 #endif
 
+#include "albumartimageprovider.h"
+
 #if defined KF5KIO_FOUND && KF5KIO_FOUND
 #include "models/filebrowsermodel.h"
 #include "models/filebrowserproxymodel.h"
@@ -88,6 +90,7 @@ void ElisaQmlTestPlugin::initializeEngine(QQmlEngine *engine, const char *uri)
 #if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
     engine->addImageProvider(QStringLiteral("cover"), new EmbeddedCoverageImageProvider);
 #endif
+    engine->addImageProvider(QStringLiteral("albumart"), new AlbumArtImageProvider);
 }
 
 void ElisaQmlTestPlugin::registerTypes(const char *uri)
@@ -156,6 +159,7 @@ void ElisaQmlTestPlugin::registerTypes(const char *uri)
     qRegisterMetaType<DatabaseInterface::ListAlbumDataType>("DatabaseInterface::ListAlbumDataType");
     qRegisterMetaType<DatabaseInterface::ListArtistDataType>("DatabaseInterface::ListArtistDataType");
     qRegisterMetaType<DatabaseInterface::ListGenreDataType>("DatabaseInterface::ListGenreDataType");
+    qRegisterMetaType<DatabaseInterface::DirectoriesDataType>("DatabaseInterface::DirectoriesDataType");
     qRegisterMetaType<ModelDataLoader::ListTrackDataType>("ModelDataLoader::ListTrackDataType");
     qRegisterMetaType<ModelDataLoader::ListAlbumDataType>("ModelDataLoader::ListAlbumDataType");
     qRegisterMetaType<ModelDataLoader::ListArtistDataType>("ModelDataLoader::ListArtistDataType");
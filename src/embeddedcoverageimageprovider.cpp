@@ -17,15 +17,23 @@
 
 #include "embeddedcoverageimageprovider.h"
 
+#include "embeddedcovercache.h"
+
 #include <KFileMetaData/EmbeddedImageData>
 #include <QUrl>
 #include <QImage>
+#include <QImageReader>
+#include <QBuffer>
+#include <QFileInfo>
+#include <QDateTime>
+
+#include <utility>
 
 class AsyncImageResponse : public QQuickImageResponse, public QRunnable
 {
 public:
-    AsyncImageResponse(QString id, QSize requestedSize)
-        : mId(std::move(id)), mRequestedSize(requestedSize)
+    AsyncImageResponse(QString id, QSize requestedSize, EmbeddedCoverCache *cache)
+        : mId(std::move(id)), mRequestedSize(requestedSize), mCache(cache)
     {
         setAutoDelete(false);
     }
@@ -36,31 +44,75 @@ public:
     }
 
     void run() override
+    {
+        const auto bucket = EmbeddedCoverCache::sizeBucket(mRequestedSize);
+        const auto &modificationTime = QFileInfo(mId).lastModified();
+
+        mCoverImage = mCache->memoryLookup(mId, modificationTime, bucket);
+
+        if (mCoverImage.isNull()) {
+            mCoverImage = mCache->diskLookup(mId, modificationTime, bucket);
+
+            if (mCoverImage.isNull()) {
+                mCoverImage = extractCover(bucket);
+
+                if (!mCoverImage.isNull()) {
+                    mCache->diskInsert(mId, modificationTime, bucket, mCoverImage);
+                }
+            }
+
+            if (!mCoverImage.isNull()) {
+                mCache->memoryInsert(mId, modificationTime, bucket, mCoverImage);
+            }
+        }
+
+        emit finished();
+    }
+
+    QImage extractCover(int bucket) const
     {
         KFileMetaData::EmbeddedImageData embeddedImage;
 
         auto imageData = embeddedImage.imageData(mId);
 
-        if (imageData.contains(KFileMetaData::EmbeddedImageData::FrontCover)) {
-            mCoverImage = QImage::fromData(imageData[KFileMetaData::EmbeddedImageData::FrontCover]);
+        if (!imageData.contains(KFileMetaData::EmbeddedImageData::FrontCover)) {
+            return {};
         }
 
-        emit finished();
+        auto coverData = imageData[KFileMetaData::EmbeddedImageData::FrontCover];
+        QBuffer coverBuffer(&coverData);
+        coverBuffer.open(QIODevice::ReadOnly);
+
+        QImageReader coverReader(&coverBuffer);
+
+        // let the decoder scale down (JPEG can skip most of the work) instead of decoding the full image
+        const auto &fullSize = coverReader.size();
+        if (bucket > 0 && fullSize.isValid() && (fullSize.width() > bucket || fullSize.height() > bucket)) {
+            coverReader.setScaledSize(fullSize.scaled(bucket, bucket, Qt::KeepAspectRatio));
+        }
+
+        return coverReader.read();
     }
 
     QString mId;
     QSize mRequestedSize;
+    EmbeddedCoverCache *mCache = nullptr;
     QImage mCoverImage;
 };
 
 EmbeddedCoverageImageProvider::EmbeddedCoverageImageProvider()
-    : QQuickAsyncImageProvider()
+    : QQuickAsyncImageProvider(), cache(std::make_unique<EmbeddedCoverCache>())
+{
+}
+
+EmbeddedCoverageImageProvider::~EmbeddedCoverageImageProvider()
 {
+    pool.waitForDone();
 }
 
 QQuickImageResponse *EmbeddedCoverageImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
 {
-    auto response = std::make_unique<AsyncImageResponse>(id, requestedSize);
+    auto response = std::make_unique<AsyncImageResponse>(id, requestedSize, cache.get());
     pool.start(response.get());
     return response.release();
 }
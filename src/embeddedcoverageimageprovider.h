@@ -21,16 +21,25 @@
 #include <QQuickAsyncImageProvider>
 #include <QThreadPool>
 
+#include <memory>
+
+class EmbeddedCoverCache;
+
 class EmbeddedCoverageImageProvider : public QQuickAsyncImageProvider
 {
 public:
 
     EmbeddedCoverageImageProvider();
 
+    ~EmbeddedCoverageImageProvider() override;
+
     QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
 
 private:
 
+    // declared before the pool so that running responses never outlive it
+    std::unique_ptr<EmbeddedCoverCache> cache;
+
     QThreadPool pool;
 
 };
@@ -0,0 +1,363 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "embeddedcovercache.h"
+
+#include <QCache>
+#include <QHash>
+#include <QVector>
+#include <QPair>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QSaveFile>
+#include <QImageReader>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+
+#include <algorithm>
+
+namespace {
+
+const auto sourceFileName = QStringLiteral("source");
+
+}
+
+class EmbeddedCoverCachePrivate
+{
+public:
+
+    class DiskEntry
+    {
+    public:
+
+        qint64 mSize = 0;
+
+        qint64 mLastAccess = 0;
+
+    };
+
+    EmbeddedCoverCachePrivate(QString cacheDirectory, qint64 maximumDiskBytes)
+        : mCacheDirectory(std::move(cacheDirectory)), mMaximumDiskBytes(maximumDiskBytes)
+    {
+        if (!mCacheDirectory.endsWith(QLatin1Char('/'))) {
+            mCacheDirectory += QLatin1Char('/');
+        }
+    }
+
+    static QString sourceDirectoryName(const QString &fileName)
+    {
+        return QString::fromLatin1(QCryptographicHash::hash(fileName.toUtf8(), QCryptographicHash::Sha1).toHex());
+    }
+
+    static QString entryName(int bucket, qint64 modificationTime)
+    {
+        return QString::number(bucket) + QLatin1Char('-') + QString::number(modificationTime);
+    }
+
+    static qint64 entryModificationTime(const QString &entryName)
+    {
+        return entryName.midRef(entryName.indexOf(QLatin1Char('-')) + 1).toLongLong();
+    }
+
+    QString entryPath(const QString &fileName, const QDateTime &modificationTime, int bucket) const
+    {
+        return sourceDirectoryName(fileName) + QLatin1Char('/') + entryName(bucket, modificationTime.toMSecsSinceEpoch());
+    }
+
+    qint64 nextAccess()
+    {
+        mLastAccess = std::max(mLastAccess + 1, QDateTime::currentMSecsSinceEpoch());
+
+        return mLastAccess;
+    }
+
+    void loadDiskIndex();
+
+    void removeDiskEntry(const QString &entryPath);
+
+    void evictDiskEntries();
+
+    QString mCacheDirectory;
+
+    qint64 mMaximumDiskBytes = 0;
+
+    QMutex mMemoryMutex;
+
+    QCache<QString, QImage> mMemoryCache;
+
+    QMutex mDiskMutex;
+
+    bool mIsDiskIndexLoaded = false;
+
+    QHash<QString, DiskEntry> mDiskEntries;
+
+    qint64 mDiskSize = 0;
+
+    qint64 mLastAccess = 0;
+
+};
+
+void EmbeddedCoverCachePrivate::loadDiskIndex()
+{
+    if (mIsDiskIndexLoaded) {
+        return;
+    }
+
+    mIsDiskIndexLoaded = true;
+
+    const auto &allSourceDirectories = QDir(mCacheDirectory).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
+
+    for (const auto &oneSourceDirectory : allSourceDirectories) {
+        QDir sourceDirectory(oneSourceDirectory.absoluteFilePath());
+
+        QFile sourceFile(sourceDirectory.filePath(sourceFileName));
+        const auto &audioFileName = sourceFile.open(QIODevice::ReadOnly) ? QString::fromUtf8(sourceFile.readAll()) : QString();
+        sourceFile.close();
+
+        // also drops the directories of older layouts
+        const QFileInfo audioFileInfo(audioFileName);
+        if (audioFileName.isEmpty() || sourceDirectoryName(audioFileName) != oneSourceDirectory.fileName() || !audioFileInfo.exists()) {
+            sourceDirectory.removeRecursively();
+            continue;
+        }
+
+        const auto modificationTime = audioFileInfo.lastModified().toMSecsSinceEpoch();
+        auto hasEntries = false;
+
+        const auto &allEntries = sourceDirectory.entryInfoList(QDir::Files);
+        for (const auto &oneEntry : allEntries) {
+            if (oneEntry.fileName() == sourceFileName) {
+                continue;
+            }
+
+            if (entryModificationTime(oneEntry.fileName()) != modificationTime) {
+                QFile::remove(oneEntry.absoluteFilePath());
+                continue;
+            }
+
+            const auto lastAccess = oneEntry.lastModified().toMSecsSinceEpoch();
+            mDiskEntries[oneSourceDirectory.fileName() + QLatin1Char('/') + oneEntry.fileName()] = {oneEntry.size(), lastAccess};
+            mDiskSize += oneEntry.size();
+            mLastAccess = std::max(mLastAccess, lastAccess);
+            hasEntries = true;
+        }
+
+        if (!hasEntries) {
+            sourceDirectory.removeRecursively();
+        }
+    }
+
+    evictDiskEntries();
+}
+
+void EmbeddedCoverCachePrivate::removeDiskEntry(const QString &entryPath)
+{
+    const auto itEntry = mDiskEntries.find(entryPath);
+    if (itEntry != mDiskEntries.end()) {
+        mDiskSize -= itEntry->mSize;
+        mDiskEntries.erase(itEntry);
+    }
+
+    QFile::remove(mCacheDirectory + entryPath);
+
+    QDir sourceDirectory(mCacheDirectory + entryPath.left(entryPath.indexOf(QLatin1Char('/'))));
+    if (sourceDirectory.entryList(QDir::Files) == QStringList{sourceFileName}) {
+        sourceDirectory.removeRecursively();
+    }
+}
+
+void EmbeddedCoverCachePrivate::evictDiskEntries()
+{
+    if (mDiskSize <= mMaximumDiskBytes) {
+        return;
+    }
+
+    auto allEntries = QVector<QPair<qint64, QString>>{};
+    allEntries.reserve(mDiskEntries.size());
+    for (auto itEntry = mDiskEntries.cbegin(); itEntry != mDiskEntries.cend(); ++itEntry) {
+        allEntries.push_back({itEntry->mLastAccess, itEntry.key()});
+    }
+
+    std::sort(allEntries.begin(), allEntries.end());
+
+    // leave some room so that the next inserts do not evict again
+    const auto targetSize = mMaximumDiskBytes - mMaximumDiskBytes / 10;
+
+    for (const auto &oneEntry : qAsConst(allEntries)) {
+        if (mDiskSize <= targetSize) {
+            break;
+        }
+
+        removeDiskEntry(oneEntry.second);
+    }
+}
+
+EmbeddedCoverCache::EmbeddedCoverCache(QString cacheDirectory, qint64 maximumDiskBytes)
+    : d(std::make_unique<EmbeddedCoverCachePrivate>(std::move(cacheDirectory), maximumDiskBytes))
+{
+    d->mMemoryCache.setMaxCost(MemoryCacheKiloBytes);
+}
+
+EmbeddedCoverCache::~EmbeddedCoverCache()
+= default;
+
+QString EmbeddedCoverCache::defaultCacheDirectory()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/embeddedCovers/");
+}
+
+int EmbeddedCoverCache::sizeBucket(const QSize &requestedSize)
+{
+    const auto requestedExtent = std::max(requestedSize.width(), requestedSize.height());
+
+    if (requestedExtent <= 0 || requestedExtent > LargestBucket) {
+        return 0;
+    }
+
+    auto bucket = SmallestBucket;
+    while (bucket < requestedExtent) {
+        bucket *= 2;
+    }
+
+    return bucket;
+}
+
+QImage EmbeddedCoverCache::memoryLookup(const QString &fileName, const QDateTime &modificationTime, int bucket)
+{
+    QMutexLocker lock(&d->mMemoryMutex);
+
+    auto *cachedImage = d->mMemoryCache.object(d->entryPath(fileName, modificationTime, bucket));
+
+    return cachedImage ? *cachedImage : QImage();
+}
+
+void EmbeddedCoverCache::memoryInsert(const QString &fileName, const QDateTime &modificationTime, int bucket, const QImage &image)
+{
+    QMutexLocker lock(&d->mMemoryMutex);
+
+    d->mMemoryCache.insert(d->entryPath(fileName, modificationTime, bucket), new QImage(image),
+                           std::max(1, int(image.sizeInBytes() / 1024)));
+}
+
+QImage EmbeddedCoverCache::diskLookup(const QString &fileName, const QDateTime &modificationTime, int bucket)
+{
+    const auto &entryPath = d->entryPath(fileName, modificationTime, bucket);
+
+    {
+        QMutexLocker lock(&d->mDiskMutex);
+
+        d->loadDiskIndex();
+
+        if (!d->mDiskEntries.contains(entryPath)) {
+            return {};
+        }
+    }
+
+    QImageReader cachedImageReader(d->mCacheDirectory + entryPath);
+    const auto &cachedImage = cachedImageReader.read();
+
+    QMutexLocker lock(&d->mDiskMutex);
+
+    if (cachedImage.isNull()) {
+        d->removeDiskEntry(entryPath);
+
+        return {};
+    }
+
+    const auto itEntry = d->mDiskEntries.find(entryPath);
+    if (itEntry != d->mDiskEntries.end()) {
+        itEntry->mLastAccess = d->nextAccess();
+
+        // the modification time keeps the order of use for the next sessions
+        QFile cachedImageFile(d->mCacheDirectory + entryPath);
+        if (cachedImageFile.open(QIODevice::ReadWrite)) {
+            cachedImageFile.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+        }
+    }
+
+    return cachedImage;
+}
+
+void EmbeddedCoverCache::diskInsert(const QString &fileName, const QDateTime &modificationTime, int bucket, const QImage &image)
+{
+    const auto &sourceDirectoryName = EmbeddedCoverCachePrivate::sourceDirectoryName(fileName);
+    const auto &entryPath = d->entryPath(fileName, modificationTime, bucket);
+
+    QMutexLocker lock(&d->mDiskMutex);
+
+    d->loadDiskIndex();
+
+    QDir sourceDirectory(d->mCacheDirectory + sourceDirectoryName);
+
+    // the thumbnails of a previous version of the file will never be used again
+    const auto &allEntries = sourceDirectory.entryList(QDir::Files);
+    for (const auto &oneEntry : allEntries) {
+        if (oneEntry != sourceFileName &&
+                EmbeddedCoverCachePrivate::entryModificationTime(oneEntry) != modificationTime.toMSecsSinceEpoch()) {
+            d->removeDiskEntry(sourceDirectoryName + QLatin1Char('/') + oneEntry);
+        }
+    }
+
+    if (!sourceDirectory.exists(sourceFileName)) {
+        QDir().mkpath(sourceDirectory.absolutePath());
+
+        QSaveFile sourceFile(sourceDirectory.filePath(sourceFileName));
+        if (!sourceFile.open(QIODevice::WriteOnly)) {
+            return;
+        }
+
+        sourceFile.write(fileName.toUtf8());
+        if (!sourceFile.commit()) {
+            return;
+        }
+    }
+
+    QSaveFile cachedImageFile(d->mCacheDirectory + entryPath);
+    if (!cachedImageFile.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    if (!image.save(&cachedImageFile, image.hasAlphaChannel() ? "PNG" : "JPG", 90)) {
+        cachedImageFile.cancelWriting();
+        return;
+    }
+
+    if (!cachedImageFile.commit()) {
+        return;
+    }
+
+    const auto entrySize = QFileInfo(d->mCacheDirectory + entryPath).size();
+
+    auto &diskEntry = d->mDiskEntries[entryPath];
+    d->mDiskSize += entrySize - diskEntry.mSize;
+    diskEntry.mSize = entrySize;
+    diskEntry.mLastAccess = d->nextAccess();
+
+    d->evictDiskEntries();
+}
+
+qint64 EmbeddedCoverCache::diskSize()
+{
+    QMutexLocker lock(&d->mDiskMutex);
+
+    d->loadDiskIndex();
+
+    return d->mDiskSize;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef EMBEDDEDCOVERCACHE_H
+#define EMBEDDEDCOVERCACHE_H
+
+#include "elisaLib_export.h"
+
+#include <QString>
+#include <QDateTime>
+#include <QImage>
+#include <QSize>
+
+#include <memory>
+
+class EmbeddedCoverCachePrivate;
+
+/**
+ * Thumbnails of embedded covers, kept in memory and on disk under one directory per
+ * audio file. An entry is keyed by the audio file, its modification time and a size
+ * bucket so that a retagged file gets a new thumbnail. Both levels drop the least
+ * recently used entries first. The disk level also drops the entries of files that
+ * have been removed or modified since they were stored. All methods are thread-safe.
+ */
+class ELISALIB_EXPORT EmbeddedCoverCache
+{
+
+public:
+
+    static constexpr int MemoryCacheKiloBytes = 64 * 1024;
+
+    static constexpr qint64 DiskCacheBytes = 256 * 1024 * 1024;
+
+    static constexpr int SmallestBucket = 32;
+
+    static constexpr int LargestBucket = 1024;
+
+    explicit EmbeddedCoverCache(QString cacheDirectory = defaultCacheDirectory(), qint64 maximumDiskBytes = DiskCacheBytes);
+
+    ~EmbeddedCoverCache();
+
+    static QString defaultCacheDirectory();
+
+    /**
+     * Covers are stored at the next power of two of the requested size, 0 being the full resolution.
+     */
+    static int sizeBucket(const QSize &requestedSize);
+
+    QImage memoryLookup(const QString &fileName, const QDateTime &modificationTime, int bucket);
+
+    void memoryInsert(const QString &fileName, const QDateTime &modificationTime, int bucket, const QImage &image);
+
+    QImage diskLookup(const QString &fileName, const QDateTime &modificationTime, int bucket);
+
+    void diskInsert(const QString &fileName, const QDateTime &modificationTime, int bucket, const QImage &image);
+
+    /**
+     * Total size of the thumbnails stored on disk. The first disk access prunes the
+     * entries left by removed or modified files.
+     */
+    qint64 diskSize();
+
+private:
+
+    std::unique_ptr<EmbeddedCoverCachePrivate> d;
+
+};
+
+#endif // EMBEDDEDCOVERCACHE_H
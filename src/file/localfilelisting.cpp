@@ -39,6 +39,7 @@ public:
 
 LocalFileListing::LocalFileListing(QObject *parent) : AbstractFileListing(parent), d(std::make_unique<LocalFileListingPrivate>())
 {
+    setParallelMetadataExtraction(true);
 }
 
 LocalFileListing::~LocalFileListing()
@@ -57,6 +58,10 @@ void LocalFileListing::triggerRefreshOfContent()
 
     const auto &rootPaths = allRootPaths();
     for (const auto &onePath : rootPaths) {
+        if (isRootPathOffline(onePath)) {
+            continue;
+        }
+
         scanDirectoryTree(onePath);
     }
 
@@ -26,6 +26,7 @@
 #include <KFileMetaData/SimpleExtractionResult>
 #include <KFileMetaData/UserMetaData>
 #include <KFileMetaData/Properties>
+#include <KFileMetaData/EmbeddedImageData>
 
 #if defined KF5Baloo_FOUND && KF5Baloo_FOUND
 
@@ -36,7 +37,11 @@
 #endif
 
 #include <QFileInfo>
+#include <QFile>
 #include <QLocale>
+#include <QtEndian>
+
+#include <algorithm>
 
 class FileScannerPrivate
 {
@@ -47,9 +52,20 @@ public:
 
     KFileMetaData::PropertyMap mAllProperties;
 
+    KFileMetaData::EmbeddedImageData mImageScanner;
+
     QString checkForMultipleEntries(KFileMetaData::Property::Property property);
 #endif
 
+    static bool locateId3v2FrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover);
+
+    static bool locateFlacFrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover);
+
+    static bool locateMp4FrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover);
+
+    static bool findMp4Atom(QFile &audioFile, qint64 begin, qint64 end, const QByteArray &atomType,
+                            qint64 &atomBegin, qint64 &atomEnd);
+
 };
 
 FileScanner::FileScanner() : d(std::make_unique<FileScannerPrivate>())
@@ -101,6 +117,82 @@ MusicAudioTrack FileScanner::scanOneFile(const QUrl &scanFile, const QMimeDataba
 #endif
 }
 
+MusicAudioTrack FileScanner::scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase, EmbeddedCover &frontCover)
+{
+    auto newTrack = scanOneFile(scanFile, mimeDatabase);
+
+    if (newTrack.isValid()) {
+        const auto &localFileName = scanFile.toLocalFile();
+
+        frontCover = locateFrontCover(localFileName, mimeDatabase.mimeTypeForFile(localFileName).name());
+        newTrack.setHasEmbeddedCover(frontCover.isValid());
+    }
+
+    return newTrack;
+}
+
+FileScanner::EmbeddedCover FileScanner::locateFrontCover(const QString &localFileName, const QString &mimeType)
+{
+    auto frontCover = EmbeddedCover{};
+
+    QFile audioFile(localFileName);
+    auto isLocated = false;
+
+    if (audioFile.open(QIODevice::ReadOnly)) {
+        if (mimeType == QStringLiteral("audio/mpeg")) {
+            isLocated = FileScannerPrivate::locateId3v2FrontCover(audioFile, frontCover);
+        } else if (mimeType == QStringLiteral("audio/flac") || mimeType == QStringLiteral("audio/x-flac")) {
+            isLocated = FileScannerPrivate::locateFlacFrontCover(audioFile, frontCover);
+        } else if (mimeType == QStringLiteral("audio/mp4") || mimeType == QStringLiteral("audio/x-m4a")) {
+            isLocated = FileScannerPrivate::locateMp4FrontCover(audioFile, frontCover);
+        }
+    }
+
+    // a length read from a truncated file would make readFrontCover return a partial image
+    if (frontCover.hasLocation() && frontCover.mOffset + frontCover.mSize > audioFile.size()) {
+        frontCover.mOffset = -1;
+        frontCover.mSize = -1;
+    }
+
+    if (isLocated) {
+        return frontCover;
+    }
+
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+    auto imageData = d->mImageScanner.imageData(localFileName);
+
+    auto itFrontCover = imageData.find(KFileMetaData::EmbeddedImageData::FrontCover);
+    frontCover.mFound = itFrontCover != imageData.end() && !itFrontCover->isEmpty();
+#endif
+
+    return frontCover;
+}
+
+QByteArray FileScanner::readFrontCover(const QString &localFileName, const QString &mimeType)
+{
+    const auto &frontCover = locateFrontCover(localFileName, mimeType);
+
+    if (!frontCover.isValid()) {
+        return {};
+    }
+
+    if (frontCover.hasLocation()) {
+        QFile audioFile(localFileName);
+
+        if (audioFile.open(QIODevice::ReadOnly) && audioFile.seek(frontCover.mOffset)) {
+            return audioFile.read(frontCover.mSize);
+        }
+
+        return {};
+    }
+
+#if defined KF5FileMetaData_FOUND && KF5FileMetaData_FOUND
+    return d->mImageScanner.imageData(localFileName).value(KFileMetaData::EmbeddedImageData::FrontCover);
+#else
+    return {};
+#endif
+}
+
 void FileScanner::scanProperties(const Baloo::File &match, MusicAudioTrack &trackData)
 {
 #if defined KF5Baloo_FOUND && KF5Baloo_FOUND
@@ -261,3 +353,258 @@ QString FileScannerPrivate::checkForMultipleEntries(KFileMetaData::Property::Pro
     }
 }
 #endif
+
+bool FileScannerPrivate::locateId3v2FrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover)
+{
+    static const auto id3FrontCoverType = char(3);
+
+    const auto tagHeader = audioFile.read(10);
+    if (tagHeader.size() != 10 || !tagHeader.startsWith("ID3")) {
+        return false;
+    }
+
+    const auto majorVersion = int(tagHeader[3]);
+    const auto tagFlags = quint8(tagHeader[5]);
+
+    if (majorVersion < 2 || majorVersion > 4 || (tagFlags & 0x80)) {
+        return false;
+    }
+
+    auto syncSafeSize = [](const char *data) {
+        return (qint64(data[0] & 0x7f) << 21) | (qint64(data[1] & 0x7f) << 14) |
+                (qint64(data[2] & 0x7f) << 7) | qint64(data[3] & 0x7f);
+    };
+
+    const auto tagEnd = 10 + syncSafeSize(tagHeader.constData() + 6);
+    auto framePosition = qint64(10);
+
+    if (majorVersion > 2 && (tagFlags & 0x40)) {
+        const auto extendedHeader = audioFile.read(4);
+        if (extendedHeader.size() != 4) {
+            return false;
+        }
+
+        framePosition += (majorVersion == 4 ? syncSafeSize(extendedHeader.constData()) :
+                                              4 + qFromBigEndian<quint32>(extendedHeader.constData()));
+    }
+
+    const auto frameHeaderSize = (majorVersion == 2 ? 6 : 10);
+    const auto pictureFrameId = (majorVersion == 2 ? QByteArray("PIC") : QByteArray("APIC"));
+
+    while (framePosition + frameHeaderSize < tagEnd) {
+        if (!audioFile.seek(framePosition)) {
+            return false;
+        }
+
+        const auto frameHeader = audioFile.read(frameHeaderSize);
+        if (frameHeader.size() != frameHeaderSize || frameHeader[0] == 0) {
+            break;
+        }
+
+        auto frameSize = qint64(0);
+        auto frameFlags = quint16(0);
+        if (majorVersion == 2) {
+            frameSize = (qint64(quint8(frameHeader[3])) << 16) | (qint64(quint8(frameHeader[4])) << 8) | qint64(quint8(frameHeader[5]));
+        } else if (majorVersion == 3) {
+            frameSize = qFromBigEndian<quint32>(frameHeader.constData() + 4);
+            frameFlags = qFromBigEndian<quint16>(frameHeader.constData() + 8);
+        } else {
+            frameSize = syncSafeSize(frameHeader.constData() + 4);
+            frameFlags = qFromBigEndian<quint16>(frameHeader.constData() + 8);
+        }
+
+        const auto frameDataPosition = framePosition + frameHeaderSize;
+        framePosition = frameDataPosition + frameSize;
+
+        if (!frameHeader.startsWith(pictureFrameId)) {
+            continue;
+        }
+
+        const auto pictureHeader = audioFile.read(std::min(frameSize, qint64(1024)));
+        if (pictureHeader.isEmpty()) {
+            continue;
+        }
+
+        const auto textEncoding = int(pictureHeader[0]);
+        auto headerPosition = 1;
+
+        if (majorVersion == 2) {
+            headerPosition += 3;
+        } else {
+            headerPosition = pictureHeader.indexOf('\0', headerPosition);
+            if (headerPosition == -1) {
+                continue;
+            }
+            ++headerPosition;
+        }
+
+        if (headerPosition >= pictureHeader.size() || pictureHeader[headerPosition] != id3FrontCoverType) {
+            continue;
+        }
+        ++headerPosition;
+
+        if (textEncoding == 1 || textEncoding == 2) {
+            while (headerPosition + 1 < pictureHeader.size() &&
+                   (pictureHeader[headerPosition] != 0 || pictureHeader[headerPosition + 1] != 0)) {
+                headerPosition += 2;
+            }
+            headerPosition += 2;
+        } else {
+            headerPosition = pictureHeader.indexOf('\0', headerPosition);
+            if (headerPosition == -1) {
+                headerPosition = pictureHeader.size();
+            }
+            ++headerPosition;
+        }
+
+        frontCover.mFound = true;
+
+        if (headerPosition <= pictureHeader.size() && !(frameFlags & 0x00ff)) {
+            frontCover.mOffset = frameDataPosition + headerPosition;
+            frontCover.mSize = frameSize - headerPosition;
+        }
+
+        return true;
+    }
+
+    return true;
+}
+
+bool FileScannerPrivate::locateFlacFrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover)
+{
+    static const auto flacPictureBlockType = 6;
+    static const auto flacFrontCoverType = quint32(3);
+
+    if (audioFile.read(4) != "fLaC") {
+        return false;
+    }
+
+    auto isLastBlock = false;
+    while (!isLastBlock) {
+        const auto blockHeader = audioFile.read(4);
+        if (blockHeader.size() != 4) {
+            return true;
+        }
+
+        isLastBlock = quint8(blockHeader[0]) & 0x80;
+        const auto blockType = quint8(blockHeader[0]) & 0x7f;
+        const auto blockSize = (qint64(quint8(blockHeader[1])) << 16) | (qint64(quint8(blockHeader[2])) << 8) | qint64(quint8(blockHeader[3]));
+        const auto nextBlockPosition = audioFile.pos() + blockSize;
+
+        if (blockType == flacPictureBlockType) {
+            auto readValue = [&audioFile](quint32 &value) {
+                const auto rawValue = audioFile.read(4);
+                if (rawValue.size() != 4) {
+                    return false;
+                }
+                value = qFromBigEndian<quint32>(rawValue.constData());
+                return true;
+            };
+
+            auto pictureType = quint32(0);
+            auto mimeTypeLength = quint32(0);
+            auto descriptionLength = quint32(0);
+            auto pictureDataLength = quint32(0);
+
+            if (!readValue(pictureType)) {
+                return true;
+            }
+
+            if (pictureType == flacFrontCoverType) {
+                frontCover.mFound = true;
+
+                if (readValue(mimeTypeLength) && audioFile.seek(audioFile.pos() + mimeTypeLength) &&
+                        readValue(descriptionLength) && audioFile.seek(audioFile.pos() + descriptionLength + 16) &&
+                        readValue(pictureDataLength)) {
+                    frontCover.mOffset = audioFile.pos();
+                    frontCover.mSize = pictureDataLength;
+                }
+
+                return true;
+            }
+        }
+
+        if (!audioFile.seek(nextBlockPosition)) {
+            return true;
+        }
+    }
+
+    return true;
+}
+
+bool FileScannerPrivate::findMp4Atom(QFile &audioFile, qint64 begin, qint64 end, const QByteArray &atomType,
+                                     qint64 &atomBegin, qint64 &atomEnd)
+{
+    auto atomPosition = begin;
+
+    while (atomPosition + 8 <= end) {
+        if (!audioFile.seek(atomPosition)) {
+            return false;
+        }
+
+        const auto atomHeader = audioFile.read(8);
+        if (atomHeader.size() != 8) {
+            return false;
+        }
+
+        auto atomSize = qint64(qFromBigEndian<quint32>(atomHeader.constData()));
+        auto headerSize = qint64(8);
+
+        if (atomSize == 1) {
+            const auto largeSize = audioFile.read(8);
+            if (largeSize.size() != 8) {
+                return false;
+            }
+            atomSize = qint64(qFromBigEndian<quint64>(largeSize.constData()));
+            headerSize = 16;
+        } else if (atomSize == 0) {
+            atomSize = end - atomPosition;
+        }
+
+        if (atomSize < headerSize) {
+            return false;
+        }
+
+        if (atomHeader.mid(4, 4) == atomType) {
+            atomBegin = atomPosition + headerSize;
+            atomEnd = std::min(end, atomPosition + atomSize);
+            return true;
+        }
+
+        atomPosition += atomSize;
+    }
+
+    return false;
+}
+
+bool FileScannerPrivate::locateMp4FrontCover(QFile &audioFile, FileScanner::EmbeddedCover &frontCover)
+{
+    auto fileTypeBegin = qint64(0);
+    auto fileTypeEnd = qint64(0);
+    if (!findMp4Atom(audioFile, 0, 16, "ftyp", fileTypeBegin, fileTypeEnd)) {
+        return false;
+    }
+
+    auto atomBegin = qint64(0);
+    auto atomEnd = audioFile.size();
+
+    const auto coverPath = QList<QByteArray>{"moov", "udta", "meta", "ilst", "covr", "data"};
+    for (const auto &oneAtomType : coverPath) {
+        if (!findMp4Atom(audioFile, atomBegin, atomEnd, oneAtomType, atomBegin, atomEnd)) {
+            return true;
+        }
+
+        if (oneAtomType == "meta") {
+            atomBegin += 4;
+        }
+    }
+
+    frontCover.mFound = true;
+
+    if (atomEnd - atomBegin > 8) {
+        frontCover.mOffset = atomBegin + 8;
+        frontCover.mSize = atomEnd - atomBegin - 8;
+    }
+
+    return true;
+}
@@ -40,12 +40,43 @@ class ELISALIB_EXPORT FileScanner
 {
 public:
 
+    class EmbeddedCover
+    {
+    public:
+
+        bool isValid() const
+        {
+            return mFound;
+        }
+
+        bool hasLocation() const
+        {
+            return mFound && mOffset >= 0 && mSize > 0;
+        }
+
+        bool mFound = false;
+
+        qint64 mOffset = -1;
+
+        qint64 mSize = -1;
+
+    };
+
     FileScanner();
 
     virtual ~FileScanner();
 
     MusicAudioTrack scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase);
 
+    MusicAudioTrack scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase, EmbeddedCover &frontCover);
+
+    EmbeddedCover locateFrontCover(const QString &localFileName, const QString &mimeType);
+
+    /**
+     * Read the encoded front cover embedded in an audio file, or an empty array if there is none.
+     */
+    QByteArray readFrontCover(const QString &localFileName, const QString &mimeType);
+
     void scanProperties(const Baloo::File &match, MusicAudioTrack &trackData);
 
     void scanProperties(const QString &localFileName, MusicAudioTrack &trackData);
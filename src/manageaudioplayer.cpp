@@ -151,6 +151,20 @@ void ManageAudioPlayer::setCurrentTrack(const QPersistentModelIndex &currentTrac
         Q_EMIT currentTrackChanged();
     }
 
+    if (mAdvancingToNextTrack) {
+        mAdvancingToNextTrack = false;
+
+        // the player already plays the new track, the audio wrapper ignores this source
+        if (mCurrentTrack.isValid() && mCurrentTrack.data(mUrlRole) == mOldPlayerSource) {
+            if (mPlayListModel) {
+                mPlayListModel->setData(mCurrentTrack, MediaPlayList::IsPlaying, mIsPlayingRole);
+            }
+            Q_EMIT playerSourceChanged(mCurrentTrack.data(mUrlRole).toUrl());
+            Q_EMIT startedPlayingTrack(mCurrentTrack.data(mUrlRole).toUrl(), QDateTime::currentDateTime());
+            return;
+        }
+    }
+
     switch (mPlayerPlaybackState) {
     case QMediaPlayer::StoppedState:
         notifyPlayerSourceProperty();
@@ -443,6 +457,24 @@ void ManageAudioPlayer::playListFinished()
     mPlayingState = false;
 }
 
+void ManageAudioPlayer::playerSourceAdvanced(const QUrl &source)
+{
+    if (!mCurrentTrack.isValid()) {
+        return;
+    }
+
+    if (mPlayListModel) {
+        mPlayListModel->setData(mCurrentTrack, MediaPlayList::NotPlaying, mIsPlayingRole);
+    }
+
+    mOldPlayerSource = source;
+    mAdvancingToNextTrack = true;
+
+    Q_EMIT skipNextTrack();
+
+    mAdvancingToNextTrack = false;
+}
+
 void ManageAudioPlayer::tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
 {
     if (!mCurrentTrack.isValid()) {
@@ -245,6 +245,8 @@ public Q_SLOTS:
 
     void playListFinished();
 
+    void playerSourceAdvanced(const QUrl &source);
+
     void tracksDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
 
     void setTitleRole(int titleRole);
@@ -295,6 +297,8 @@ private:
 
     bool mSkippingCurrentTrack = false;
 
+    bool mAdvancingToNextTrack = false;
+
     int mAudioDuration = 0;
 
     bool mPlayerIsSeekable = false;
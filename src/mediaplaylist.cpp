@@ -23,6 +23,7 @@
 #include <QUrl>
 #include <QPersistentModelIndex>
 #include <QList>
+#include <QMultiHash>
 #include <QMediaPlaylist>
 #include <QFileInfo>
 #include <QJsonArray>
@@ -31,18 +32,119 @@
 
 #include <algorithm>
 
+class MediaPlayListTrackKey
+{
+public:
+
+    QString mTitle;
+
+    QString mAlbum;
+
+    int mTrackNumber = 0;
+
+    int mDiscNumber = 0;
+
+    bool operator==(const MediaPlayListTrackKey &other) const
+    {
+        return mTitle == other.mTitle && mAlbum == other.mAlbum &&
+                mTrackNumber == other.mTrackNumber && mDiscNumber == other.mDiscNumber;
+    }
+
+};
+
+static uint qHash(const MediaPlayListTrackKey &key, uint seed = 0)
+{
+    return qHash(key.mTitle, seed) ^ qHash(key.mAlbum, seed) ^ qHash(key.mTrackNumber, seed) ^ qHash(key.mDiscNumber, seed);
+}
+
 class MediaPlayListPrivate
 {
 public:
 
+    void invalidateIndexes()
+    {
+        mRowsByDatabaseId.clear();
+        mRowsByUrl.clear();
+        mRowsByTrackKey.clear();
+        mIndexedRowsCount = 0;
+    }
+
+    void indexEntry(int row)
+    {
+        if (row >= mIndexedRowsCount) {
+            return;
+        }
+
+        const auto &oneEntry = mData[row];
+
+        if (oneEntry.mId != 0) {
+            mRowsByDatabaseId.insert(oneEntry.mId, row);
+        }
+
+        if (oneEntry.mTrackUrl.isValid()) {
+            mRowsByUrl.insert(oneEntry.mTrackUrl.toUrl(), row);
+        } else {
+            mRowsByTrackKey.insert({oneEntry.mTitle.toString(), oneEntry.mAlbum.toString(),
+                                    oneEntry.mTrackNumber.toInt(), oneEntry.mDiscNumber.toInt()}, row);
+        }
+    }
+
+    void updateIndexes()
+    {
+        while (mIndexedRowsCount < mData.size()) {
+            ++mIndexedRowsCount;
+            indexEntry(mIndexedRowsCount - 1);
+        }
+    }
+
+    QVector<int> rowsWithDatabaseId(qulonglong databaseId)
+    {
+        updateIndexes();
+
+        auto result = mRowsByDatabaseId.values(databaseId).toVector();
+
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        return result;
+    }
+
+    QVector<int> rowsMatchingTrack(const DatabaseInterface::TrackDataType &track)
+    {
+        updateIndexes();
+
+        auto result = QVector<int>{};
+
+        if (track.databaseId() != 0) {
+            result += mRowsByDatabaseId.values(track.databaseId()).toVector();
+        }
+        result += mRowsByUrl.values(track.resourceURI()).toVector();
+        result += mRowsByTrackKey.values({track.title(), track.album(), track.trackNumber(), track.discNumber()}).toVector();
+
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        return result;
+    }
+
     QList<MediaPlayListEntry> mData;
 
     QList<DatabaseInterface::TrackDataType> mTrackData;
 
+    QMultiHash<qulonglong, int> mRowsByDatabaseId;
+
+    QMultiHash<QUrl, int> mRowsByUrl;
+
+    QMultiHash<MediaPlayListTrackKey, int> mRowsByTrackKey;
+
+    int mIndexedRowsCount = 0;
+
     MusicListenersManager* mMusicListenersManager = nullptr;
 
     QPersistentModelIndex mCurrentTrack;
 
+    QUrl mNextTrackUrl;
+
     QVariantMap mPersistentState;
 
     QMediaPlaylist mLoadPlaylist;
@@ -62,6 +164,12 @@ MediaPlayList::MediaPlayList(QObject *parent) : QAbstractListModel(parent), d(ne
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loaded, this, &MediaPlayList::loadPlayListLoaded);
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loadFailed, this, &MediaPlayList::loadPlayListLoadFailed);
 
+    connect(this, &MediaPlayList::rowsInserted, this, &MediaPlayList::updateNextTrackUrl);
+    connect(this, &MediaPlayList::rowsRemoved, this, &MediaPlayList::updateNextTrackUrl);
+    connect(this, &MediaPlayList::rowsMoved, this, &MediaPlayList::updateNextTrackUrl);
+    connect(this, &MediaPlayList::modelReset, this, &MediaPlayList::updateNextTrackUrl);
+    connect(this, &MediaPlayList::dataChanged, this, &MediaPlayList::updateNextTrackUrl);
+
     auto currentMsecTime = QTime::currentTime().msec();
 
     if (currentMsecTime != -1) {
@@ -132,7 +240,7 @@ QVariant MediaPlayList::data(const QModelIndex &index, int role) const
             break;
         case ColumnsRoles::StringDurationRole:
         {
-            QTime trackDuration = d->mTrackData[index.row()][TrackDataType::key_type::DurationRole].toTime();
+            QTime trackDuration = d->mTrackData[index.row()].duration();
             if (trackDuration.hour() == 0) {
                 result = trackDuration.toString(QStringLiteral("mm:ss"));
             } else {
@@ -141,9 +249,9 @@ QVariant MediaPlayList::data(const QModelIndex &index, int role) const
             break;
         }
         case ColumnsRoles::AlbumSectionRole:
-            result = QJsonDocument{QJsonArray{d->mTrackData[index.row()][TrackDataType::key_type::AlbumRole].toString(),
-                                              d->mTrackData[index.row()][TrackDataType::key_type::AlbumArtistRole].toString(),
-                                              d->mTrackData[index.row()][TrackDataType::key_type::ImageUrlRole].toUrl().toString()}}.toJson();
+            result = QJsonDocument{QJsonArray{d->mTrackData[index.row()].album(),
+                                              d->mTrackData[index.row()].albumArtist(),
+                                              d->mTrackData[index.row()].albumCover().toString()}}.toJson();
             break;
         default:
             result = d->mTrackData[index.row()][static_cast<TrackDataType::key_type>(role)];
@@ -245,6 +353,7 @@ bool MediaPlayList::removeRows(int row, int count, const QModelIndex &parent)
         d->mData.removeAt(i);
         d->mTrackData.removeAt(i);
     }
+    d->invalidateIndexes();
     endRemoveRows();
 
     if (!d->mCurrentTrack.isValid()) {
@@ -293,6 +402,8 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
         }
     }
 
+    d->invalidateIndexes();
+
     endMoveRows();
 
     Q_EMIT persistentStateChanged();
@@ -488,6 +599,7 @@ void MediaPlayList::clearPlayList(bool prepareUndo)
     beginRemoveRows({}, 0, d->mData.count() - 1);
     d->mData.clear();
     d->mTrackData.clear();
+    d->invalidateIndexes();
     endRemoveRows();
 
     d->mCurrentPlayListPosition = 0;
@@ -563,6 +675,7 @@ void MediaPlayList::copyD()
 {
     dOld->mData = d->mData;
     dOld->mTrackData = d->mTrackData;
+    dOld->invalidateIndexes();
     dOld->mMusicListenersManager = d->mMusicListenersManager;
     dOld->mCurrentTrack = d->mCurrentTrack;
     dOld->mPersistentState = d->mPersistentState;
@@ -747,6 +860,11 @@ int MediaPlayList::currentTrackRow() const
     return d->mCurrentTrack.row();
 }
 
+QUrl MediaPlayList::nextTrackUrl() const
+{
+    return d->mNextTrackUrl;
+}
+
 bool MediaPlayList::randomPlay() const
 {
     return d->mRandomPlay;
@@ -825,6 +943,7 @@ void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
         oneEntry.mId = tracks.first().databaseId();
         oneEntry.mIsValid = true;
         oneEntry.mEntryType = ElisaUtils::Track;
+        d->indexEntry(playListIndex);
 
         Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
 
@@ -855,7 +974,56 @@ void MediaPlayList::tracksListAdded(qulonglong newDatabaseId,
 
 void MediaPlayList::trackChanged(const TrackDataType &track)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
+    const auto modifiedRows = updateEntriesFromTrack(track);
+
+    for (auto oneRow : modifiedRows) {
+        Q_EMIT dataChanged(index(oneRow, 0), index(oneRow, 0), {});
+
+        restorePlayListPosition();
+
+        if (!d->mCurrentTrack.isValid()) {
+            resetCurrentTrack();
+        }
+    }
+}
+
+void MediaPlayList::tracksChanged(const ListTrackDataType &tracks)
+{
+    auto modifiedRows = QVector<int>{};
+
+    for (const auto &oneTrack : tracks) {
+        modifiedRows += updateEntriesFromTrack(oneTrack);
+    }
+
+    if (modifiedRows.isEmpty()) {
+        return;
+    }
+
+    std::sort(modifiedRows.begin(), modifiedRows.end());
+
+    for (int rangeStart = 0; rangeStart < modifiedRows.size(); ) {
+        auto rangeEnd = rangeStart;
+        while (rangeEnd + 1 < modifiedRows.size() && modifiedRows[rangeEnd + 1] <= modifiedRows[rangeEnd] + 1) {
+            ++rangeEnd;
+        }
+
+        Q_EMIT dataChanged(index(modifiedRows[rangeStart], 0), index(modifiedRows[rangeEnd], 0), {});
+
+        rangeStart = rangeEnd + 1;
+    }
+
+    restorePlayListPosition();
+
+    if (!d->mCurrentTrack.isValid()) {
+        resetCurrentTrack();
+    }
+}
+
+QVector<int> MediaPlayList::updateEntriesFromTrack(const TrackDataType &track)
+{
+    auto modifiedRows = QVector<int>{};
+
+    for (auto i : d->rowsMatchingTrack(track)) {
         auto &oneEntry = d->mData[i];
 
         if (oneEntry.mEntryType != ElisaUtils::Artist && oneEntry.mIsValid) {
@@ -869,28 +1037,13 @@ void MediaPlayList::trackChanged(const TrackDataType &track)
 
             const auto &trackData = d->mTrackData[i];
 
-            if (!trackData.empty()) {
-                bool sameData = true;
-                for (auto oneKeyIterator = track.constKeyValueBegin(); oneKeyIterator != track.constKeyValueEnd(); ++oneKeyIterator) {
-                    if (trackData[(*oneKeyIterator).first] != (*oneKeyIterator).second) {
-                        sameData = false;
-                        break;
-                    }
-                }
-                if (sameData) {
-                    continue;
-                }
+            if (!trackData.isEmpty() && trackData.includes(track)) {
+                continue;
             }
 
             d->mTrackData[i] = track;
+            modifiedRows.push_back(i);
 
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-
-            restorePlayListPosition();
-
-            if (!d->mCurrentTrack.isValid()) {
-                resetCurrentTrack();
-            }
             continue;
         } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && !oneEntry.mTrackUrl.isValid()) {
             if (track.title() != oneEntry.mTitle) {
@@ -912,14 +1065,8 @@ void MediaPlayList::trackChanged(const TrackDataType &track)
             d->mTrackData[i] = track;
             oneEntry.mId = track.databaseId();
             oneEntry.mIsValid = true;
-
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-
-            restorePlayListPosition();
-
-            if (!d->mCurrentTrack.isValid()) {
-                resetCurrentTrack();
-            }
+            d->indexEntry(i);
+            modifiedRows.push_back(i);
 
             break;
         } else if (oneEntry.mEntryType != ElisaUtils::Artist && !oneEntry.mIsValid && oneEntry.mTrackUrl.isValid()) {
@@ -930,23 +1077,19 @@ void MediaPlayList::trackChanged(const TrackDataType &track)
             d->mTrackData[i] = track;
             oneEntry.mId = track.databaseId();
             oneEntry.mIsValid = true;
-
-            Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
-
-            restorePlayListPosition();
-
-            if (!d->mCurrentTrack.isValid()) {
-                resetCurrentTrack();
-            }
+            d->indexEntry(i);
+            modifiedRows.push_back(i);
 
             break;
         }
     }
+
+    return modifiedRows;
 }
 
 void MediaPlayList::trackRemoved(qulonglong trackId)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
+    for (auto i : d->rowsWithDatabaseId(trackId)) {
         auto &oneEntry = d->mData[i];
 
         if (oneEntry.mIsValid) {
@@ -957,6 +1100,7 @@ void MediaPlayList::trackRemoved(qulonglong trackId)
                 oneEntry.mAlbum = d->mTrackData[i].album();
                 oneEntry.mTrackNumber = d->mTrackData[i].trackNumber();
                 oneEntry.mDiscNumber = d->mTrackData[i].discNumber();
+                d->indexEntry(i);
 
                 Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -987,12 +1131,14 @@ void MediaPlayList::setRandomPlay(bool value)
 {
     d->mRandomPlay = value;
     Q_EMIT randomPlayChanged();
+    updateNextTrackUrl();
 }
 
 void MediaPlayList::setRepeatPlay(bool value)
 {
     d->mRepeatPlay = value;
     Q_EMIT repeatPlayChanged();
+    updateNextTrackUrl();
 }
 
 void MediaPlayList::displayOrHideUndoInline(bool value)
@@ -1144,6 +1290,38 @@ void MediaPlayList::notifyCurrentTrackChanged()
     if (currentTrackIsValid) {
         d->mCurrentPlayListPosition = d->mCurrentTrack.row();
     }
+    updateNextTrackUrl();
+}
+
+void MediaPlayList::updateNextTrackUrl()
+{
+    auto nextTrack = QModelIndex{};
+
+    // must stay in sync with skipNextTrack: a random pick is only known when it happens
+    if (d->mCurrentTrack.isValid() && !d->mRandomPlay) {
+        if (d->mCurrentTrack.row() < rowCount() - 1) {
+            nextTrack = index(d->mCurrentTrack.row() + 1, 0);
+        } else if (d->mRepeatPlay && rowCount() > 1) {
+            for(int row = 0; row < rowCount(); ++row) {
+                auto candidateTrack = index(row, 0);
+
+                if (candidateTrack.isValid() && candidateTrack.data(ColumnsRoles::IsValidRole).toBool()) {
+                    nextTrack = candidateTrack;
+                    break;
+                }
+            }
+        }
+    }
+
+    auto newNextTrackUrl = QUrl{};
+    if (nextTrack.isValid() && nextTrack.data(ColumnsRoles::IsValidRole).toBool()) {
+        newNextTrackUrl = nextTrack.data(ColumnsRoles::ResourceRole).toUrl();
+    }
+
+    if (d->mNextTrackUrl != newNextTrackUrl) {
+        d->mNextTrackUrl = newNextTrackUrl;
+        Q_EMIT nextTrackUrlChanged(d->mNextTrackUrl);
+    }
 }
 
 void MediaPlayList::restorePlayListPosition()
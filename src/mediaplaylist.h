@@ -26,6 +26,7 @@
 
 #include <QAbstractListModel>
 #include <QVector>
+#include <QUrl>
 #include <QMediaPlayer>
 
 #include <utility>
@@ -62,6 +63,10 @@ class ELISALIB_EXPORT MediaPlayList : public QAbstractListModel
                READ currentTrackRow
                NOTIFY currentTrackRowChanged)
 
+    Q_PROPERTY(QUrl nextTrackUrl
+               READ nextTrackUrl
+               NOTIFY nextTrackUrlChanged)
+
     Q_PROPERTY(bool randomPlay
                READ randomPlay
                WRITE setRandomPlay
@@ -166,6 +171,12 @@ public:
 
     int currentTrackRow() const;
 
+    /**
+     * Url of the track that will follow the current one when it ends, empty when it
+     * cannot be known in advance (random play, end of the play list, invalid entry).
+     */
+    QUrl nextTrackUrl() const;
+
     bool randomPlay() const;
 
     bool repeatPlay() const;
@@ -195,6 +206,8 @@ Q_SIGNALS:
 
     void currentTrackRowChanged();
 
+    void nextTrackUrlChanged(const QUrl &nextTrackUrl);
+
     void randomPlayChanged();
 
     void repeatPlayChanged();
@@ -220,6 +233,8 @@ public Q_SLOTS:
 
     void trackChanged(const MediaPlayList::TrackDataType &track);
 
+    void tracksChanged(const MediaPlayList::ListTrackDataType &tracks);
+
     void trackRemoved(qulonglong trackId);
 
     void setMusicListenersManager(MusicListenersManager* musicListenersManager);
@@ -280,6 +295,8 @@ private:
 
     void notifyCurrentTrackChanged();
 
+    void updateNextTrackUrl();
+
     void restorePlayListPosition();
 
     void restoreRandomPlay();
@@ -298,6 +315,8 @@ private:
 
     void enqueueCommon();
 
+    QVector<int> updateEntriesFromTrack(const MediaPlayList::TrackDataType &track);
+
     void copyD();
 
     std::unique_ptr<MediaPlayListPrivate> d;
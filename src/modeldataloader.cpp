@@ -27,6 +27,8 @@ public:
 
     DatabaseInterface *mDatabase = nullptr;
 
+    DatabaseInterface *mReadOnlyDatabase = nullptr;
+
     QMimeDatabase mMimeDatabase;
 
     FileScanner mFileScanner;
@@ -63,18 +65,25 @@ void ModelDataLoader::setDatabase(DatabaseInterface *database)
             this, &ModelDataLoader::databaseAlbumsAdded);
     connect(database, &DatabaseInterface::albumModified,
             this, &ModelDataLoader::databaseAlbumModified);
-    connect(database, &DatabaseInterface::albumRemoved,
-            this, &ModelDataLoader::databaseAlbumRemoved);
+    connect(database, &DatabaseInterface::albumsRemoved,
+            this, &ModelDataLoader::databaseAlbumsRemoved);
     connect(database, &DatabaseInterface::tracksAdded,
             this, &ModelDataLoader::databaseTracksAdded);
     connect(database, &DatabaseInterface::trackModified,
             this, &ModelDataLoader::databaseTrackModified);
-    connect(database, &DatabaseInterface::trackRemoved,
-            this, &ModelDataLoader::databaseTrackRemoved);
+    connect(database, &DatabaseInterface::tracksModified,
+            this, &ModelDataLoader::databaseTracksModified);
+    connect(database, &DatabaseInterface::tracksRemoved,
+            this, &ModelDataLoader::databaseTracksRemoved);
     connect(database, &DatabaseInterface::artistsAdded,
             this, &ModelDataLoader::databaseArtistsAdded);
-    connect(database, &DatabaseInterface::artistRemoved,
-            this, &ModelDataLoader::databaseArtistRemoved);
+    connect(database, &DatabaseInterface::artistsRemoved,
+            this, &ModelDataLoader::databaseArtistsRemoved);
+}
+
+void ModelDataLoader::setReadOnlyDatabase(DatabaseInterface *database)
+{
+    d->mReadOnlyDatabase = database;
 }
 
 void ModelDataLoader::loadData(ElisaUtils::PlayListEntryType dataType)
@@ -88,20 +97,20 @@ void ModelDataLoader::loadData(ElisaUtils::PlayListEntryType dataType)
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsData());
+        Q_EMIT allAlbumsData(readDatabase()->allAlbumsData());
         break;
     case ElisaUtils::Artist:
-        Q_EMIT allArtistsData(d->mDatabase->allArtistsData());
+        Q_EMIT allArtistsData(readDatabase()->allArtistsData());
         break;
     case ElisaUtils::Composer:
         break;
     case ElisaUtils::Genre:
-        Q_EMIT allGenresData(d->mDatabase->allGenresData());
+        Q_EMIT allGenresData(readDatabase()->allGenresData());
         break;
     case ElisaUtils::Lyricist:
         break;
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->allTracksData());
+        Q_EMIT allTracksData(readDatabase()->allTracksData());
         break;
     case ElisaUtils::FileName:
     case ElisaUtils::Unknown:
@@ -109,6 +118,35 @@ void ModelDataLoader::loadData(ElisaUtils::PlayListEntryType dataType)
     }
 }
 
+void ModelDataLoader::loadDataPage(ElisaUtils::PlayListEntryType dataType, const QString &afterTitle,
+                                   qulonglong afterDatabaseId, int count)
+{
+    if (!d->mDatabase) {
+        return;
+    }
+
+    d->mFilterType = ModelDataLoader::FilterType::NoFilter;
+
+    switch (dataType)
+    {
+    case ElisaUtils::Album:
+        Q_EMIT albumsPageData(readDatabase()->albumsDataPage(afterTitle, afterDatabaseId, count));
+        break;
+    case ElisaUtils::Artist:
+        Q_EMIT artistsPageData(readDatabase()->artistsDataPage(afterTitle, afterDatabaseId, count));
+        break;
+    case ElisaUtils::Track:
+        Q_EMIT tracksPageData(readDatabase()->tracksDataPage(afterTitle, afterDatabaseId, count));
+        break;
+    case ElisaUtils::Composer:
+    case ElisaUtils::Genre:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+        break;
+    }
+}
+
 void ModelDataLoader::loadDataByAlbumId(ElisaUtils::PlayListEntryType dataType, qulonglong databaseId)
 {
     if (!d->mDatabase) {
@@ -131,7 +169,7 @@ void ModelDataLoader::loadDataByAlbumId(ElisaUtils::PlayListEntryType dataType,
     case ElisaUtils::Lyricist:
         break;
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->albumData(databaseId));
+        Q_EMIT allTracksData(readDatabase()->albumData(databaseId));
         break;
     case ElisaUtils::FileName:
     case ElisaUtils::Unknown:
@@ -151,7 +189,7 @@ void ModelDataLoader::loadDataByGenre(ElisaUtils::PlayListEntryType dataType, co
     switch (dataType)
     {
     case ElisaUtils::Artist:
-        Q_EMIT allArtistsData(d->mDatabase->allArtistsDataByGenre(genre));
+        Q_EMIT allArtistsData(readDatabase()->allArtistsDataByGenre(genre));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Composer:
@@ -176,7 +214,7 @@ void ModelDataLoader::loadDataByArtist(ElisaUtils::PlayListEntryType dataType, c
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsDataByArtist(artist));
+        Q_EMIT allAlbumsData(readDatabase()->allAlbumsDataByArtist(artist));
         break;
     case ElisaUtils::Artist:
     case ElisaUtils::Composer:
@@ -202,7 +240,7 @@ void ModelDataLoader::loadDataByGenreAndArtist(ElisaUtils::PlayListEntryType dat
     switch (dataType)
     {
     case ElisaUtils::Album:
-        Q_EMIT allAlbumsData(d->mDatabase->allAlbumsDataByGenreAndArtist(genre, artist));
+        Q_EMIT allAlbumsData(readDatabase()->allAlbumsDataByGenreAndArtist(genre, artist));
         break;
     case ElisaUtils::Artist:
     case ElisaUtils::Composer:
@@ -227,7 +265,7 @@ void ModelDataLoader::loadDataByDatabaseId(ElisaUtils::PlayListEntryType dataTyp
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTrackData(d->mDatabase->trackDataFromDatabaseId(databaseId));
+        Q_EMIT allTrackData(readDatabase()->trackDataFromDatabaseId(databaseId));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -240,6 +278,18 @@ void ModelDataLoader::loadDataByDatabaseId(ElisaUtils::PlayListEntryType dataTyp
     }
 }
 
+void ModelDataLoader::loadTrackLyrics(qulonglong databaseId)
+{
+    auto lyrics = QString{};
+
+    if (!d->mDatabase || !readDatabase()->trackLyricsFromDatabaseId(databaseId, lyrics)) {
+        Q_EMIT trackLyricsUnavailable(databaseId);
+        return;
+    }
+
+    Q_EMIT trackLyricsData(databaseId, lyrics);
+}
+
 void ModelDataLoader::loadDataByFileName(ElisaUtils::PlayListEntryType dataType, const QUrl &fileName)
 {
     if (!d->mDatabase) {
@@ -278,7 +328,7 @@ void ModelDataLoader::loadRecentlyPlayedData(ElisaUtils::PlayListEntryType dataT
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->recentlyPlayedTracksData(50));
+        Q_EMIT allTracksData(readDatabase()->recentlyPlayedTracksData(50));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -302,7 +352,7 @@ void ModelDataLoader::loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dat
     switch (dataType)
     {
     case ElisaUtils::Track:
-        Q_EMIT allTracksData(d->mDatabase->frequentlyPlayedTracksData(50));
+        Q_EMIT allTracksData(readDatabase()->frequentlyPlayedTracksData(50));
         break;
     case ElisaUtils::Album:
     case ElisaUtils::Artist:
@@ -315,6 +365,34 @@ void ModelDataLoader::loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dat
     }
 }
 
+void ModelDataLoader::searchData(ElisaUtils::PlayListEntryType dataType, const QString &filterText)
+{
+    if (!d->mDatabase || !readDatabase()->hasSearchIndex()) {
+        Q_EMIT searchUnavailable(filterText);
+        return;
+    }
+
+    switch (dataType)
+    {
+    case ElisaUtils::Album:
+        Q_EMIT searchResultsData(filterText, readDatabase()->searchAlbums(filterText));
+        break;
+    case ElisaUtils::Artist:
+        Q_EMIT searchResultsData(filterText, readDatabase()->searchArtists(filterText));
+        break;
+    case ElisaUtils::Track:
+        Q_EMIT searchResultsData(filterText, readDatabase()->searchTracks(filterText));
+        break;
+    case ElisaUtils::Composer:
+    case ElisaUtils::Genre:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+        Q_EMIT searchUnavailable(filterText);
+        break;
+    }
+}
+
 void ModelDataLoader::databaseTracksAdded(const ListTrackDataType &newData)
 {
     switch(d->mFilterType) {
@@ -347,9 +425,14 @@ void ModelDataLoader::databaseTrackModified(const TrackDataType &modifiedTrack)
     Q_EMIT trackModified(modifiedTrack);
 }
 
-void ModelDataLoader::databaseTrackRemoved(qulonglong removedTrackId)
+void ModelDataLoader::databaseTracksModified(const ListTrackDataType &modifiedTracks)
+{
+    Q_EMIT tracksModified(modifiedTracks);
+}
+
+void ModelDataLoader::databaseTracksRemoved(const QList<qulonglong> &removedTracksIds)
 {
-    Q_EMIT trackRemoved(removedTrackId);
+    Q_EMIT tracksRemoved(removedTracksIds);
 }
 
 void ModelDataLoader::databaseGenresAdded(const ListGenreDataType &newData)
@@ -364,7 +447,7 @@ void ModelDataLoader::databaseArtistsAdded(const ListArtistDataType &newData)
     {
         auto filteredData = newData;
         auto new_end = std::remove_if(filteredData.begin(), filteredData.end(),
-                                      [&](const auto &oneArtist){return !d->mDatabase->internalArtistMatchGenre(oneArtist.databaseId(), d->mGenre);});
+                                      [&](const auto &oneArtist){return !readDatabase()->internalArtistMatchGenre(oneArtist.databaseId(), d->mGenre);});
         filteredData.erase(new_end, filteredData.end());
 
         Q_EMIT artistsAdded(filteredData);
@@ -384,9 +467,9 @@ void ModelDataLoader::databaseArtistsAdded(const ListArtistDataType &newData)
     }
 }
 
-void ModelDataLoader::databaseArtistRemoved(qulonglong removedDatabaseId)
+void ModelDataLoader::databaseArtistsRemoved(const QList<qulonglong> &removedDatabaseIds)
 {
-    Q_EMIT artistRemoved(removedDatabaseId);
+    Q_EMIT artistsRemoved(removedDatabaseIds);
 }
 
 void ModelDataLoader::databaseAlbumsAdded(const ListAlbumDataType &newData)
@@ -429,9 +512,9 @@ void ModelDataLoader::databaseAlbumsAdded(const ListAlbumDataType &newData)
     }
 }
 
-void ModelDataLoader::databaseAlbumRemoved(qulonglong removedDatabaseId)
+void ModelDataLoader::databaseAlbumsRemoved(const QList<qulonglong> &removedDatabaseIds)
 {
-    Q_EMIT albumRemoved(removedDatabaseId);
+    Q_EMIT albumsRemoved(removedDatabaseIds);
 }
 
 void ModelDataLoader::databaseAlbumModified(const AlbumDataType &modifiedAlbum)
@@ -439,5 +522,10 @@ void ModelDataLoader::databaseAlbumModified(const AlbumDataType &modifiedAlbum)
     Q_EMIT albumModified(modifiedAlbum);
 }
 
+DatabaseInterface *ModelDataLoader::readDatabase() const
+{
+    return d->mReadOnlyDatabase ? d->mReadOnlyDatabase : d->mDatabase;
+}
+
 
 #include "moc_modeldataloader.cpp"
@@ -52,6 +52,8 @@ public:
 
     void setDatabase(DatabaseInterface *database);
 
+    void setReadOnlyDatabase(DatabaseInterface *database);
+
 Q_SIGNALS:
 
     void allAlbumsData(const ModelDataLoader::ListAlbumDataType &allData);
@@ -64,21 +66,37 @@ Q_SIGNALS:
 
     void allTrackData(const ModelDataLoader::TrackDataType &allData);
 
+    void trackLyricsData(qulonglong databaseId, const QString &lyrics);
+
+    void trackLyricsUnavailable(qulonglong databaseId);
+
+    void albumsPageData(const ModelDataLoader::ListAlbumDataType &pageData);
+
+    void artistsPageData(const ModelDataLoader::ListArtistDataType &pageData);
+
+    void tracksPageData(const ModelDataLoader::ListTrackDataType &pageData);
+
+    void searchResultsData(const QString &filterText, const QList<qulonglong> &matchingIds);
+
+    void searchUnavailable(const QString &filterText);
+
     void tracksAdded(ModelDataLoader::ListTrackDataType newData);
 
     void trackModified(const ModelDataLoader::TrackDataType &modifiedTrack);
 
-    void trackRemoved(qulonglong removedTrackId);
+    void tracksModified(const ModelDataLoader::ListTrackDataType &modifiedTracks);
+
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
 
     void genresAdded(ModelDataLoader::ListGenreDataType newData);
 
     void artistsAdded(ModelDataLoader::ListArtistDataType newData);
 
-    void artistRemoved(qulonglong removedDatabaseId);
+    void artistsRemoved(const QList<qulonglong> &removedDatabaseIds);
 
     void albumsAdded(ModelDataLoader::ListAlbumDataType newData);
 
-    void albumRemoved(qulonglong removedDatabaseId);
+    void albumsRemoved(const QList<qulonglong> &removedDatabaseIds);
 
     void albumModified(const ModelDataLoader::AlbumDataType &modifiedAlbum);
 
@@ -86,6 +104,9 @@ public Q_SLOTS:
 
     void loadData(ElisaUtils::PlayListEntryType dataType);
 
+    void loadDataPage(ElisaUtils::PlayListEntryType dataType, const QString &afterTitle,
+                      qulonglong afterDatabaseId, int count);
+
     void loadDataByAlbumId(ElisaUtils::PlayListEntryType dataType, qulonglong databaseId);
 
     void loadDataByGenre(ElisaUtils::PlayListEntryType dataType,
@@ -103,27 +124,35 @@ public Q_SLOTS:
     void loadDataByFileName(ElisaUtils::PlayListEntryType dataType,
                             const QUrl &fileName);
 
+    void loadTrackLyrics(qulonglong databaseId);
+
     void loadRecentlyPlayedData(ElisaUtils::PlayListEntryType dataType);
 
+    void searchData(ElisaUtils::PlayListEntryType dataType, const QString &filterText);
+
     void loadFrequentlyPlayedData(ElisaUtils::PlayListEntryType dataType);
 
 private:
 
+    DatabaseInterface *readDatabase() const;
+
     void databaseTracksAdded(const ListTrackDataType &newData);
 
     void databaseTrackModified(const TrackDataType &modifiedTrack);
 
-    void databaseTrackRemoved(qulonglong removedTrackId);
+    void databaseTracksModified(const ListTrackDataType &modifiedTracks);
+
+    void databaseTracksRemoved(const QList<qulonglong> &removedTracksIds);
 
     void databaseGenresAdded(const ListGenreDataType &newData);
 
     void databaseArtistsAdded(const ListArtistDataType &newData);
 
-    void databaseArtistRemoved(qulonglong removedDatabaseId);
+    void databaseArtistsRemoved(const QList<qulonglong> &removedDatabaseIds);
 
     void databaseAlbumsAdded(const ListAlbumDataType &newData);
 
-    void databaseAlbumRemoved(qulonglong removedDatabaseId);
+    void databaseAlbumsRemoved(const QList<qulonglong> &removedDatabaseIds);
 
     void databaseAlbumModified(const AlbumDataType &modifiedAlbum);
 
@@ -18,6 +18,8 @@
 
 #include "abstractmediaproxymodel.h"
 
+#include "datamodel.h"
+
 #include <QWriteLocker>
 
 AbstractMediaProxyModel::AbstractMediaProxyModel(QObject *parent) : QSortFilterProxyModel(parent)
@@ -52,11 +54,66 @@ void AbstractMediaProxyModel::setFilterText(const QString &filterText)
     mFilterExpression.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
     mFilterExpression.optimize();
 
-    invalidate();
+    if (mSearchModel && !mFilterText.isEmpty()) {
+        // the filter is applied once the search index has answered
+        mSearchModel->search(mFilterText);
+    } else {
+        mUseFilterIds = false;
+        invalidate();
+    }
 
     Q_EMIT filterTextChanged(mFilterText);
 }
 
+void AbstractMediaProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (mSearchModel) {
+        disconnect(mSearchModel, nullptr, this, nullptr);
+    }
+
+    mSearchModel = qobject_cast<DataModel*>(sourceModel);
+
+    if (mSearchModel) {
+        connect(mSearchModel, &DataModel::searchResultsReady,
+                this, &AbstractMediaProxyModel::searchResultsReady);
+        connect(mSearchModel, &DataModel::searchUnavailable,
+                this, &AbstractMediaProxyModel::searchUnavailable);
+    }
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+void AbstractMediaProxyModel::searchResultsReady(const QString &filterText, const QList<qulonglong> &matchingIds)
+{
+    QWriteLocker writeLocker(&mDataLock);
+
+    if (filterText != mFilterText) {
+        return;
+    }
+
+    mFilterIds.clear();
+    mFilterIds.reserve(matchingIds.size());
+    for (auto oneId : matchingIds) {
+        mFilterIds.insert(oneId);
+    }
+    mUseFilterIds = true;
+
+    invalidate();
+}
+
+void AbstractMediaProxyModel::searchUnavailable(const QString &filterText)
+{
+    QWriteLocker writeLocker(&mDataLock);
+
+    if (filterText != mFilterText) {
+        return;
+    }
+
+    mUseFilterIds = false;
+
+    invalidate();
+}
+
 void AbstractMediaProxyModel::setFilterRating(int filterRating)
 {
     QWriteLocker writeLocker(&mDataLock);
@@ -27,6 +27,10 @@
 #include <QRegularExpression>
 #include <QReadWriteLock>
 #include <QThreadPool>
+#include <QPointer>
+#include <QSet>
+
+class DataModel;
 
 class ELISALIB_EXPORT AbstractMediaProxyModel : public QSortFilterProxyModel
 {
@@ -59,6 +63,8 @@ public:
 
     bool sortedAscending() const;
 
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
 public Q_SLOTS:
 
     void setFilterText(const QString &filterText);
@@ -75,6 +81,12 @@ Q_SIGNALS:
 
     void sortedAscendingChanged();
 
+private Q_SLOTS:
+
+    void searchResultsReady(const QString &filterText, const QList<qulonglong> &matchingIds);
+
+    void searchUnavailable(const QString &filterText);
+
 protected:
 
     bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override = 0;
@@ -85,6 +97,12 @@ protected:
 
     QRegularExpression mFilterExpression;
 
+    QSet<qulonglong> mFilterIds;
+
+    bool mUseFilterIds = false;
+
+    QPointer<DataModel> mSearchModel;
+
     QReadWriteLock mDataLock;
 
     QThreadPool mThreadPool;
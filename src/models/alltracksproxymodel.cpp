@@ -46,6 +46,11 @@ bool AllTracksProxyModel::filterAcceptsRow(int source_row, const QModelIndex &so
             continue;
         }
 
+        if (mUseFilterIds) {
+            result = mFilterIds.contains(sourceModel()->data(currentIndex, DatabaseInterface::ColumnsRoles::DatabaseIdRole).toULongLong());
+            continue;
+        }
+
         if (mFilterExpression.match(titleValue).hasMatch()) {
             result = true;
             continue;
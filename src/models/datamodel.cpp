@@ -19,6 +19,7 @@
 
 #include "modeldataloader.h"
 #include "musiclistenersmanager.h"
+#include "collectionsnapshot.h"
 
 #include <QUrl>
 #include <QTimer>
@@ -28,10 +29,20 @@
 
 #include <algorithm>
 
+template <typename DataListType>
+static void indexRows(QHash<qulonglong, int> &rowFromDatabaseId, const DataListType &data, int firstRow)
+{
+    for (int row = firstRow; row < data.size(); ++row) {
+        rowFromDatabaseId[data[row].databaseId()] = row;
+    }
+}
+
 class DataModelPrivate
 {
 public:
 
+    static constexpr int PageSize = 500;
+
     DataModel::ListTrackDataType mAllTrackData;
 
     DataModel::ListAlbumDataType mAllAlbumData;
@@ -40,6 +51,8 @@ public:
 
     DataModel::ListGenreDataType mAllGenreData;
 
+    QHash<qulonglong, int> mRowFromDatabaseId;
+
     ModelDataLoader mDataLoader;
 
     ElisaUtils::PlayListEntryType mModelType = ElisaUtils::Unknown;
@@ -56,8 +69,20 @@ public:
 
     qulonglong mDatabaseId = 0;
 
+    QString mLastPageTitle;
+
+    qulonglong mLastPageDatabaseId = 0;
+
     bool mIsBusy = false;
 
+    bool mIsPaginated = false;
+
+    bool mCanFetchMore = false;
+
+    bool mIsFetchingMore = false;
+
+    MusicListenersManager *mCollectionSnapshotManager = nullptr;
+
 };
 
 DataModel::DataModel(QObject *parent) : QAbstractListModel(parent), d(std::make_unique<DataModelPrivate>())
@@ -134,7 +159,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
         switch(d->mModelType)
         {
         case ElisaUtils::Track:
-            result = d->mAllTrackData[index.row()][TrackDataType::key_type::TitleRole];
+            result = d->mAllTrackData[index.row()].title();
             break;
         case ElisaUtils::Album:
             result = d->mAllAlbumData[index.row()][AlbumDataType::key_type::TitleRole];
@@ -155,7 +180,7 @@ QVariant DataModel::data(const QModelIndex &index, int role) const
     case DatabaseInterface::ColumnsRoles::DurationRole:
     {
         if (d->mModelType == ElisaUtils::Track) {
-            auto trackDuration = d->mAllTrackData[index.row()][TrackDataType::key_type::DurationRole].toTime();
+            auto trackDuration = d->mAllTrackData[index.row()].duration();
             if (trackDuration.hour() == 0) {
                 result = trackDuration.toString(QStringLiteral("mm:ss"));
             } else {
@@ -216,6 +241,26 @@ QModelIndex DataModel::parent(const QModelIndex &child) const
     return result;
 }
 
+bool DataModel::canFetchMore(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return false;
+    }
+
+    return d->mIsPaginated && d->mCanFetchMore && !d->mIsFetchingMore;
+}
+
+void DataModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent)) {
+        return;
+    }
+
+    d->mIsFetchingMore = true;
+
+    Q_EMIT needDataPage(d->mModelType, d->mLastPageTitle, d->mLastPageDatabaseId, DataModelPrivate::PageSize);
+}
+
 QString DataModel::title() const
 {
     return d->mAlbumTitle;
@@ -231,6 +276,16 @@ bool DataModel::isBusy() const
     return d->mIsBusy;
 }
 
+void DataModel::search(const QString &filterText)
+{
+    if (d->mFilterType == Unknown) {
+        Q_EMIT searchUnavailable(filterText);
+        return;
+    }
+
+    Q_EMIT needSearch(d->mModelType, filterText);
+}
+
 void DataModel::initialize(MusicListenersManager *manager, DatabaseInterface *database,
                            ElisaUtils::PlayListEntryType modelType)
 {
@@ -298,6 +353,8 @@ void DataModel::initializeModel(MusicListenersManager *manager, DatabaseInterfac
 {
     d->mModelType = modelType;
     d->mFilterType = type;
+    d->mIsPaginated = (d->mFilterType == NoFilter &&
+                       (d->mModelType == ElisaUtils::Track || d->mModelType == ElisaUtils::Album || d->mModelType == ElisaUtils::Artist));
 
     if (manager) {
         manager->connectModel(&d->mDataLoader);
@@ -314,8 +371,13 @@ void DataModel::initializeModel(MusicListenersManager *manager, DatabaseInterfac
     switch(d->mFilterType)
     {
     case NoFilter:
-        connect(this, &DataModel::needData,
-                &d->mDataLoader, &ModelDataLoader::loadData);
+        if (d->mIsPaginated) {
+            connect(this, &DataModel::needDataPage,
+                    &d->mDataLoader, &ModelDataLoader::loadDataPage);
+        } else {
+            connect(this, &DataModel::needData,
+                    &d->mDataLoader, &ModelDataLoader::loadData);
+        }
         break;
     case FilterById:
         connect(this, &DataModel::needDataById,
@@ -347,6 +409,81 @@ void DataModel::initializeModel(MusicListenersManager *manager, DatabaseInterfac
 
     setBusy(true);
 
+    if (fillFromCollectionSnapshot(manager)) {
+        return;
+    }
+
+    if (manager && d->mFilterType == NoFilter && manager->collectionSnapshotIsLoading()) {
+        d->mCollectionSnapshotManager = manager;
+        connect(manager, &MusicListenersManager::collectionSnapshotReady,
+                this, &DataModel::collectionSnapshotReady);
+        return;
+    }
+
+    askModelData();
+}
+
+bool DataModel::fillFromCollectionSnapshot(MusicListenersManager *manager)
+{
+    if (!manager || d->mFilterType != NoFilter) {
+        return false;
+    }
+
+    const auto *snapshot = manager->collectionSnapshot();
+    if (!snapshot) {
+        return false;
+    }
+
+    // the snapshot holds complete lists, there is no page left to fetch
+    d->mCanFetchMore = false;
+    d->mIsFetchingMore = false;
+
+    switch(d->mModelType)
+    {
+    case ElisaUtils::Album:
+        albumsAdded(snapshot->allAlbums());
+        break;
+    case ElisaUtils::Artist:
+        artistsAdded(snapshot->allArtists());
+        break;
+    case ElisaUtils::Genre:
+        genresAdded(snapshot->allGenres());
+        break;
+    case ElisaUtils::Track:
+        tracksAdded(snapshot->allTracks());
+        break;
+    case ElisaUtils::Composer:
+    case ElisaUtils::Lyricist:
+    case ElisaUtils::FileName:
+    case ElisaUtils::Unknown:
+        return false;
+    }
+
+    connect(manager, &MusicListenersManager::collectionSnapshotInvalidated,
+            this, &DataModel::collectionSnapshotInvalidated);
+
+    return true;
+}
+
+void DataModel::collectionSnapshotReady()
+{
+    disconnect(d->mCollectionSnapshotManager, &MusicListenersManager::collectionSnapshotReady,
+               this, &DataModel::collectionSnapshotReady);
+
+    // change notifications received while the snapshot was loading would be mixed with it
+    if (rowCount() == 0 && fillFromCollectionSnapshot(d->mCollectionSnapshotManager)) {
+        return;
+    }
+
+    collectionSnapshotInvalidated();
+}
+
+void DataModel::collectionSnapshotInvalidated()
+{
+    cleanedDatabase();
+
+    setBusy(true);
+
     askModelData();
 }
 
@@ -355,7 +492,12 @@ void DataModel::askModelData()
     switch(d->mFilterType)
     {
     case NoFilter:
-        Q_EMIT needData(d->mModelType);
+        if (d->mIsPaginated) {
+            d->mIsFetchingMore = true;
+            Q_EMIT needDataPage(d->mModelType, {}, 0, DataModelPrivate::PageSize);
+        } else {
+            Q_EMIT needData(d->mModelType);
+        }
         break;
     case FilterById:
         Q_EMIT needDataById(d->mModelType, d->mDatabaseId);
@@ -380,19 +522,9 @@ void DataModel::askModelData()
     }
 }
 
-int DataModel::trackIndexFromId(qulonglong id) const
+int DataModel::rowFromDatabaseId(qulonglong id) const
 {
-    int result;
-
-    for (result = 0; result < d->mAllTrackData.size(); ++result) {
-        if (d->mAllTrackData[result].databaseId() == id) {
-            return result;
-        }
-    }
-
-    result = -1;
-
-    return result;
+    return d->mRowFromDatabaseId.value(id, -1);
 }
 
 void DataModel::connectModel(DatabaseInterface *database)
@@ -407,24 +539,36 @@ void DataModel::connectModel(DatabaseInterface *database)
             this, &DataModel::artistsAdded);
     connect(&d->mDataLoader, &ModelDataLoader::allGenresData,
             this, &DataModel::genresAdded);
+    connect(&d->mDataLoader, &ModelDataLoader::tracksPageData,
+            this, &DataModel::tracksPageLoaded);
+    connect(&d->mDataLoader, &ModelDataLoader::albumsPageData,
+            this, &DataModel::albumsPageLoaded);
+    connect(&d->mDataLoader, &ModelDataLoader::artistsPageData,
+            this, &DataModel::artistsPageLoaded);
+    connect(this, &DataModel::needSearch,
+            &d->mDataLoader, &ModelDataLoader::searchData);
+    connect(&d->mDataLoader, &ModelDataLoader::searchResultsData,
+            this, &DataModel::searchResultsReady);
+    connect(&d->mDataLoader, &ModelDataLoader::searchUnavailable,
+            this, &DataModel::searchUnavailable);
     connect(&d->mDataLoader, &ModelDataLoader::genresAdded,
             this, &DataModel::genresAdded);
     connect(&d->mDataLoader, &ModelDataLoader::albumsAdded,
             this, &DataModel::albumsAdded);
     connect(&d->mDataLoader, &ModelDataLoader::albumModified,
             this, &DataModel::albumModified);
-    connect(&d->mDataLoader, &ModelDataLoader::albumRemoved,
-            this, &DataModel::albumRemoved);
+    connect(&d->mDataLoader, &ModelDataLoader::albumsRemoved,
+            this, &DataModel::albumsRemoved);
     connect(&d->mDataLoader, &ModelDataLoader::tracksAdded,
             this, &DataModel::tracksAdded);
-    connect(&d->mDataLoader, &ModelDataLoader::trackModified,
-            this, &DataModel::trackModified);
-    connect(&d->mDataLoader, &ModelDataLoader::trackRemoved,
-            this, &DataModel::trackRemoved);
+    connect(&d->mDataLoader, &ModelDataLoader::tracksModified,
+            this, &DataModel::tracksModified);
+    connect(&d->mDataLoader, &ModelDataLoader::tracksRemoved,
+            this, &DataModel::tracksRemoved);
     connect(&d->mDataLoader, &ModelDataLoader::artistsAdded,
             this, &DataModel::artistsAdded);
-    connect(&d->mDataLoader, &ModelDataLoader::artistRemoved,
-            this, &DataModel::artistRemoved);
+    connect(&d->mDataLoader, &ModelDataLoader::artistsRemoved,
+            this, &DataModel::artistsRemoved);
 }
 
 void DataModel::tracksAdded(ListTrackDataType newData)
@@ -439,122 +583,144 @@ void DataModel::tracksAdded(ListTrackDataType newData)
 
     if (d->mFilterType == FilterById && !d->mAllTrackData.isEmpty()) {
         for (const auto &newTrack : newData) {
-            auto trackIndex = trackIndexFromId(newTrack.databaseId());
-
-            if (trackIndex != -1) {
+            if (d->mRowFromDatabaseId.contains(newTrack.databaseId())) {
                 continue;
             }
 
-            bool trackInserted = false;
+            auto insertionRow = d->mAllTrackData.count();
             for (int trackIndex = 0; trackIndex < d->mAllTrackData.count(); ++trackIndex) {
                 const auto &oneTrack = d->mAllTrackData[trackIndex];
 
                 if (oneTrack.discNumber() >= newTrack.discNumber() && oneTrack.trackNumber() > newTrack.trackNumber()) {
-                    beginInsertRows({}, trackIndex, trackIndex);
-                    d->mAllTrackData.insert(trackIndex, newTrack);
-                    endInsertRows();
-
-                    if (d->mAllTrackData.size() == 1) {
-                        setBusy(false);
-                    }
-
-                    trackInserted = true;
+                    insertionRow = trackIndex;
                     break;
                 }
             }
 
-            if (!trackInserted) {
-                beginInsertRows({}, d->mAllTrackData.count(), d->mAllTrackData.count());
-                d->mAllTrackData.insert(d->mAllTrackData.count(), newTrack);
-                endInsertRows();
+            beginInsertRows({}, insertionRow, insertionRow);
+            d->mAllTrackData.insert(insertionRow, newTrack);
+            indexRows(d->mRowFromDatabaseId, d->mAllTrackData, insertionRow);
+            endInsertRows();
 
-                if (d->mAllTrackData.size() == 1) {
-                    setBusy(false);
-                }
+            if (d->mAllTrackData.size() == 1) {
+                setBusy(false);
             }
         }
     } else {
         if (d->mAllTrackData.isEmpty()) {
             beginInsertRows({}, 0, newData.size() - 1);
             d->mAllTrackData.swap(newData);
+            indexRows(d->mRowFromDatabaseId, d->mAllTrackData, 0);
             endInsertRows();
 
             setBusy(false);
         } else {
-            beginInsertRows({}, d->mAllTrackData.size(), d->mAllTrackData.size() + newData.size() - 1);
+            const auto firstNewRow = d->mAllTrackData.size();
+            beginInsertRows({}, firstNewRow, firstNewRow + newData.size() - 1);
             d->mAllTrackData.append(newData);
+            indexRows(d->mRowFromDatabaseId, d->mAllTrackData, firstNewRow);
             endInsertRows();
         }
     }
 }
 
 void DataModel::trackModified(const TrackDataType &modifiedTrack)
+{
+    tracksModified({modifiedTrack});
+}
+
+void DataModel::tracksModified(const ListTrackDataType &modifiedTracks)
 {
     if (d->mModelType != ElisaUtils::Track) {
         return;
     }
 
-    if (!d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty()) {
-        if (modifiedTrack.album() != d->mAlbumTitle) {
-            return;
+    const auto filterByAlbum = !d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty();
+
+    QVector<int> modifiedRows;
+    modifiedRows.reserve(modifiedTracks.size());
+
+    for (const auto &oneTrack : modifiedTracks) {
+        if (filterByAlbum && oneTrack.album() != d->mAlbumTitle) {
+            continue;
         }
 
-        auto trackIndex = trackIndexFromId(modifiedTrack.databaseId());
+        const auto trackIndex = rowFromDatabaseId(oneTrack.databaseId());
 
         if (trackIndex == -1) {
-            return;
+            continue;
         }
 
-        d->mAllTrackData[trackIndex] = modifiedTrack;
-        Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
-    } else {
-        auto itTrack = std::find_if(d->mAllTrackData.begin(), d->mAllTrackData.end(),
-                                    [modifiedTrack](auto track) {
-            return track.databaseId() == modifiedTrack.databaseId();
-        });
+        d->mAllTrackData[trackIndex] = oneTrack;
+        modifiedRows.push_back(trackIndex);
+    }
 
-        if (itTrack == d->mAllTrackData.end()) {
-            return;
-        }
+    std::sort(modifiedRows.begin(), modifiedRows.end());
 
-        auto position = itTrack - d->mAllTrackData.begin();
+    for (int rangeStart = 0; rangeStart < modifiedRows.size(); ) {
+        auto rangeEnd = rangeStart;
+        while (rangeEnd + 1 < modifiedRows.size() && modifiedRows[rangeEnd + 1] <= modifiedRows[rangeEnd] + 1) {
+            ++rangeEnd;
+        }
 
-        d->mAllTrackData[position] = modifiedTrack;
+        Q_EMIT dataChanged(index(modifiedRows[rangeStart], 0), index(modifiedRows[rangeEnd], 0));
 
-        Q_EMIT dataChanged(index(position, 0), index(position, 0));
+        rangeStart = rangeEnd + 1;
     }
 }
 
 void DataModel::trackRemoved(qulonglong removedTrackId)
+{
+    tracksRemoved({removedTrackId});
+}
+
+void DataModel::tracksRemoved(const QList<qulonglong> &removedTracksIds)
 {
     if (d->mModelType != ElisaUtils::Track) {
         return;
     }
 
-    if (!d->mAlbumTitle.isEmpty() && !d->mAlbumArtist.isEmpty()) {
-        auto trackIndex = trackIndexFromId(removedTrackId);
+    removeRowsFromDatabaseIds(d->mAllTrackData, removedTracksIds);
+}
+
+template <typename DataListType>
+void DataModel::removeRowsFromDatabaseIds(DataListType &allData, const QList<qulonglong> &removedDatabaseIds)
+{
+    QVector<int> removedRows;
+    removedRows.reserve(removedDatabaseIds.size());
 
-        if (trackIndex == -1) {
-            return;
+    for (auto oneDatabaseId : removedDatabaseIds) {
+        const auto dataIndex = rowFromDatabaseId(oneDatabaseId);
+
+        if (dataIndex == -1) {
+            continue;
         }
 
-        beginRemoveRows({}, trackIndex, trackIndex);
-        d->mAllTrackData.removeAt(trackIndex);
-        endRemoveRows();
-    } else {
-        auto itTrack = std::find_if(d->mAllTrackData.begin(), d->mAllTrackData.end(),
-                                    [removedTrackId](auto track) {return track.databaseId() == removedTrackId;});
+        d->mRowFromDatabaseId.remove(oneDatabaseId);
+        removedRows.push_back(dataIndex);
+    }
 
-        if (itTrack == d->mAllTrackData.end()) {
-            return;
-        }
+    if (removedRows.isEmpty()) {
+        return;
+    }
 
-        auto position = itTrack - d->mAllTrackData.begin();
+    std::sort(removedRows.begin(), removedRows.end());
 
-        beginRemoveRows({}, position, position);
-        d->mAllTrackData.erase(itTrack);
+    for (int rangeEnd = removedRows.size() - 1; rangeEnd >= 0; ) {
+        auto rangeStart = rangeEnd;
+        while (rangeStart > 0 && removedRows[rangeStart - 1] == removedRows[rangeStart] - 1) {
+            --rangeStart;
+        }
+
+        beginRemoveRows({}, removedRows[rangeStart], removedRows[rangeEnd]);
+        allData.erase(allData.begin() + removedRows[rangeStart],
+                      allData.begin() + removedRows[rangeEnd] + 1);
         endRemoveRows();
+
+        rangeEnd = rangeStart - 1;
     }
+
+    indexRows(d->mRowFromDatabaseId, allData, removedRows.first());
 }
 
 void DataModel::genresAdded(DataModel::ListGenreDataType newData)
@@ -570,12 +736,15 @@ void DataModel::genresAdded(DataModel::ListGenreDataType newData)
     if (d->mAllGenreData.isEmpty()) {
         beginInsertRows({}, d->mAllGenreData.size(), newData.size() - 1);
         d->mAllGenreData.swap(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllGenreData, 0);
         endInsertRows();
 
         setBusy(false);
     } else {
-        beginInsertRows({}, d->mAllGenreData.size(), d->mAllGenreData.size() + newData.size() - 1);
+        const auto firstNewRow = d->mAllGenreData.size();
+        beginInsertRows({}, firstNewRow, firstNewRow + newData.size() - 1);
         d->mAllGenreData.append(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllGenreData, firstNewRow);
         endInsertRows();
     }
 }
@@ -593,38 +762,31 @@ void DataModel::artistsAdded(DataModel::ListArtistDataType newData)
     if (d->mAllArtistData.isEmpty()) {
         beginInsertRows({}, d->mAllArtistData.size(), newData.size() - 1);
         d->mAllArtistData.swap(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllArtistData, 0);
         endInsertRows();
 
         setBusy(false);
     } else {
-        beginInsertRows({}, d->mAllArtistData.size(), d->mAllArtistData.size() + newData.size() - 1);
+        const auto firstNewRow = d->mAllArtistData.size();
+        beginInsertRows({}, firstNewRow, firstNewRow + newData.size() - 1);
         d->mAllArtistData.append(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllArtistData, firstNewRow);
         endInsertRows();
     }
 }
 
 void DataModel::artistRemoved(qulonglong removedDatabaseId)
 {
-    if (d->mModelType != ElisaUtils::Artist) {
-        return;
-    }
-
-    auto removedDataIterator = d->mAllArtistData.end();
-
-    removedDataIterator = std::find_if(d->mAllArtistData.begin(), d->mAllArtistData.end(),
-                                       [removedDatabaseId](auto album) {return album.databaseId() == removedDatabaseId;});
+    artistsRemoved({removedDatabaseId});
+}
 
-    if (removedDataIterator == d->mAllArtistData.end()) {
+void DataModel::artistsRemoved(const QList<qulonglong> &removedDatabaseIds)
+{
+    if (d->mModelType != ElisaUtils::Artist) {
         return;
     }
 
-    int dataIndex = removedDataIterator - d->mAllArtistData.begin();
-
-    beginRemoveRows({}, dataIndex, dataIndex);
-
-    d->mAllArtistData.erase(removedDataIterator);
-
-    endRemoveRows();
+    removeRowsFromDatabaseIds(d->mAllArtistData, removedDatabaseIds);
 }
 
 void DataModel::albumsAdded(DataModel::ListAlbumDataType newData)
@@ -640,38 +802,31 @@ void DataModel::albumsAdded(DataModel::ListAlbumDataType newData)
     if (d->mAllAlbumData.isEmpty()) {
         beginInsertRows({}, d->mAllAlbumData.size(), newData.size() - 1);
         d->mAllAlbumData.swap(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllAlbumData, 0);
         endInsertRows();
 
         setBusy(false);
     } else {
-        beginInsertRows({}, d->mAllAlbumData.size(), d->mAllAlbumData.size() + newData.size() - 1);
+        const auto firstNewRow = d->mAllAlbumData.size();
+        beginInsertRows({}, firstNewRow, firstNewRow + newData.size() - 1);
         d->mAllAlbumData.append(newData);
+        indexRows(d->mRowFromDatabaseId, d->mAllAlbumData, firstNewRow);
         endInsertRows();
     }
 }
 
 void DataModel::albumRemoved(qulonglong removedDatabaseId)
 {
-    if (d->mModelType != ElisaUtils::Album) {
-        return;
-    }
-
-    auto removedDataIterator = d->mAllAlbumData.end();
-
-    removedDataIterator = std::find_if(d->mAllAlbumData.begin(), d->mAllAlbumData.end(),
-                                       [removedDatabaseId](auto album) {return album.databaseId() == removedDatabaseId;});
+    albumsRemoved({removedDatabaseId});
+}
 
-    if (removedDataIterator == d->mAllAlbumData.end()) {
+void DataModel::albumsRemoved(const QList<qulonglong> &removedDatabaseIds)
+{
+    if (d->mModelType != ElisaUtils::Album) {
         return;
     }
 
-    int dataIndex = removedDataIterator - d->mAllAlbumData.begin();
-
-    beginRemoveRows({}, dataIndex, dataIndex);
-
-    d->mAllAlbumData.erase(removedDataIterator);
-
-    endRemoveRows();
+    removeRowsFromDatabaseIds(d->mAllAlbumData, removedDatabaseIds);
 }
 
 void DataModel::albumModified(const DataModel::AlbumDataType &modifiedAlbum)
@@ -680,17 +835,12 @@ void DataModel::albumModified(const DataModel::AlbumDataType &modifiedAlbum)
         return;
     }
 
-    auto modifiedAlbumIterator = std::find_if(d->mAllAlbumData.begin(), d->mAllAlbumData.end(),
-                                              [modifiedAlbum](auto album) {
-        return album.databaseId() == modifiedAlbum.databaseId();
-    });
+    const auto albumIndex = rowFromDatabaseId(modifiedAlbum.databaseId());
 
-    if (modifiedAlbumIterator == d->mAllAlbumData.end()) {
+    if (albumIndex == -1) {
         return;
     }
 
-    auto albumIndex = modifiedAlbumIterator - d->mAllAlbumData.begin();
-
     Q_EMIT dataChanged(index(albumIndex, 0), index(albumIndex, 0));
 }
 
@@ -701,7 +851,53 @@ void DataModel::cleanedDatabase()
     d->mAllGenreData.clear();
     d->mAllTrackData.clear();
     d->mAllArtistData.clear();
+    d->mRowFromDatabaseId.clear();
+    d->mLastPageTitle.clear();
+    d->mLastPageDatabaseId = 0;
+    d->mCanFetchMore = false;
     endResetModel();
 }
 
+template <typename DataListType>
+DataListType DataModel::startNextPage(const DataListType &pageData)
+{
+    d->mIsFetchingMore = false;
+    d->mCanFetchMore = (pageData.size() == DataModelPrivate::PageSize);
+
+    if (!pageData.isEmpty()) {
+        d->mLastPageTitle = pageData.last().title();
+        d->mLastPageDatabaseId = pageData.last().databaseId();
+    }
+
+    // rows beyond the loaded pages may already have been added by a change notification
+    auto newData = DataListType{};
+    newData.reserve(pageData.size());
+    for (const auto &oneData : pageData) {
+        if (!d->mRowFromDatabaseId.contains(oneData.databaseId())) {
+            newData.push_back(oneData);
+        }
+    }
+
+    if (newData.isEmpty() && d->mCanFetchMore) {
+        fetchMore({});
+    }
+
+    return newData;
+}
+
+void DataModel::tracksPageLoaded(const DataModel::ListTrackDataType &pageData)
+{
+    tracksAdded(startNextPage(pageData));
+}
+
+void DataModel::albumsPageLoaded(const DataModel::ListAlbumDataType &pageData)
+{
+    albumsAdded(startNextPage(pageData));
+}
+
+void DataModel::artistsPageLoaded(const DataModel::ListArtistDataType &pageData)
+{
+    artistsAdded(startNextPage(pageData));
+}
+
 #include "moc_datamodel.cpp"
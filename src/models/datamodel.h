@@ -95,12 +95,18 @@ public:
 
     QModelIndex parent(const QModelIndex &child) const override;
 
+    bool canFetchMore(const QModelIndex &parent) const override;
+
+    void fetchMore(const QModelIndex &parent) override;
+
     QString title() const;
 
     QString author() const;
 
     bool isBusy() const;
 
+    void search(const QString &filterText);
+
 Q_SIGNALS:
 
     void titleChanged();
@@ -109,6 +115,9 @@ Q_SIGNALS:
 
     void needData(ElisaUtils::PlayListEntryType dataType);
 
+    void needDataPage(ElisaUtils::PlayListEntryType dataType, const QString &afterTitle,
+                      qulonglong afterDatabaseId, int count);
+
     void needDataById(ElisaUtils::PlayListEntryType dataType, qulonglong databaseId);
 
     void needDataByGenre(ElisaUtils::PlayListEntryType dataType, const QString &genre);
@@ -124,24 +133,38 @@ Q_SIGNALS:
 
     void isBusyChanged();
 
+    void needSearch(ElisaUtils::PlayListEntryType dataType, const QString &filterText);
+
+    void searchResultsReady(const QString &filterText, const QList<qulonglong> &matchingIds);
+
+    void searchUnavailable(const QString &filterText);
+
 public Q_SLOTS:
 
     void tracksAdded(DataModel::ListTrackDataType newData);
 
     void trackModified(const DataModel::TrackDataType &modifiedTrack);
 
+    void tracksModified(const DataModel::ListTrackDataType &modifiedTracks);
+
     void trackRemoved(qulonglong removedTrackId);
 
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
     void genresAdded(DataModel::ListGenreDataType newData);
 
     void artistsAdded(DataModel::ListArtistDataType newData);
 
     void artistRemoved(qulonglong removedDatabaseId);
 
+    void artistsRemoved(const QList<qulonglong> &removedDatabaseIds);
+
     void albumsAdded(DataModel::ListAlbumDataType newData);
 
     void albumRemoved(qulonglong removedDatabaseId);
 
+    void albumsRemoved(const QList<qulonglong> &removedDatabaseIds);
+
     void albumModified(const DataModel::AlbumDataType &modifiedAlbum);
 
     void initialize(MusicListenersManager *manager, DatabaseInterface *database,
@@ -170,9 +193,19 @@ private Q_SLOTS:
 
     void cleanedDatabase();
 
+    void collectionSnapshotReady();
+
+    void collectionSnapshotInvalidated();
+
+    void tracksPageLoaded(const DataModel::ListTrackDataType &pageData);
+
+    void albumsPageLoaded(const DataModel::ListAlbumDataType &pageData);
+
+    void artistsPageLoaded(const DataModel::ListArtistDataType &pageData);
+
 private:
 
-    int trackIndexFromId(qulonglong id) const;
+    int rowFromDatabaseId(qulonglong id) const;
 
     void connectModel(DatabaseInterface *database);
 
@@ -183,6 +216,14 @@ private:
 
     void askModelData();
 
+    bool fillFromCollectionSnapshot(MusicListenersManager *manager);
+
+    template <typename DataListType>
+    DataListType startNextPage(const DataListType &pageData);
+
+    template <typename DataListType>
+    void removeRowsFromDatabaseIds(DataListType &allData, const QList<qulonglong> &removedDatabaseIds);
+
     std::unique_ptr<DataModelPrivate> d;
 
 };
@@ -55,6 +55,11 @@ bool GridViewProxyModel::filterAcceptsRow(int source_row, const QModelIndex &sou
         return result;
     }
 
+    if (mUseFilterIds) {
+        result = mFilterIds.contains(sourceModel()->data(currentIndex, DatabaseInterface::DatabaseIdRole).toULongLong());
+        return result;
+    }
+
     if (mFilterExpression.match(mainValue).hasMatch()) {
         result = true;
         return result;
@@ -41,6 +41,11 @@ bool SingleAlbumProxyModel::filterAcceptsRow(int source_row, const QModelIndex &
         return result;
     }
 
+    if (mUseFilterIds) {
+        result = mFilterIds.contains(sourceModel()->data(currentIndex, DatabaseInterface::ColumnsRoles::DatabaseIdRole).toULongLong());
+        return result;
+    }
+
     if (mFilterExpression.match(titleValue).hasMatch()) {
         result = true;
     }
@@ -18,9 +18,12 @@
 #include "trackmetadatamodel.h"
 
 #include "musiclistenersmanager.h"
+#include "filescanner.h"
 
 #include <KI18n/KLocalizedString>
 
+#include <QMimeDatabase>
+
 #include <QtConcurrent/QtConcurrentRun>
 
 TrackMetadataModel::TrackMetadataModel(QObject *parent)
@@ -257,7 +260,7 @@ MusicListenersManager *TrackMetadataModel::manager() const
 
 QString TrackMetadataModel::lyrics() const
 {
-    return mFullData[TrackDataType::key_type::LyricsRole].toString();
+    return mFullData.lyrics();
 }
 
 void TrackMetadataModel::trackData(const TrackMetadataModel::TrackDataType &trackData)
@@ -281,7 +284,7 @@ void TrackMetadataModel::fillDataFromTrackData(const TrackMetadataModel::TrackDa
          DatabaseInterface::RatingRole, DatabaseInterface::GenreRole, DatabaseInterface::LyricistRole,
          DatabaseInterface::ComposerRole, DatabaseInterface::CommentRole, DatabaseInterface::YearRole,
          DatabaseInterface::LastPlayDate, DatabaseInterface::PlayCounter}) {
-        if (trackData.constFind(role) != trackData.constEnd()) {
+        if (trackData.contains(role)) {
             if (role == DatabaseInterface::RatingRole) {
                 if (trackData[role].toInt() == 0) {
                     continue;
@@ -289,13 +292,17 @@ void TrackMetadataModel::fillDataFromTrackData(const TrackMetadataModel::TrackDa
             }
 
             mTrackKeys.push_back(role);
-            mTrackData[role] = trackData[role];
+            mTrackData.insert(role, trackData[role]);
         }
     }
     filterDataFromTrackData();
     endResetModel();
 
-    fetchLyrics();
+    if (mHasDatabase && trackData.databaseId() != 0) {
+        Q_EMIT needLyricsByDatabaseId(trackData.databaseId());
+    } else {
+        fetchLyrics();
+    }
 
     mCoverImage = trackData[DatabaseInterface::ImageUrlRole].toUrl();
     Q_EMIT coverUrlChanged();
@@ -334,19 +341,44 @@ void TrackMetadataModel::fillLyricsDataFromTrack()
 {
     beginInsertRows({}, mTrackData.size(), mTrackData.size());
     mTrackKeys.push_back(DatabaseInterface::LyricsRole);
-    mTrackData[DatabaseInterface::LyricsRole] = mLyricsValueWatcher.result();
+    mTrackData.insert(DatabaseInterface::LyricsRole, mFullData.lyrics());
     endInsertRows();
 }
 
 void TrackMetadataModel::lyricsValueIsReady()
 {
-    if (!mLyricsValueWatcher.result().isEmpty()) {
-        fillLyricsDataFromTrack();
+    setLyricsValue(mLyricsValueWatcher.result());
+}
+
+void TrackMetadataModel::trackLyricsData(qulonglong databaseId, const QString &lyrics)
+{
+    if (databaseId != mFullData.databaseId()) {
+        return;
+    }
 
-        mFullData[DatabaseInterface::LyricsRole] = mLyricsValueWatcher.result();
+    setLyricsValue(lyrics);
+}
 
-        Q_EMIT lyricsChanged();
+void TrackMetadataModel::trackLyricsUnavailable(qulonglong databaseId)
+{
+    if (databaseId != mFullData.databaseId()) {
+        return;
     }
+
+    fetchLyrics();
+}
+
+void TrackMetadataModel::setLyricsValue(const QString &lyrics)
+{
+    if (lyrics.isEmpty()) {
+        return;
+    }
+
+    mFullData.setLyrics(lyrics);
+
+    fillLyricsDataFromTrack();
+
+    Q_EMIT lyricsChanged();
 }
 
 void TrackMetadataModel::initialize(MusicListenersManager *newManager, DatabaseInterface *trackDatabase)
@@ -360,6 +392,8 @@ void TrackMetadataModel::initialize(MusicListenersManager *newManager, DatabaseI
         mDataLoader.setDatabase(trackDatabase);
     }
 
+    mHasDatabase = mManager || trackDatabase;
+
     if (mManager) {
         mManager->connectModel(&mDataLoader);
     }
@@ -368,6 +402,12 @@ void TrackMetadataModel::initialize(MusicListenersManager *newManager, DatabaseI
             &mDataLoader, &ModelDataLoader::loadDataByDatabaseId);
     connect(this, &TrackMetadataModel::needDataByFileName,
             &mDataLoader, &ModelDataLoader::loadDataByFileName);
+    connect(this, &TrackMetadataModel::needLyricsByDatabaseId,
+            &mDataLoader, &ModelDataLoader::loadTrackLyrics);
+    connect(&mDataLoader, &ModelDataLoader::trackLyricsData,
+            this, &TrackMetadataModel::trackLyricsData);
+    connect(&mDataLoader, &ModelDataLoader::trackLyricsUnavailable,
+            this, &TrackMetadataModel::trackLyricsUnavailable);
     connect(&mDataLoader, &ModelDataLoader::allTrackData,
             this, &TrackMetadataModel::trackData);
     connect(&mDataLoader, &ModelDataLoader::trackModified,
@@ -376,15 +416,17 @@ void TrackMetadataModel::initialize(MusicListenersManager *newManager, DatabaseI
 
 void TrackMetadataModel::fetchLyrics()
 {
-    auto lyricicsValue = QtConcurrent::run(QThreadPool::globalInstance(), [=]() {
-        auto trackData = mFileScanner.scanOneFile(mFullData[DatabaseInterface::ResourceRole].toUrl(), mMimeDatabase);
-        if (!trackData.lyrics().isEmpty()) {
-            return trackData.lyrics();
-        }
-        return QString{};
+    const auto &trackUrl = mFullData[DatabaseInterface::ResourceRole].toUrl();
+
+    // each run gets its own scanner, they are not safe to share between threads
+    auto lyricsValue = QtConcurrent::run(QThreadPool::globalInstance(), [trackUrl]() {
+        FileScanner fileScanner;
+        QMimeDatabase mimeDatabase;
+
+        return fileScanner.scanOneFile(trackUrl, mimeDatabase).lyrics();
     });
 
-    mLyricsValueWatcher.setFuture(lyricicsValue);
+    mLyricsValueWatcher.setFuture(lyricsValue);
 }
 
 void TrackMetadataModel::initializeByTrackId(qulonglong databaseId)
@@ -23,11 +23,9 @@
 #include "elisautils.h"
 #include "databaseinterface.h"
 #include "modeldataloader.h"
-#include "filescanner.h"
 
 #include <QUrl>
 #include <QAbstractListModel>
-#include <QMimeDatabase>
 #include <QFutureWatcher>
 
 class MusicListenersManager;
@@ -101,6 +99,8 @@ Q_SIGNALS:
 
     void needDataByFileName(ElisaUtils::PlayListEntryType dataType, const QUrl &fileName);
 
+    void needLyricsByDatabaseId(qulonglong databaseId);
+
     void coverUrlChanged();
 
     void fileUrlChanged();
@@ -137,6 +137,10 @@ private Q_SLOTS:
 
     void lyricsValueIsReady();
 
+    void trackLyricsData(qulonglong databaseId, const QString &lyrics);
+
+    void trackLyricsUnavailable(qulonglong databaseId);
+
 private:
 
     void initialize(MusicListenersManager *newManager,
@@ -144,6 +148,8 @@ private:
 
     void fetchLyrics();
 
+    void setLyricsValue(const QString &lyrics);
+
     TrackDataType mFullData;
 
     TrackDataType mTrackData;
@@ -158,9 +164,7 @@ private:
 
     MusicListenersManager *mManager = nullptr;
 
-    FileScanner mFileScanner;
-
-    QMimeDatabase mMimeDatabase;
+    bool mHasDatabase = false;
 
     QFutureWatcher<QString> mLyricsValueWatcher;
 
@@ -202,7 +202,7 @@ MusicAudioTrack MusicAudioTrack::trackFromData(const DatabaseInterface::TrackDat
     result.setSampleRate(data.sampleRate());
     result.setResourceURI(data.resourceURI());
     result.setRating(data.rating());
-    result.setDuration(data[MusicAudioTrack::TrackDataType::key_type::DurationRole].toTime());
+    result.setDuration(data.duration());
     result.setFileModificationTime(data.fileModificationTime());
 
     return result;
@@ -521,78 +521,78 @@ MusicAudioTrack::TrackDataType MusicAudioTrack::toTrackData() const
 {
     auto result = MusicAudioTrack::TrackDataType{};
 
-    result[MusicAudioTrack::TrackDataType::key_type::DatabaseIdRole] = databaseId();
+    result.setDatabaseId(databaseId());
 
     if (!title().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::TitleRole] = title();
+        result.setTitle(title());
     }
 
     if (!artist().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::ArtistRole] = artist();
+        result.setArtist(artist());
     }
 
     if (!albumName().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::AlbumRole] = albumName();
+        result.setAlbum(albumName());
     }
 
     if (!albumArtist().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::AlbumArtistRole] = albumArtist();
+        result.setAlbumArtist(albumArtist());
     }
 
     if (!genre().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::GenreRole] = genre();
+        result.setGenre(genre());
     }
 
     if (!composer().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::ComposerRole] = composer();
+        result.setComposer(composer());
     }
 
     if (!lyricist().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::LyricistRole] = lyricist();
+        result.setLyricist(lyricist());
     }
 
     if (!comment().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::CommentRole] = comment();
+        result.setComment(comment());
     }
 
     if (!albumCover().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::ImageUrlRole] = albumCover();
+        result.setAlbumCover(albumCover());
     }
 
     if (trackNumber() != -1) {
-        result[MusicAudioTrack::TrackDataType::key_type::TrackNumberRole] = trackNumber();
+        result.setTrackNumber(trackNumber());
     }
 
     if (discNumber()) {
-        result[MusicAudioTrack::TrackDataType::key_type::DiscNumberRole] = discNumber();
+        result.setDiscNumber(discNumber());
     }
 
     if (year()) {
-        result[MusicAudioTrack::TrackDataType::key_type::YearRole] = year();
+        result.setYear(year());
     }
 
     if (channels()) {
-        result[MusicAudioTrack::TrackDataType::key_type::ChannelsRole] = channels();
+        result.setChannels(channels());
     }
 
     if (bitRate()) {
-        result[MusicAudioTrack::TrackDataType::key_type::BitRateRole] = bitRate();
+        result.setBitRate(bitRate());
     }
 
     if (sampleRate()) {
-        result[MusicAudioTrack::TrackDataType::key_type::SampleRateRole] = sampleRate();
+        result.setSampleRate(sampleRate());
     }
 
     if (!resourceURI().isEmpty()) {
-        result[MusicAudioTrack::TrackDataType::key_type::ResourceRole] = resourceURI();
+        result.setResourceURI(resourceURI());
     }
 
     if (rating()) {
-        result[MusicAudioTrack::TrackDataType::key_type::RatingRole] = rating();
+        result.setRating(rating());
     }
 
     if (duration().isValid()) {
-        result[MusicAudioTrack::TrackDataType::key_type::DurationRole] = duration();
+        result.setDuration(duration());
     }
 
     return result;
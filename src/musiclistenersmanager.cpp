@@ -35,6 +35,8 @@
 #endif
 
 #include "databaseinterface.h"
+#include "collectionsnapshot.h"
+#include "albumartstore.h"
 #include "mediaplaylist.h"
 #include "file/filelistener.h"
 #include "file/localfilelisting.h"
@@ -55,18 +57,32 @@
 #include <QScopedPointer>
 #include <QPointer>
 #include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QTimer>
 #include <QAction>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include <QDebug>
 
+#include <array>
 #include <list>
 
 class MusicListenersManagerPrivate
 {
 public:
 
+    ~MusicListenersManagerPrivate()
+    {
+        mCollectionSnapshotWatcher.waitForFinished();
+    }
+
+    static constexpr int ReadOnlyDatabasesCount = 2;
+
     QThread mDatabaseThread;
 
+    std::array<QThread, ReadOnlyDatabasesCount> mReadOnlyDatabaseThreads;
+
     QThread mListenerThread;
 
 #if defined UPNPQT_FOUND && UPNPQT_FOUND
@@ -87,14 +103,34 @@ public:
 
     DatabaseInterface mDatabaseInterface;
 
+    std::array<DatabaseInterface, ReadOnlyDatabasesCount> mReadOnlyDatabases;
+
     std::unique_ptr<TracksListener> mTracksListener;
 
+    CollectionSnapshot mCollectionSnapshot;
+
+    QString mCollectionSnapshotFileName;
+
+    qulonglong mCollectionSnapshotGeneration = 0;
+
+    QFutureWatcher<bool> mCollectionSnapshotWatcher;
+
+    QTimer mCollectionSnapshotTimer;
+
+    bool mCollectionSnapshotIsLoading = false;
+
+    bool mDatabaseIsReady = false;
+
     QFileSystemWatcher mConfigFileWatcher;
 
     ElisaApplication *mElisaApplication = nullptr;
 
     int mImportedTracksCount = 0;
 
+    int mNextReadOnlyDatabase = 0;
+
+    bool mUseReadOnlyDatabases = false;
+
     bool mIndexerBusy = false;
 
     bool mFileSystemIndexerActive = false;
@@ -130,11 +166,58 @@ MusicListenersManager::MusicListenersManager(QObject *parent)
         QDir myDataDirectory;
         myDataDirectory.mkpath(localDataPaths.first());
         databaseFileName = localDataPaths.first() + QStringLiteral("/elisaDatabase.db");
+        d->mCollectionSnapshotFileName = localDataPaths.first() + QStringLiteral("/elisaCollection.snapshot");
     }
 
+    // views can be filled from the snapshot while the database is being opened
+    if (!d->mCollectionSnapshotFileName.isEmpty()) {
+        connect(&d->mCollectionSnapshotWatcher, &QFutureWatcher<bool>::finished,
+                this, &MusicListenersManager::collectionSnapshotLoaded);
+
+        d->mCollectionSnapshotIsLoading = true;
+
+        auto *collectionSnapshot = &d->mCollectionSnapshot;
+        const auto &snapshotFileName = d->mCollectionSnapshotFileName;
+        d->mCollectionSnapshotWatcher.setFuture(QtConcurrent::run(QThreadPool::globalInstance(), [collectionSnapshot, snapshotFileName]() {
+            return collectionSnapshot->load(snapshotFileName);
+        }));
+    }
+
+    // the snapshot is written by the database thread once the collection stops changing
+    d->mCollectionSnapshotTimer.setSingleShot(true);
+    d->mCollectionSnapshotTimer.setInterval(30000);
+
+    connect(&d->mCollectionSnapshotTimer, &QTimer::timeout,
+            this, &MusicListenersManager::writeCollectionSnapshot);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksAdded,
+            &d->mCollectionSnapshotTimer, QOverload<>::of(&QTimer::start));
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksRemoved,
+            &d->mCollectionSnapshotTimer, QOverload<>::of(&QTimer::start));
+    connect(&d->mDatabaseInterface, &DatabaseInterface::cleanedDatabase,
+            &d->mCollectionSnapshotTimer, QOverload<>::of(&QTimer::start));
+
     QMetaObject::invokeMethod(&d->mDatabaseInterface, "init", Qt::QueuedConnection,
                               Q_ARG(QString, QStringLiteral("listeners")), Q_ARG(QString, databaseFileName));
 
+    if (!databaseFileName.isEmpty()) {
+        QMetaObject::invokeMethod(&d->mDatabaseInterface, "initAlbumArtStore", Qt::QueuedConnection,
+                                  Q_ARG(QString, AlbumArtStore::defaultPackFileName()));
+    }
+
+    // an in-memory database cannot be shared between connections, the views then read from the writer
+    d->mUseReadOnlyDatabases = !databaseFileName.isEmpty();
+
+    if (d->mUseReadOnlyDatabases) {
+        // the threads are started by databaseReady() so that the schema exists before any read
+        for (int i = 0; i < MusicListenersManagerPrivate::ReadOnlyDatabasesCount; ++i) {
+            d->mReadOnlyDatabases[i].sharePlayStatisticsJournal(d->mDatabaseInterface);
+            d->mReadOnlyDatabases[i].moveToThread(&d->mReadOnlyDatabaseThreads[i]);
+
+            QMetaObject::invokeMethod(&d->mReadOnlyDatabases[i], "initReadOnly", Qt::QueuedConnection,
+                                      Q_ARG(QString, QStringLiteral("views%1").arg(i)), Q_ARG(QString, databaseFileName));
+        }
+    }
+
     connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
             this, &MusicListenersManager::applicationAboutToQuit);
 
@@ -182,6 +265,7 @@ void MusicListenersManager::subscribeForTracks(MediaPlayList *client)
 {
     createTracksListener();
     connect(d->mTracksListener.get(), &TracksListener::trackHasChanged, client, &MediaPlayList::trackChanged);
+    connect(d->mTracksListener.get(), &TracksListener::tracksHaveChanged, client, &MediaPlayList::tracksChanged);
     connect(d->mTracksListener.get(), &TracksListener::trackHasBeenRemoved, client, &MediaPlayList::trackRemoved);
     connect(d->mTracksListener.get(), &TracksListener::tracksListAdded, client, &MediaPlayList::tracksListAdded);
     connect(client, &MediaPlayList::newEntryInList, d->mTracksListener.get(), &TracksListener::newEntryInList);
@@ -228,8 +312,39 @@ bool MusicListenersManager::androidIndexerAvailable() const
     return d->mAndroidIndexerAvailable;
 }
 
+bool MusicListenersManager::collectionSnapshotIsLoading() const
+{
+    return d->mCollectionSnapshotIsLoading;
+}
+
+const CollectionSnapshot *MusicListenersManager::collectionSnapshot()
+{
+    if (d->mCollectionSnapshotIsLoading || !d->mCollectionSnapshot.isValid()) {
+        return nullptr;
+    }
+
+    if (d->mDatabaseIsReady && !collectionSnapshotMatchesDatabase()) {
+        d->mCollectionSnapshot.clear();
+        return nullptr;
+    }
+
+    return &d->mCollectionSnapshot;
+}
+
 void MusicListenersManager::databaseReady()
 {
+    d->mDatabaseIsReady = true;
+
+    invalidateOutdatedCollectionSnapshot();
+
+    if (d->mUseReadOnlyDatabases) {
+        for (auto &oneThread : d->mReadOnlyDatabaseThreads) {
+            if (!oneThread.isRunning()) {
+                oneThread.start();
+            }
+        }
+    }
+
     configChanged();
 }
 
@@ -237,13 +352,30 @@ void MusicListenersManager::applicationAboutToQuit()
 {
     d->mDatabaseInterface.applicationAboutToQuit();
 
+    d->mCollectionSnapshotTimer.stop();
+
+    if (d->mDatabaseThread.isRunning()) {
+        QMetaObject::invokeMethod(&d->mDatabaseInterface, "flushPlayStatistics", Qt::BlockingQueuedConnection);
+    }
+
     Q_EMIT applicationIsTerminating();
 
     d->mDatabaseThread.exit();
     d->mDatabaseThread.wait();
 
+    for (auto &oneThread : d->mReadOnlyDatabaseThreads) {
+        oneThread.exit();
+        oneThread.wait();
+    }
+
     d->mListenerThread.exit();
     d->mListenerThread.wait();
+
+    d->mDatabaseInterface.dumpStatementStatistics();
+
+    for (const auto &oneDatabase : d->mReadOnlyDatabases) {
+        oneDatabase.dumpStatementStatistics();
+    }
 }
 
 void MusicListenersManager::showConfiguration()
@@ -280,7 +412,16 @@ void MusicListenersManager::playBackError(const QUrl &sourceInError, QMediaPlaye
 
 void MusicListenersManager::connectModel(ModelDataLoader *dataLoader)
 {
-    dataLoader->moveToThread(&d->mDatabaseThread);
+    if (!d->mUseReadOnlyDatabases) {
+        dataLoader->moveToThread(&d->mDatabaseThread);
+        return;
+    }
+
+    auto &readOnlyDatabase = d->mReadOnlyDatabases[d->mNextReadOnlyDatabase];
+    d->mNextReadOnlyDatabase = (d->mNextReadOnlyDatabase + 1) % MusicListenersManagerPrivate::ReadOnlyDatabasesCount;
+
+    dataLoader->setReadOnlyDatabase(&readOnlyDatabase);
+    dataLoader->moveToThread(readOnlyDatabase.thread());
 }
 
 void MusicListenersManager::resetMusicData()
@@ -299,9 +440,11 @@ void MusicListenersManager::configChanged()
 
     const auto &allRootPaths = currentConfiguration->rootPath();
     d->mFileListener.setAllRootPaths(allRootPaths);
+    d->mFileListener.setScalableFileSystemWatcher(currentConfiguration->scalableFileSystemWatcher());
 
 #if defined KF5Baloo_FOUND && KF5Baloo_FOUND
     d->mBalooListener.setAllRootPaths(allRootPaths);
+    d->mBalooListener.setScalableFileSystemWatcher(currentConfiguration->scalableFileSystemWatcher());
 #endif
 
     if (!d->mBalooIndexerActive && !d->mFileSystemIndexerActive) {
@@ -390,6 +533,8 @@ void MusicListenersManager::monitorEndingListeners()
 
     d->mIndexerBusy = false;
     Q_EMIT indexerBusyChanged();
+
+    writeCollectionSnapshot();
 }
 
 void MusicListenersManager::cleanedDatabase()
@@ -498,11 +643,61 @@ void MusicListenersManager::createTracksListener()
         connect(this, &MusicListenersManager::removeTracksInError,
                 &d->mDatabaseInterface, &DatabaseInterface::removeTracksList);
 
-        connect(&d->mDatabaseInterface, &DatabaseInterface::trackRemoved, d->mTracksListener.get(), &TracksListener::trackRemoved);
+        connect(&d->mDatabaseInterface, &DatabaseInterface::tracksRemoved, d->mTracksListener.get(), &TracksListener::tracksRemoved);
         connect(&d->mDatabaseInterface, &DatabaseInterface::tracksAdded, d->mTracksListener.get(), &TracksListener::tracksAdded);
         connect(&d->mDatabaseInterface, &DatabaseInterface::trackModified, d->mTracksListener.get(), &TracksListener::trackModified);
     }
 }
 
+void MusicListenersManager::writeCollectionSnapshot()
+{
+    if (!d->mDatabaseIsReady || d->mCollectionSnapshotFileName.isEmpty()) {
+        return;
+    }
+
+    const auto currentGeneration = d->mDatabaseInterface.collectionGeneration();
+    if (currentGeneration == d->mCollectionSnapshotGeneration) {
+        return;
+    }
+
+    d->mCollectionSnapshotGeneration = currentGeneration;
+
+    QMetaObject::invokeMethod(&d->mDatabaseInterface, "writeCollectionSnapshot", Qt::QueuedConnection,
+                              Q_ARG(QString, d->mCollectionSnapshotFileName));
+}
+
+void MusicListenersManager::collectionSnapshotLoaded()
+{
+    d->mCollectionSnapshotIsLoading = false;
+
+    if (d->mCollectionSnapshotWatcher.result()) {
+        d->mCollectionSnapshotGeneration = d->mCollectionSnapshot.generation();
+    }
+
+    invalidateOutdatedCollectionSnapshot();
+
+    Q_EMIT collectionSnapshotReady();
+}
+
+bool MusicListenersManager::collectionSnapshotMatchesDatabase() const
+{
+    return d->mCollectionSnapshot.identity() == d->mDatabaseInterface.collectionIdentity() &&
+            d->mCollectionSnapshot.generation() == d->mDatabaseInterface.collectionGeneration();
+}
+
+void MusicListenersManager::invalidateOutdatedCollectionSnapshot()
+{
+    if (!d->mDatabaseIsReady || d->mCollectionSnapshotIsLoading || !d->mCollectionSnapshot.isValid() ||
+            collectionSnapshotMatchesDatabase()) {
+        return;
+    }
+
+    qCInfo(orgKdeElisaIndexersManager) << "MusicListenersManager::invalidateOutdatedCollectionSnapshot" << "collection snapshot is outdated";
+
+    d->mCollectionSnapshot.clear();
+    d->mCollectionSnapshotGeneration = 0;
+
+    Q_EMIT collectionSnapshotInvalidated();
+}
 
 #include "moc_musiclistenersmanager.cpp"
@@ -33,6 +33,7 @@ class MediaPlayList;
 class NotificationItem;
 class ElisaApplication;
 class ModelDataLoader;
+class CollectionSnapshot;
 
 class ELISALIB_EXPORT MusicListenersManager : public QObject
 {
@@ -102,6 +103,18 @@ public:
 
     bool androidIndexerAvailable() const;
 
+    /**
+     * True while the snapshot saved by the previous run is read in a worker thread.
+     * collectionSnapshotReady() is emitted when it is done.
+     */
+    bool collectionSnapshotIsLoading() const;
+
+    /**
+     * Snapshot of the collection saved by the previous run, or nullptr while it is
+     * loading or once it no longer matches the database.
+     */
+    const CollectionSnapshot* collectionSnapshot();
+
 Q_SIGNALS:
 
     void viewDatabaseChanged();
@@ -134,6 +147,10 @@ Q_SIGNALS:
 
     void androidIndexerAvailableChanged();
 
+    void collectionSnapshotInvalidated();
+
+    void collectionSnapshotReady();
+
 public Q_SLOTS:
 
     void databaseReady();
@@ -164,6 +181,8 @@ private Q_SLOTS:
 
     void cleanedDatabase();
 
+    void collectionSnapshotLoaded();
+
     void balooAvailabilityChanged();
 
 private:
@@ -174,6 +193,12 @@ private:
 
     void startBalooIndexing();
 
+    void writeCollectionSnapshot();
+
+    bool collectionSnapshotMatchesDatabase() const;
+
+    void invalidateOutdatedCollectionSnapshot();
+
     std::unique_ptr<MusicListenersManagerPrivate> d;
 
     void createTracksListener();
@@ -22,11 +22,21 @@
 
 #include <QMimeDatabase>
 #include <QSet>
+#include <QHash>
 #include <QList>
 #include <QDebug>
 
 #include <array>
 #include <algorithm>
+#include <tuple>
+
+using TracksListenerNameKey = std::tuple<QString, QString, QString, int, int>;
+
+static uint qHash(const TracksListenerNameKey &key, uint seed = 0)
+{
+    return qHash(std::get<0>(key), seed) ^ qHash(std::get<1>(key), seed) ^ qHash(std::get<2>(key), seed) ^
+            qHash(std::get<3>(key), seed) ^ qHash(std::get<4>(key), seed);
+}
 
 class TracksListenerPrivate
 {
@@ -34,7 +44,7 @@ public:
 
     QSet<qulonglong> mTracksByIdSet;
 
-    QList<std::tuple<QString, QString, QString, int, int>> mTracksByNameSet;
+    QHash<TracksListenerNameKey, int> mTracksByNameSet;
 
     QList<QUrl> mTracksByFileNameSet;
 
@@ -56,46 +66,33 @@ TracksListener::~TracksListener()
 
 void TracksListener::tracksAdded(const ListTrackDataType &allTracks)
 {
+    auto changedTracks = ListTrackDataType{};
+
     for (const auto &oneTrack : allTracks) {
         if (d->mTracksByIdSet.contains(oneTrack.databaseId())) {
-            Q_EMIT trackHasChanged(oneTrack);
+            changedTracks.push_back(oneTrack);
         }
 
         if (d->mTracksByNameSet.isEmpty()) {
-            return;
+            continue;
         }
 
-        for (auto itTrack = d->mTracksByNameSet.begin(); itTrack != d->mTracksByNameSet.end(); ) {
-            if (std::get<0>(*itTrack) != oneTrack.title()) {
-                ++itTrack;
-                continue;
-            }
-
-            if (std::get<1>(*itTrack) != oneTrack.artist()) {
-                ++itTrack;
-                continue;
-            }
-
-            if (std::get<2>(*itTrack) != oneTrack.album()) {
-                ++itTrack;
-                continue;
-            }
-
-            if (std::get<3>(*itTrack) != oneTrack.trackNumber()) {
-                ++itTrack;
-                continue;
-            }
+        auto itTrack = d->mTracksByNameSet.find(TracksListenerNameKey{oneTrack.title(), oneTrack.artist(), oneTrack.album(),
+                                                                      oneTrack.trackNumber(), oneTrack.discNumber()});
+        if (itTrack == d->mTracksByNameSet.end()) {
+            continue;
+        }
 
-            if (std::get<4>(*itTrack) != oneTrack.discNumber()) {
-                ++itTrack;
-                continue;
-            }
+        for (int i = 0; i < itTrack.value(); ++i) {
+            changedTracks.push_back(oneTrack);
+        }
 
-            Q_EMIT trackHasChanged(TrackDataType(oneTrack));
+        d->mTracksByIdSet.insert(oneTrack.databaseId());
+        d->mTracksByNameSet.erase(itTrack);
+    }
 
-            d->mTracksByIdSet.insert(oneTrack.databaseId());
-            itTrack = d->mTracksByNameSet.erase(itTrack);
-        }
+    if (!changedTracks.isEmpty()) {
+        Q_EMIT tracksHaveChanged(changedTracks);
     }
 }
 
@@ -106,6 +103,13 @@ void TracksListener::trackRemoved(qulonglong id)
     }
 }
 
+void TracksListener::tracksRemoved(const QList<qulonglong> &removedTracksIds)
+{
+    for (auto oneTrackId : removedTracksIds) {
+        trackRemoved(oneTrackId);
+    }
+}
+
 void TracksListener::trackModified(const TrackDataType &modifiedTrack)
 {
     if (d->mTracksByIdSet.contains(modifiedTrack.databaseId())) {
@@ -117,8 +121,7 @@ void TracksListener::trackByNameInList(const QString &title, const QString &arti
 {
     auto newTrackId = d->mDatabase->trackIdFromTitleAlbumTrackDiscNumber(title, artist, album, trackNumber, discNumber);
     if (newTrackId == 0) {
-        auto newTrack = std::tuple<QString, QString, QString, int, int>(title, artist, album, trackNumber, discNumber);
-        d->mTracksByNameSet.push_back(newTrack);
+        ++d->mTracksByNameSet[TracksListenerNameKey{title, artist, album, trackNumber, discNumber}];
 
         return;
     }
@@ -142,21 +145,20 @@ void TracksListener::trackByFileNameInList(const QUrl &fileName)
             auto oneData = DatabaseInterface::TrackDataType{};
 
             if (!newTrack.title().isEmpty()) {
-                oneData[DatabaseInterface::TrackDataType::key_type::TitleRole] = newTrack.title();
+                oneData.setTitle(newTrack.title());
             } else {
                 const auto &fileUrl = newTrack.resourceURI();
-                oneData[DatabaseInterface::TrackDataType::key_type::TitleRole] = fileUrl.fileName();
+                oneData.setTitle(fileUrl.fileName());
             }
 
-            oneData[DatabaseInterface::TrackDataType::key_type::ArtistRole] = newTrack.artist();
-            oneData[DatabaseInterface::TrackDataType::key_type::AlbumRole] = newTrack.albumName();
-            oneData[DatabaseInterface::TrackDataType::key_type::AlbumIdRole] = newTrack.albumId();
-            oneData[DatabaseInterface::TrackDataType::key_type::TrackNumberRole] = newTrack.trackNumber();
-            oneData[DatabaseInterface::TrackDataType::key_type::DiscNumberRole] = newTrack.discNumber();
-            oneData[DatabaseInterface::TrackDataType::key_type::DurationRole] = newTrack.duration();
-            oneData[DatabaseInterface::TrackDataType::key_type::MilliSecondsDurationRole] = newTrack.duration().msecsSinceStartOfDay();
-            oneData[DatabaseInterface::TrackDataType::key_type::ResourceRole] = newTrack.resourceURI();
-            oneData[DatabaseInterface::TrackDataType::key_type::ImageUrlRole] = newTrack.albumCover();
+            oneData.setArtist(newTrack.artist());
+            oneData.setAlbum(newTrack.albumName());
+            oneData.setAlbumId(newTrack.albumId());
+            oneData.setTrackNumber(newTrack.trackNumber());
+            oneData.setDiscNumber(newTrack.discNumber());
+            oneData.setDuration(newTrack.duration());
+            oneData.setResourceURI(newTrack.resourceURI());
+            oneData.setAlbumCover(newTrack.albumCover());
 
             Q_EMIT trackHasChanged(oneData);
 
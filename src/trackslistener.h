@@ -48,6 +48,8 @@ Q_SIGNALS:
 
     void trackHasChanged(const TracksListener::TrackDataType &audioTrack);
 
+    void tracksHaveChanged(const TracksListener::ListTrackDataType &audioTracks);
+
     void trackHasBeenRemoved(qulonglong id);
 
     void tracksListAdded(qulonglong newDatabaseId,
@@ -61,6 +63,8 @@ public Q_SLOTS:
 
     void trackRemoved(qulonglong id);
 
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
     void trackModified(const TracksListener::TrackDataType &modifiedTrack);
 
     void trackByNameInList(const QString &title, const QString &artist, const QString &album, int trackNumber, int discNumber);